@@ -0,0 +1,73 @@
+#include "NuxieAllocationCounter.h"
+
+#include "HAL/PlatformTLS.h"
+
+double FNuxieAllocationCounter::CountPerCall(int32 Count, TFunctionRef<void()> Call)
+{
+  check(IsInGameThread());
+
+  // Never destroyed: another thread may still be inside a call it forwarded after it is uninstalled.
+  static FNuxieAllocationCounter Counter;
+  Counter.Inner = GMalloc;
+  Counter.ThreadId = FPlatformTLS::GetCurrentThreadId();
+  Counter.NumAllocations = 0;
+
+  GMalloc = &Counter;
+  for (int32 Index = 0; Index < Count; ++Index)
+  {
+    Call();
+  }
+  GMalloc = Counter.Inner;
+
+  return Count > 0 ? static_cast<double>(Counter.NumAllocations) / Count : 0.0;
+}
+
+void* FNuxieAllocationCounter::Malloc(SIZE_T Count, uint32 Alignment)
+{
+  Note();
+  return Inner->Malloc(Count, Alignment);
+}
+
+void* FNuxieAllocationCounter::Realloc(void* Original, SIZE_T Count, uint32 Alignment)
+{
+  Note();
+  return Inner->Realloc(Original, Count, Alignment);
+}
+
+void FNuxieAllocationCounter::Free(void* Original)
+{
+  Inner->Free(Original);
+}
+
+SIZE_T FNuxieAllocationCounter::QuantizeSize(SIZE_T Count, uint32 Alignment)
+{
+  return Inner->QuantizeSize(Count, Alignment);
+}
+
+bool FNuxieAllocationCounter::GetAllocationSize(void* Original, SIZE_T& SizeOut)
+{
+  return Inner->GetAllocationSize(Original, SizeOut);
+}
+
+void FNuxieAllocationCounter::Trim(bool bTrimThreadCaches)
+{
+  Inner->Trim(bTrimThreadCaches);
+}
+
+bool FNuxieAllocationCounter::IsInternallyThreadSafe() const
+{
+  return Inner->IsInternallyThreadSafe();
+}
+
+const TCHAR* FNuxieAllocationCounter::GetDescriptiveName()
+{
+  return TEXT("NuxieAllocationCounter");
+}
+
+void FNuxieAllocationCounter::Note()
+{
+  if (FPlatformTLS::GetCurrentThreadId() == ThreadId)
+  {
+    ++NumAllocations;
+  }
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Counts heap allocations for the automation tests that bound them.
+ *
+ * While a count runs, the counter is installed as GMalloc and forwards every call to the allocator
+ * it replaced. Only Malloc and Realloc calls made by the counting thread are counted. Not for
+ * shipping code paths.
+ */
+class FNuxieAllocationCounter final : public FMalloc
+{
+public:
+  /** Calls Call Count times on this thread and returns the average number of allocations per call. */
+  static double CountPerCall(int32 Count, TFunctionRef<void()> Call);
+
+  virtual void* Malloc(SIZE_T Count, uint32 Alignment) override;
+  virtual void* Realloc(void* Original, SIZE_T Count, uint32 Alignment) override;
+  virtual void Free(void* Original) override;
+  virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override;
+  virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override;
+  virtual void Trim(bool bTrimThreadCaches) override;
+  virtual bool IsInternallyThreadSafe() const override;
+  virtual const TCHAR* GetDescriptiveName() override;
+
+private:
+  void Note();
+
+  FMalloc* Inner = nullptr;
+  uint32 ThreadId = 0;
+  int64 NumAllocations = 0;
+};
@@ -15,3 +15,39 @@ void NuxieRunOnGameThread(TFunction<void()> Work)
     Work();
   });
 }
+
+void NuxieRunWithDelivery(const FNuxieDeliveryPolicy& Delivery, TFunction<void()> Work)
+{
+  switch (Delivery.Mode)
+  {
+  case ENuxieDeliveryMode::AnyThread:
+    Work();
+    return;
+  case ENuxieDeliveryMode::NamedThread:
+    AsyncTask(Delivery.NamedThread, [Work = MoveTemp(Work)]() mutable
+    {
+      Work();
+    });
+    return;
+  case ENuxieDeliveryMode::GameThread:
+  default:
+    NuxieRunOnGameThread(MoveTemp(Work));
+    return;
+  }
+}
+
+FSimpleDelegate NuxieBindDelivery(const FNuxieDeliveryPolicy& Delivery, FSimpleDelegate Callback)
+{
+  if (Delivery.Mode == ENuxieDeliveryMode::AnyThread)
+  {
+    return Callback;
+  }
+
+  return FSimpleDelegate::CreateLambda([Delivery, Callback = MoveTemp(Callback)]()
+  {
+    NuxieRunWithDelivery(Delivery, [Callback]()
+    {
+      Callback.ExecuteIfBound();
+    });
+  });
+}
@@ -1,5 +1,27 @@
 #pragma once
 
+#include "NuxiePlatformBridge.h"
 #include "Templates/Function.h"
 
 NUXIE_API void NuxieRunOnGameThread(TFunction<void()> Work);
+NUXIE_API void NuxieRunWithDelivery(const FNuxieDeliveryPolicy& Delivery, TFunction<void()> Work);
+
+/** Wraps Callback so that it is invoked according to Delivery. AnyThread returns Callback unchanged. */
+template <typename... ArgTypes>
+TFunction<void(ArgTypes...)> NuxieBindDelivery(const FNuxieDeliveryPolicy& Delivery, TFunction<void(ArgTypes...)> Callback)
+{
+  if (Delivery.Mode == ENuxieDeliveryMode::AnyThread)
+  {
+    return Callback;
+  }
+
+  return [Delivery, Callback = MoveTemp(Callback)](ArgTypes... Args) mutable
+  {
+    NuxieRunWithDelivery(Delivery, [Callback = MoveTemp(Callback), ...Values = std::decay_t<ArgTypes>(Args)]() mutable
+    {
+      Callback(Values...);
+    });
+  };
+}
+
+NUXIE_API FSimpleDelegate NuxieBindDelivery(const FNuxieDeliveryPolicy& Delivery, FSimpleDelegate Callback);
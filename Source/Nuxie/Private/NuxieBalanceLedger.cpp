@@ -0,0 +1,371 @@
+#include "NuxieBalanceLedger.h"
+
+#include "Dom/JsonObject.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+FNuxieBalanceLedger::FNuxieBalanceLedger(FString InPersistPath)
+  : PersistPath(MoveTemp(InPersistPath))
+{
+}
+
+FNuxieBalanceLedger::~FNuxieBalanceLedger()
+{
+  Flush();
+}
+
+int64 FNuxieBalanceLedger::Reserve(
+  const FString& FeatureId,
+  const FString& EntityId,
+  int32 Amount,
+  const TOptional<int32>& KnownBalance,
+  TOptional<int32>& OutProjected)
+{
+  FEntry& Entry = FindOrAddEntry(FeatureId, EntityId);
+  if (!Entry.bHasBase && KnownBalance.IsSet())
+  {
+    Entry.bHasBase = true;
+    Entry.Base = KnownBalance.GetValue();
+  }
+
+  FPendingUse& Use = Entry.Pending.AddDefaulted_GetRef();
+  Use.Sequence = NextSequence++;
+  Use.Amount = Amount;
+
+  OutProjected.Reset();
+  if (Entry.bHasBase)
+  {
+    OutProjected = Entry.Base - SumOutstanding(Entry);
+  }
+
+  MarkDirty();
+  return Use.Sequence;
+}
+
+bool FNuxieBalanceLedger::GetProjectedBalance(
+  const FString& FeatureId,
+  const FString& EntityId,
+  const TOptional<int32>& KnownBalance,
+  int32& OutBalance) const
+{
+  FKey Key;
+  const FEntry* Entry = FindKey(FeatureId, EntityId, Key) ? Entries.Find(Key) : nullptr;
+  if (Entry == nullptr)
+  {
+    if (!KnownBalance.IsSet())
+    {
+      return false;
+    }
+    OutBalance = KnownBalance.GetValue();
+    return true;
+  }
+
+  if (!Entry->bHasBase && !KnownBalance.IsSet())
+  {
+    return false;
+  }
+
+  OutBalance = (Entry->bHasBase ? Entry->Base : KnownBalance.GetValue()) - SumOutstanding(*Entry);
+  return true;
+}
+
+bool FNuxieBalanceLedger::HasPending(const FString& FeatureId, const FString& EntityId) const
+{
+  FKey Key;
+  return FindKey(FeatureId, EntityId, Key) && Entries.Contains(Key);
+}
+
+void FNuxieBalanceLedger::Confirm(int64 Sequence, const FNuxieFeatureUsageResult& Result)
+{
+  FKey Key;
+  FEntry* Entry = FindEntryBySequence(Sequence, Key);
+  if (Entry == nullptr)
+  {
+    return;
+  }
+
+  Entry->Pending.RemoveAll([Sequence](const FPendingUse& Use) { return Use.Sequence == Sequence; });
+
+  // Results can arrive out of order from the bridge; only a newer one may move the base.
+  if (Result.bHasUsageRemaining && Sequence > Entry->BaseSequence)
+  {
+    Entry->bHasBase = true;
+    Entry->Base = Result.UsageRemaining;
+    Entry->BaseSequence = Sequence;
+
+    // The native SDK applies uses in submission order, so earlier ones are already in this balance.
+    Entry->Pending.RemoveAll([](const FPendingUse& Use) { return Use.bRestored; });
+    for (FPendingUse& Use : Entry->Pending)
+    {
+      Use.bAbsorbed |= Use.Sequence < Sequence;
+    }
+  }
+
+  RemoveIfSettled(Key);
+  MarkDirty();
+}
+
+void FNuxieBalanceLedger::Reject(int64 Sequence)
+{
+  FKey Key;
+  FEntry* Entry = FindEntryBySequence(Sequence, Key);
+  if (Entry == nullptr)
+  {
+    return;
+  }
+
+  Entry->Pending.RemoveAll([Sequence](const FPendingUse& Use) { return Use.Sequence == Sequence; });
+  RemoveIfSettled(Key);
+  MarkDirty();
+}
+
+void FNuxieBalanceLedger::ApplyAuthoritative(const FString& FeatureId, const FString& EntityId, int32 Balance)
+{
+  FKey Key;
+  FEntry* Entry = FindKey(FeatureId, EntityId, Key) ? Entries.Find(Key) : nullptr;
+  if (Entry == nullptr)
+  {
+    return;
+  }
+
+  Entry->Pending.RemoveAll([](const FPendingUse& Use) { return Use.bRestored; });
+
+  // A pushed balance carries no sequence. If it matches the projection the server has caught up
+  // with every outstanding use; otherwise they are still applied on top of it.
+  const bool bMatchesProjection = Entry->bHasBase && Entry->Base - SumOutstanding(*Entry) == Balance;
+  Entry->bHasBase = true;
+  Entry->Base = Balance;
+  if (bMatchesProjection)
+  {
+    for (FPendingUse& Use : Entry->Pending)
+    {
+      Use.bAbsorbed = true;
+    }
+    Entry->BaseSequence = NextSequence - 1;
+  }
+
+  RemoveIfSettled(Key);
+  MarkDirty();
+}
+
+int32 FNuxieBalanceLedger::Load()
+{
+  FString Json;
+  if (PersistPath.IsEmpty() || !FFileHelper::LoadFileToString(Json, *PersistPath))
+  {
+    return 0;
+  }
+
+  TSharedPtr<FJsonObject> Root;
+  const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Json);
+  const TArray<TSharedPtr<FJsonValue>>* Pending = nullptr;
+  if (!FJsonSerializer::Deserialize(Reader, Root) || !Root.IsValid() || !Root->TryGetArrayField(TEXT("pending"), Pending))
+  {
+    return 0;
+  }
+  Root->TryGetStringField(TEXT("distinct_id"), DistinctId);
+
+  int32 NumRestored = 0;
+  for (const TSharedPtr<FJsonValue>& Value : *Pending)
+  {
+    const TSharedPtr<FJsonObject>* Object = nullptr;
+    FString FeatureId;
+    FString EntityId;
+    int32 Amount = 0;
+    if (!Value.IsValid()
+      || !Value->TryGetObject(Object)
+      || !(*Object)->TryGetStringField(TEXT("feature_id"), FeatureId)
+      || !(*Object)->TryGetNumberField(TEXT("amount"), Amount))
+    {
+      continue;
+    }
+    (*Object)->TryGetStringField(TEXT("entity_id"), EntityId);
+
+    FPendingUse& Use = FindOrAddEntry(FeatureId, EntityId).Pending.AddDefaulted_GetRef();
+    Use.Sequence = NextSequence++;
+    Use.Amount = Amount;
+    Use.bRestored = true;
+    ++NumRestored;
+  }
+  return NumRestored;
+}
+
+bool FNuxieBalanceLedger::SetDistinctId(const FString& InDistinctId)
+{
+  // Distinct IDs are case-sensitive on the server; "Alice" is another user.
+  if (DistinctId.Equals(InDistinctId, ESearchCase::CaseSensitive))
+  {
+    return false;
+  }
+
+  // Uses recorded while anonymous move with the user, as the native SDK's queued events do.
+  const bool bSwitched = !DistinctId.IsEmpty();
+  if (bSwitched)
+  {
+    Entries.Reset();
+  }
+  DistinctId = InDistinctId;
+  MarkDirty();
+  return bSwitched;
+}
+
+void FNuxieBalanceLedger::Reset()
+{
+  Entries.Reset();
+  DistinctId.Reset();
+  MarkDirty();
+}
+
+void FNuxieBalanceLedger::Flush()
+{
+  if (SaveTicker.IsValid())
+  {
+    FTSTicker::GetCoreTicker().RemoveTicker(SaveTicker);
+    SaveTicker.Reset();
+  }
+  if (bDirty)
+  {
+    Save();
+  }
+  PendingWrite.Wait();
+}
+
+int32 FNuxieBalanceLedger::NumPending() const
+{
+  int32 Num = 0;
+  for (const TPair<FKey, FEntry>& Pair : Entries)
+  {
+    Num += Pair.Value.Pending.Num();
+  }
+  return Num;
+}
+
+FNuxieBalanceLedger::FKey FNuxieBalanceLedger::MakeKey(const FString& FeatureId, const FString& EntityId)
+{
+  return FKey { FNuxieName(FeatureId), FNuxieName::FromOptional(EntityId) };
+}
+
+bool FNuxieBalanceLedger::FindKey(const FString& FeatureId, const FString& EntityId, FKey& OutKey)
+{
+  OutKey.Feature = FNuxieName(FeatureId, FNAME_Find);
+  OutKey.Entity = FNuxieName::FromOptional(EntityId, FNAME_Find);
+  return !OutKey.Feature.IsNone() && (EntityId.IsEmpty() || !OutKey.Entity.IsNone());
+}
+
+FNuxieBalanceLedger::FEntry& FNuxieBalanceLedger::FindOrAddEntry(const FString& FeatureId, const FString& EntityId)
+{
+  FEntry& Entry = Entries.FindOrAdd(MakeKey(FeatureId, EntityId));
+  if (Entry.FeatureId.IsEmpty())
+  {
+    Entry.FeatureId = FeatureId;
+    Entry.EntityId = EntityId;
+  }
+  return Entry;
+}
+
+int32 FNuxieBalanceLedger::SumOutstanding(const FEntry& Entry)
+{
+  int32 Sum = 0;
+  for (const FPendingUse& Use : Entry.Pending)
+  {
+    Sum += Use.bAbsorbed ? 0 : Use.Amount;
+  }
+  return Sum;
+}
+
+FNuxieBalanceLedger::FEntry* FNuxieBalanceLedger::FindEntryBySequence(int64 Sequence, FKey& OutKey)
+{
+  for (TPair<FKey, FEntry>& Pair : Entries)
+  {
+    if (Pair.Value.Pending.ContainsByPredicate([Sequence](const FPendingUse& Use) { return Use.Sequence == Sequence; }))
+    {
+      OutKey = Pair.Key;
+      return &Pair.Value;
+    }
+  }
+  return nullptr;
+}
+
+void FNuxieBalanceLedger::RemoveIfSettled(const FKey& Key)
+{
+  const FEntry* Entry = Entries.Find(Key);
+  if (Entry != nullptr && Entry->Pending.Num() == 0)
+  {
+    Entries.Remove(Key);
+  }
+}
+
+void FNuxieBalanceLedger::MarkDirty()
+{
+  bDirty = true;
+  if (PersistPath.IsEmpty() || SaveTicker.IsValid())
+  {
+    return;
+  }
+
+  // Every change within the delay lands in one write.
+  SaveTicker = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([this](float)
+  {
+    SaveTicker.Reset();
+    Save();
+    return false;
+  }), SaveDelaySeconds);
+}
+
+void FNuxieBalanceLedger::Save()
+{
+  bDirty = false;
+  if (PersistPath.IsEmpty())
+  {
+    return;
+  }
+
+  // Absorbed uses are already in a server balance; only outstanding ones need to survive a restart.
+  TArray<TSharedPtr<FJsonValue>> Pending;
+  for (const TPair<FKey, FEntry>& Pair : Entries)
+  {
+    for (const FPendingUse& Use : Pair.Value.Pending)
+    {
+      if (Use.bAbsorbed)
+      {
+        continue;
+      }
+
+      const TSharedRef<FJsonObject> Object = MakeShared<FJsonObject>();
+      Object->SetStringField(TEXT("feature_id"), Pair.Value.FeatureId);
+      Object->SetStringField(TEXT("entity_id"), Pair.Value.EntityId);
+      Object->SetNumberField(TEXT("amount"), Use.Amount);
+      Pending.Add(MakeShared<FJsonValueObject>(Object));
+    }
+  }
+
+  // The snapshot is taken here; only the file I/O moves off the game thread. An empty Json
+  // deletes the file.
+  FString Json;
+  if (Pending.Num() > 0)
+  {
+    const TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+    Root->SetStringField(TEXT("distinct_id"), DistinctId);
+    Root->SetArrayField(TEXT("pending"), Pending);
+    const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Json);
+    FJsonSerializer::Serialize(Root, Writer);
+  }
+
+  TFunction<void()> Write = [Path = PersistPath, Json = MoveTemp(Json)]()
+  {
+    if (Json.IsEmpty())
+    {
+      IFileManager::Get().Delete(*Path, false, false, true);
+    }
+    else
+    {
+      FFileHelper::SaveStringToFile(Json, *Path);
+    }
+  };
+  PendingWrite = PendingWrite.IsValid()
+    ? UE::Tasks::Launch(UE_SOURCE_LOCATION, MoveTemp(Write), UE::Tasks::Prerequisites(PendingWrite))
+    : UE::Tasks::Launch(UE_SOURCE_LOCATION, MoveTemp(Write));
+}
@@ -0,0 +1,139 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Containers/Ticker.h"
+#include "NuxieName.h"
+#include "NuxieTypes.h"
+#include "Tasks/Task.h"
+
+/**
+ * Local balance ledger behind UNuxieSubsystem::UseFeatureOptimistic.
+ *
+ * Each optimistic use is recorded as a pending delta against the last balance known for its
+ * feature and entity, so the projected balance is available immediately. Deltas are reconciled by
+ * the usage result for their own sequence number and by pushed access changes. Pending deltas are
+ * written to PersistPath at most once per SaveDelaySeconds, on a background task, and when the
+ * ledger is destroyed. After a restart they are restored as projection-only entries: they were
+ * already handed to the native SDK, whose own event queue resubmits them, so they are never sent
+ * again and are dropped at the first authoritative balance for their key. The file also records
+ * which distinct ID the deltas belong to, so only a real user switch clears them. Game thread only.
+ */
+class FNuxieBalanceLedger
+{
+public:
+  explicit FNuxieBalanceLedger(FString InPersistPath);
+  ~FNuxieBalanceLedger();
+
+  /**
+   * Records a pending use and returns its sequence number. KnownBalance seeds the base balance when
+   * the ledger has none for the key yet. OutProjected is unset when no base balance is known.
+   */
+  int64 Reserve(
+    const FString& FeatureId,
+    const FString& EntityId,
+    int32 Amount,
+    const TOptional<int32>& KnownBalance,
+    TOptional<int32>& OutProjected);
+
+  /** Falls back to KnownBalance when the ledger has no base balance of its own for the key. */
+  bool GetProjectedBalance(const FString& FeatureId, const FString& EntityId, const TOptional<int32>& KnownBalance, int32& OutBalance) const;
+
+  bool HasPending(const FString& FeatureId, const FString& EntityId) const;
+
+  /** Reconciles a pending use with its server result. Results older than the current base are ignored. */
+  void Confirm(int64 Sequence, const FNuxieFeatureUsageResult& Result);
+
+  /** Drops a pending use the native SDK rejected. */
+  void Reject(int64 Sequence);
+
+  /** Applies a pushed balance; restored deltas for the key are dropped. */
+  void ApplyAuthoritative(const FString& FeatureId, const FString& EntityId, int32 Balance);
+
+  /** Restores pending deltas written by a previous session. Returns the number restored. */
+  int32 Load();
+
+  /**
+   * Binds the ledger to the user the native SDK is identified as. Pending deltas recorded for a
+   * different distinct ID are cleared; deltas recorded before any Identify are kept. Returns true
+   * when it cleared them.
+   */
+  bool SetDistinctId(const FString& DistinctId);
+
+  /** Clears every delta and forgets the distinct ID, as on a logout. */
+  void Reset();
+
+  /** Writes a change that is still waiting for the save delay and blocks until it is on disk. */
+  void Flush();
+
+  int32 NumPending() const;
+
+private:
+  // FString compares ignoring case, which would merge the deltas of "Gems" and "gems".
+  struct FKey
+  {
+    FNuxieName Feature;
+    FNuxieName Entity;
+
+    bool operator==(const FKey& Other) const
+    {
+      return Feature == Other.Feature && Entity == Other.Entity;
+    }
+
+    friend uint32 GetTypeHash(const FKey& Key)
+    {
+      return HashCombineFast(GetTypeHash(Key.Feature), GetTypeHash(Key.Entity));
+    }
+  };
+
+  struct FPendingUse
+  {
+    int64 Sequence = 0;
+    int32 Amount = 0;
+
+    /** Already reflected in Base; kept only so the late result is recognized. */
+    bool bAbsorbed = false;
+
+    /** Loaded from a previous session. */
+    bool bRestored = false;
+  };
+
+  struct FEntry
+  {
+    /** The IDs as given, for the file; an FName may have kept another spelling. */
+    FString FeatureId;
+    FString EntityId;
+
+    bool bHasBase = false;
+    int32 Base = 0;
+
+    /** Sequence of the newest result reflected in Base. */
+    int64 BaseSequence = 0;
+
+    TArray<FPendingUse> Pending;
+  };
+
+  static FKey MakeKey(const FString& FeatureId, const FString& EntityId);
+
+  /** Like MakeKey, but false without interning when either ID has never been seen. */
+  static bool FindKey(const FString& FeatureId, const FString& EntityId, FKey& OutKey);
+
+  FEntry& FindOrAddEntry(const FString& FeatureId, const FString& EntityId);
+  static int32 SumOutstanding(const FEntry& Entry);
+  FEntry* FindEntryBySequence(int64 Sequence, FKey& OutKey);
+  void RemoveIfSettled(const FKey& Key);
+  void MarkDirty();
+  void Save();
+
+  static constexpr float SaveDelaySeconds = 1.0f;
+
+  FString PersistPath;
+  FString DistinctId;
+  TMap<FKey, FEntry> Entries;
+  int64 NextSequence = 1;
+  bool bDirty = false;
+  FTSTicker::FDelegateHandle SaveTicker;
+
+  /** The last background write; each write waits for the one before it. */
+  UE::Tasks::FTask PendingWrite;
+};
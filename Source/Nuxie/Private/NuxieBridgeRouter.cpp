@@ -1,13 +1,31 @@
 #include "NuxieBridgeRouter.h"
 
-#include "Platform/NuxieNoopBridge.h"
-
 #if PLATFORM_IOS
 #include "Platform/IOS/NuxieIOSBridge.h"
+#elif PLATFORM_ANDROID
+#include "Platform/Android/NuxieAndroidBridge.h"
+#else
+#include "Misc/ConfigCacheIni.h"
+#include "Platform/Http/NuxieHttpBridge.h"
+#include "Platform/NuxieNoopBridge.h"
 #endif
 
-#if PLATFORM_ANDROID
-#include "Platform/Android/NuxieAndroidBridge.h"
+#if !PLATFORM_IOS && !PLATFORM_ANDROID
+namespace
+{
+  // Editor, PIE and commandlet sessions stay off the live API unless the project opts in.
+  bool ShouldUseHttpBridge()
+  {
+    if (!GIsEditor && !IsRunningCommandlet())
+    {
+      return true;
+    }
+
+    bool bUseHttpBridgeInEditor = false;
+    GConfig->GetBool(TEXT("/Script/Nuxie.NuxieSubsystem"), TEXT("bUseHttpBridgeInEditor"), bUseHttpBridgeInEditor, GGameIni);
+    return bUseHttpBridgeInEditor;
+  }
+}
 #endif
 
 TUniquePtr<INuxiePlatformBridge> CreateNuxiePlatformBridge()
@@ -17,6 +35,10 @@ TUniquePtr<INuxiePlatformBridge> CreateNuxiePlatformBridge()
 #elif PLATFORM_ANDROID
   return MakeUnique<FNuxieAndroidBridge>();
 #else
+  if (ShouldUseHttpBridge())
+  {
+    return MakeUnique<FNuxieHttpBridge>();
+  }
   return MakeUnique<FNuxieNoopBridge>();
 #endif
 }
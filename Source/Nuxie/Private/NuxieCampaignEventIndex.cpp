@@ -0,0 +1,82 @@
+#include "NuxieCampaignEventIndex.h"
+
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+bool FNuxieCampaignEventIndex::LoadProfileJson(const FString& RawJson)
+{
+  Reset();
+
+  TSharedPtr<FJsonObject> Root;
+  const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(RawJson);
+  if (!FJsonSerializer::Deserialize(Reader, Root) || !Root.IsValid())
+  {
+    return false;
+  }
+
+  const TArray<TSharedPtr<FJsonValue>>* Campaigns = nullptr;
+  if (!Root->TryGetArrayField(TEXT("campaigns"), Campaigns))
+  {
+    return false;
+  }
+
+  for (const TSharedPtr<FJsonValue>& Value : *Campaigns)
+  {
+    const TSharedPtr<FJsonObject>* Campaign = nullptr;
+    const TSharedPtr<FJsonObject>* Trigger = nullptr;
+    FString Type;
+    FString EventName;
+    if (!Value.IsValid()
+      || !Value->TryGetObject(Campaign)
+      || !(*Campaign)->TryGetObjectField(TEXT("trigger"), Trigger)
+      || !(*Trigger)->TryGetStringField(TEXT("type"), Type)
+      || Type != TEXT("event")
+      || !(*Trigger)->TryGetStringField(TEXT("event_name"), EventName)
+      || EventName.IsEmpty())
+    {
+      // Segment and unknown triggers can fire on any event, so nothing may be short-circuited.
+      Reset();
+      return false;
+    }
+
+    EventNames.Add(FName(*EventName));
+  }
+
+  bComplete = true;
+  return true;
+}
+
+bool FNuxieCampaignEventIndex::CanMatch(FName EventName) const
+{
+  // FName comparison ignores case, which can only let an extra event through.
+  return !bComplete || EventNames.Contains(EventName);
+}
+
+bool FNuxieCampaignEventIndex::CanMatch(const FString& EventName) const
+{
+  if (!bComplete)
+  {
+    return true;
+  }
+
+  // A name that was never interned cannot be in the index.
+  const FName Name(*EventName, FNAME_Find);
+  return !Name.IsNone() && EventNames.Contains(Name);
+}
+
+void FNuxieCampaignEventIndex::Reset()
+{
+  EventNames.Reset();
+  bComplete = false;
+}
+
+bool FNuxieCampaignEventIndex::IsComplete() const
+{
+  return bComplete;
+}
+
+int32 FNuxieCampaignEventIndex::Num() const
+{
+  return EventNames.Num();
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Event names that can start a campaign, built from the `campaigns` array of a profile snapshot.
+ * StartTrigger consults it to resolve events no campaign listens for without a bridge call.
+ *
+ * The index only answers "cannot match" once it has seen a complete campaign list in which every
+ * trigger is an event trigger; until then, or when any campaign uses another trigger type, every
+ * event is passed through. Game thread only.
+ */
+class FNuxieCampaignEventIndex
+{
+public:
+  /**
+   * Rebuilds the index from a profile JSON object with a `campaigns` array of
+   * `{ id, trigger: { type, event_name? } }`. Returns false (and disables the index) when RawJson
+   * has no such array.
+   */
+  bool LoadProfileJson(const FString& RawJson);
+
+  /** False only when the index is complete and EventName is not in it. */
+  bool CanMatch(FName EventName) const;
+  bool CanMatch(const FString& EventName) const;
+
+  void Reset();
+  bool IsComplete() const;
+  int32 Num() const;
+
+private:
+  TSet<FName> EventNames;
+  bool bComplete = false;
+};
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Misc/Crc.h"
+
+/**
+ * Key funcs for FString-keyed maps and sets whose keys are backend IDs or property names. The
+ * defaults hash and compare ignoring case, which would merge "Level" and "level"; these keep them
+ * apart. For IDs that are looked up often, prefer FNuxieName.
+ */
+template <typename ValueType>
+struct TNuxieCaseSensitiveMapKeyFuncs : TDefaultMapKeyFuncs<FString, ValueType, false>
+{
+  static bool Matches(const FString& A, const FString& B)
+  {
+    return A.Equals(B, ESearchCase::CaseSensitive);
+  }
+
+  static uint32 GetKeyHash(const FString& Key)
+  {
+    return FCrc::StrCrc32(*Key);
+  }
+};
+
+struct FNuxieCaseSensitiveSetKeyFuncs : DefaultKeyFuncs<FString>
+{
+  static bool Matches(const FString& A, const FString& B)
+  {
+    return A.Equals(B, ESearchCase::CaseSensitive);
+  }
+
+  static uint32 GetKeyHash(const FString& Key)
+  {
+    return FCrc::StrCrc32(*Key);
+  }
+};
+
+/** TMap<FString, ValueType> with case-sensitive keys. */
+template <typename ValueType>
+using TNuxieCaseSensitiveMap = TMap<FString, ValueType, FDefaultSetAllocator, TNuxieCaseSensitiveMapKeyFuncs<ValueType>>;
+
+/** TSet<FString> with case-sensitive keys. */
+using FNuxieCaseSensitiveSet = TSet<FString, FNuxieCaseSensitiveSetKeyFuncs>;
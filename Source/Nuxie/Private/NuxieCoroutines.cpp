@@ -0,0 +1,213 @@
+#include "NuxieCoroutines.h"
+
+#include "NuxieAsyncQueue.h"
+
+namespace
+{
+  // Operations report straight from the bridge thread; the awaiter applies its own policy on resume.
+
+  template <typename T>
+  TFunction<void(const T&)> MakeValueSink(TNuxieAsyncResult<T>& OutResult, FNuxieAwaitSlot& Slot)
+  {
+    return [&OutResult, Ref = FNuxieAwaitSinkRef(Slot)](const T& Value)
+    {
+      OutResult.Value = Value;
+      Ref.Complete();
+    };
+  }
+
+  template <typename T>
+  FNuxieErrorCallback MakeErrorSink(TNuxieAsyncResult<T>& OutResult, FNuxieAwaitSlot& Slot)
+  {
+    return [&OutResult, Ref = FNuxieAwaitSinkRef(Slot)](const FNuxieError& Error)
+    {
+      OutResult.Error = Error;
+      Ref.Complete();
+    };
+  }
+
+  template <typename T>
+  void CompleteUnavailable(TNuxieAsyncResult<T>& OutResult, FNuxieAwaitSlot& Slot)
+  {
+    OutResult.Error = NuxieCoroutines::MakeSubsystemUnavailableError();
+    Slot.Complete();
+  }
+}
+
+void NuxieCoroutines::Resume(const FNuxieDeliveryPolicy& Delivery, std::coroutine_handle<> Handle)
+{
+  NuxieRunWithDelivery(Delivery, [Handle]()
+  {
+    Handle.resume();
+  });
+}
+
+FNuxieError NuxieCoroutines::MakeSubsystemUnavailableError()
+{
+  return FNuxieError::Make(TEXT("NATIVE_UNAVAILABLE"), TEXT("Nuxie subsystem is unavailable."));
+}
+
+FNuxieError NuxieCoroutines::MakeDroppedError()
+{
+  return FNuxieError::Make(TEXT("NATIVE_UNAVAILABLE"), TEXT("The operation was dropped before it completed."));
+}
+
+FNuxieRefreshProfileAwaitable::FNuxieRefreshProfileAwaitable(UNuxieSubsystem* InSubsystem)
+  : Subsystem(InSubsystem)
+{
+}
+
+void FNuxieRefreshProfileAwaitable::Start(TNuxieAsyncResult<FNuxieProfileResponse>& OutResult, FNuxieAwaitSlot& Slot)
+{
+  UNuxieSubsystem* Target = Subsystem.Get();
+  if (Target == nullptr)
+  {
+    CompleteUnavailable(OutResult, Slot);
+    return;
+  }
+
+  Target->RefreshProfileAsync(MakeValueSink(OutResult, Slot), MakeErrorSink(OutResult, Slot), FNuxieDeliveryPolicy::AnyThread());
+}
+
+FNuxieHasFeatureAwaitable::FNuxieHasFeatureAwaitable(UNuxieSubsystem* InSubsystem, FString InFeatureId, int32 InRequiredBalance, FString InEntityId)
+  : Subsystem(InSubsystem)
+  , FeatureId(MoveTemp(InFeatureId))
+  , RequiredBalance(InRequiredBalance)
+  , EntityId(MoveTemp(InEntityId))
+{
+}
+
+void FNuxieHasFeatureAwaitable::Start(TNuxieAsyncResult<FNuxieFeatureAccess>& OutResult, FNuxieAwaitSlot& Slot)
+{
+  UNuxieSubsystem* Target = Subsystem.Get();
+  if (Target == nullptr)
+  {
+    CompleteUnavailable(OutResult, Slot);
+    return;
+  }
+
+  Target->HasFeatureAsync(
+    FeatureId,
+    RequiredBalance,
+    EntityId,
+    MakeValueSink(OutResult, Slot),
+    MakeErrorSink(OutResult, Slot),
+    FNuxieDeliveryPolicy::AnyThread());
+}
+
+FNuxieCheckFeatureAwaitable::FNuxieCheckFeatureAwaitable(
+  UNuxieSubsystem* InSubsystem,
+  FString InFeatureId,
+  int32 InRequiredBalance,
+  FString InEntityId,
+  bool bInForceRefresh)
+  : Subsystem(InSubsystem)
+  , FeatureId(MoveTemp(InFeatureId))
+  , RequiredBalance(InRequiredBalance)
+  , EntityId(MoveTemp(InEntityId))
+  , bForceRefresh(bInForceRefresh)
+{
+}
+
+void FNuxieCheckFeatureAwaitable::Start(TNuxieAsyncResult<FNuxieFeatureCheckResult>& OutResult, FNuxieAwaitSlot& Slot)
+{
+  UNuxieSubsystem* Target = Subsystem.Get();
+  if (Target == nullptr)
+  {
+    CompleteUnavailable(OutResult, Slot);
+    return;
+  }
+
+  Target->CheckFeatureAsync(
+    FeatureId,
+    RequiredBalance,
+    EntityId,
+    bForceRefresh,
+    MakeValueSink(OutResult, Slot),
+    MakeErrorSink(OutResult, Slot),
+    FNuxieDeliveryPolicy::AnyThread());
+}
+
+FNuxieUseFeatureAndWaitAwaitable::FNuxieUseFeatureAndWaitAwaitable(
+  UNuxieSubsystem* InSubsystem,
+  FString InFeatureId,
+  float InAmount,
+  FString InEntityId,
+  bool bInSetUsage,
+  TMap<FString, FString> InMetadata)
+  : Subsystem(InSubsystem)
+  , FeatureId(MoveTemp(InFeatureId))
+  , Amount(InAmount)
+  , EntityId(MoveTemp(InEntityId))
+  , bSetUsage(bInSetUsage)
+  , Metadata(MoveTemp(InMetadata))
+{
+}
+
+void FNuxieUseFeatureAndWaitAwaitable::Start(TNuxieAsyncResult<FNuxieFeatureUsageResult>& OutResult, FNuxieAwaitSlot& Slot)
+{
+  UNuxieSubsystem* Target = Subsystem.Get();
+  if (Target == nullptr)
+  {
+    CompleteUnavailable(OutResult, Slot);
+    return;
+  }
+
+  Target->UseFeatureAndWaitAsync(
+    FeatureId,
+    Amount,
+    EntityId,
+    bSetUsage,
+    Metadata,
+    MakeValueSink(OutResult, Slot),
+    MakeErrorSink(OutResult, Slot),
+    FNuxieDeliveryPolicy::AnyThread());
+}
+
+FNuxieFlushEventsAwaitable::FNuxieFlushEventsAwaitable(UNuxieSubsystem* InSubsystem)
+  : Subsystem(InSubsystem)
+{
+}
+
+void FNuxieFlushEventsAwaitable::Start(TNuxieAsyncResult<bool>& OutResult, FNuxieAwaitSlot& Slot)
+{
+  UNuxieSubsystem* Target = Subsystem.Get();
+  if (Target == nullptr)
+  {
+    CompleteUnavailable(OutResult, Slot);
+    return;
+  }
+
+  Target->FlushEventsAsync(
+    [&OutResult, Ref = FNuxieAwaitSinkRef(Slot)](bool bFlushed)
+    {
+      OutResult.Value = bFlushed;
+      Ref.Complete();
+    },
+    MakeErrorSink(OutResult, Slot),
+    FNuxieDeliveryPolicy::AnyThread());
+}
+
+FNuxieQueuedEventCountAwaitable::FNuxieQueuedEventCountAwaitable(UNuxieSubsystem* InSubsystem)
+  : Subsystem(InSubsystem)
+{
+}
+
+void FNuxieQueuedEventCountAwaitable::Start(TNuxieAsyncResult<int32>& OutResult, FNuxieAwaitSlot& Slot)
+{
+  UNuxieSubsystem* Target = Subsystem.Get();
+  if (Target == nullptr)
+  {
+    CompleteUnavailable(OutResult, Slot);
+    return;
+  }
+
+  Target->GetQueuedEventCountAsync(
+    [&OutResult, Ref = FNuxieAwaitSinkRef(Slot)](int32 Count)
+    {
+      OutResult.Value = Count;
+      Ref.Complete();
+    },
+    MakeErrorSink(OutResult, Slot),
+    FNuxieDeliveryPolicy::AnyThread());
+}
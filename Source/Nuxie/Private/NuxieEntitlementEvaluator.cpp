@@ -0,0 +1,253 @@
+#include "NuxieEntitlementEvaluator.h"
+
+#include "Algo/BinarySearch.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+namespace
+{
+  bool IsBefore(const FNuxieName& A, const FNuxieName& B)
+  {
+    return A.FastLess(B);
+  }
+
+  bool IsBefore(const FNuxieName& FeatureA, const FNuxieName& EntityA, const FNuxieName& FeatureB, const FNuxieName& EntityB)
+  {
+    if (FeatureA != FeatureB)
+    {
+      return FeatureA.FastLess(FeatureB);
+    }
+    return EntityA.FastLess(EntityB);
+  }
+
+  ENuxieFeatureType ParseFeatureType(const FString& Type)
+  {
+    if (Type == TEXT("metered"))
+    {
+      return ENuxieFeatureType::Metered;
+    }
+    if (Type == TEXT("creditSystem") || Type == TEXT("credit_system"))
+    {
+      return ENuxieFeatureType::CreditSystem;
+    }
+    return ENuxieFeatureType::Boolean;
+  }
+
+  FNuxieEntitlementEvaluator::FFeatureRow ParseRow(const FJsonObject& Object, ENuxieFeatureType Type)
+  {
+    FNuxieEntitlementEvaluator::FFeatureRow Row;
+    Row.Type = Type;
+    // A balance feature with no balance and no explicit grant is not usable. A profile grant
+    // answers the default requirement of one.
+    Row.bGranted = Type == ENuxieFeatureType::Boolean;
+    Object.TryGetBoolField(TEXT("granted"), Row.bGranted);
+    Object.TryGetBoolField(TEXT("unlimited"), Row.bUnlimited);
+    Row.bHasBalance = Object.TryGetNumberField(TEXT("balance"), Row.Balance);
+    return Row;
+  }
+}
+
+FNuxieEntitlementEvaluator::FFeatureRow FNuxieEntitlementEvaluator::MakeRow(const FNuxieFeatureAccess& Access, int32 RequiredBalance)
+{
+  FFeatureRow Row;
+  Row.Type = Access.Type;
+  Row.bGranted = Access.bAllowed;
+  Row.bUnlimited = Access.bUnlimited;
+  Row.bHasBalance = Access.bHasBalance;
+  Row.Balance = Access.Balance;
+  Row.GrantedFor = RequiredBalance;
+  return Row;
+}
+
+bool FNuxieEntitlementEvaluator::EvaluateRow(const FFeatureRow& Row, int32 RequiredBalance, FNuxieFeatureAccess& OutAccess)
+{
+  bool bAllowed = false;
+  if (Row.Type == ENuxieFeatureType::Boolean)
+  {
+    bAllowed = Row.bGranted;
+  }
+  else if (Row.bUnlimited || Row.bHasBalance)
+  {
+    bAllowed = Row.bUnlimited || Row.Balance >= RequiredBalance;
+  }
+  else
+  {
+    // The native SDK can answer a metered feature without reporting a balance. A grant for some
+    // requirement also covers smaller ones, and a denial covers larger ones; anything else is
+    // unknown until the SDK is asked.
+    if (Row.bGranted ? RequiredBalance > Row.GrantedFor : RequiredBalance < Row.GrantedFor)
+    {
+      return false;
+    }
+    bAllowed = Row.bGranted;
+  }
+
+  OutAccess = FNuxieFeatureAccess();
+  OutAccess.Type = Row.Type;
+  OutAccess.bAllowed = bAllowed;
+  OutAccess.bUnlimited = Row.bUnlimited;
+  OutAccess.bHasBalance = Row.bHasBalance;
+  OutAccess.Balance = Row.Balance;
+  return true;
+}
+
+bool FNuxieEntitlementEvaluator::Evaluate(const FNuxieName& FeatureId, int32 RequiredBalance, const FNuxieName& EntityId, FNuxieFeatureAccess& OutAccess) const
+{
+  const int32 FeatureIndex = FindFeatureIndex(FeatureId);
+  if (FeatureIndex != INDEX_NONE)
+  {
+    const FFeatureRow& FeatureRow = FeatureRows[FeatureIndex];
+    if (EntityId.IsNone() || FeatureRow.Type == ENuxieFeatureType::Boolean || FeatureRow.bUnlimited)
+    {
+      return EvaluateRow(FeatureRow, RequiredBalance, OutAccess);
+    }
+  }
+
+  if (EntityId.IsNone())
+  {
+    return false;
+  }
+
+  // Balances are tracked per entity, so the feature-level balance says nothing about this entity.
+  const int32 EntityIndex = FindEntityIndex(FeatureId, EntityId);
+  if (EntityIndex == INDEX_NONE)
+  {
+    return false;
+  }
+
+  return EvaluateRow(EntityRows[EntityIndex].Row, RequiredBalance, OutAccess);
+}
+
+void FNuxieEntitlementEvaluator::Record(const FNuxieName& FeatureId, int32 RequiredBalance, const FNuxieName& EntityId, const FNuxieFeatureAccess& Access)
+{
+  if (FeatureId.IsNone())
+  {
+    return;
+  }
+
+  if (EntityId.IsNone())
+  {
+    Upsert(FeatureId, MakeRow(Access, RequiredBalance));
+  }
+  else
+  {
+    UpsertEntity(FeatureId, EntityId, MakeRow(Access, RequiredBalance));
+  }
+}
+
+bool FNuxieEntitlementEvaluator::LoadProfileJson(const FString& RawJson)
+{
+  TSharedPtr<FJsonObject> Root;
+  const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(RawJson);
+  if (!FJsonSerializer::Deserialize(Reader, Root) || !Root.IsValid())
+  {
+    return false;
+  }
+
+  const TArray<TSharedPtr<FJsonValue>>* Features = nullptr;
+  if (!Root->TryGetArrayField(TEXT("features"), Features))
+  {
+    return false;
+  }
+
+  Reset();
+  for (const TSharedPtr<FJsonValue>& Value : *Features)
+  {
+    const TSharedPtr<FJsonObject>* Feature = nullptr;
+    FString Id;
+    if (!Value.IsValid() || !Value->TryGetObject(Feature) || !(*Feature)->TryGetStringField(TEXT("id"), Id) || Id.IsEmpty())
+    {
+      continue;
+    }
+
+    FString TypeName;
+    (*Feature)->TryGetStringField(TEXT("type"), TypeName);
+    const ENuxieFeatureType Type = ParseFeatureType(TypeName);
+    const FNuxieName FeatureName(Id);
+    Upsert(FeatureName, ParseRow(**Feature, Type));
+
+    const TSharedPtr<FJsonObject>* Entities = nullptr;
+    if ((*Feature)->TryGetObjectField(TEXT("entities"), Entities))
+    {
+      for (const TPair<FString, TSharedPtr<FJsonValue>>& Entity : (*Entities)->Values)
+      {
+        const TSharedPtr<FJsonObject>* EntityObject = nullptr;
+        if (Entity.Value.IsValid() && Entity.Value->TryGetObject(EntityObject))
+        {
+          UpsertEntity(FeatureName, FNuxieName(Entity.Key), ParseRow(**EntityObject, Type));
+        }
+      }
+    }
+  }
+  return true;
+}
+
+void FNuxieEntitlementEvaluator::Reset()
+{
+  FeatureIds.Reset();
+  FeatureRows.Reset();
+  EntityRows.Reset();
+}
+
+int32 FNuxieEntitlementEvaluator::Num() const
+{
+  return FeatureIds.Num();
+}
+
+int32 FNuxieEntitlementEvaluator::FindFeatureIndex(const FNuxieName& FeatureId) const
+{
+  const int32 Index = Algo::LowerBound(FeatureIds, FeatureId, [](const FNuxieName& A, const FNuxieName& B) { return IsBefore(A, B); });
+  return FeatureIds.IsValidIndex(Index) && FeatureIds[Index] == FeatureId ? Index : INDEX_NONE;
+}
+
+int32 FNuxieEntitlementEvaluator::FindEntityIndex(const FNuxieName& FeatureId, const FNuxieName& EntityId) const
+{
+  const int32 Index = Algo::LowerBoundBy(
+    EntityRows,
+    TPair<FNuxieName, FNuxieName>(FeatureId, EntityId),
+    [](const FEntityRow& Row) { return TPair<FNuxieName, FNuxieName>(Row.FeatureId, Row.EntityId); },
+    [](const TPair<FNuxieName, FNuxieName>& A, const TPair<FNuxieName, FNuxieName>& B) { return IsBefore(A.Key, A.Value, B.Key, B.Value); });
+
+  if (!EntityRows.IsValidIndex(Index))
+  {
+    return INDEX_NONE;
+  }
+
+  const FEntityRow& Row = EntityRows[Index];
+  return Row.FeatureId == FeatureId && Row.EntityId == EntityId ? Index : INDEX_NONE;
+}
+
+void FNuxieEntitlementEvaluator::Upsert(const FNuxieName& FeatureId, const FFeatureRow& Row)
+{
+  const int32 Index = Algo::LowerBound(FeatureIds, FeatureId, [](const FNuxieName& A, const FNuxieName& B) { return IsBefore(A, B); });
+  if (FeatureIds.IsValidIndex(Index) && FeatureIds[Index] == FeatureId)
+  {
+    FeatureRows[Index] = Row;
+    return;
+  }
+
+  FeatureIds.Insert(FeatureId, Index);
+  FeatureRows.Insert(Row, Index);
+}
+
+void FNuxieEntitlementEvaluator::UpsertEntity(const FNuxieName& FeatureId, const FNuxieName& EntityId, const FFeatureRow& Row)
+{
+  const int32 Existing = FindEntityIndex(FeatureId, EntityId);
+  if (Existing != INDEX_NONE)
+  {
+    EntityRows[Existing].Row = Row;
+    return;
+  }
+
+  const int32 Index = Algo::LowerBoundBy(
+    EntityRows,
+    TPair<FNuxieName, FNuxieName>(FeatureId, EntityId),
+    [](const FEntityRow& Entry) { return TPair<FNuxieName, FNuxieName>(Entry.FeatureId, Entry.EntityId); },
+    [](const TPair<FNuxieName, FNuxieName>& A, const TPair<FNuxieName, FNuxieName>& B) { return IsBefore(A.Key, A.Value, B.Key, B.Value); });
+
+  FEntityRow& Entry = EntityRows.InsertDefaulted_GetRef(Index);
+  Entry.FeatureId = FeatureId;
+  Entry.EntityId = EntityId;
+  Entry.Row = Row;
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "NuxieName.h"
+#include "NuxieTypes.h"
+
+/**
+ * Answers HasFeature locally from feature state the SDK has already downloaded or reported.
+ *
+ * Rows live in flat arrays sorted by FNuxieName, so a lookup is a binary search over integers
+ * with no string hashing or bridge crossing. scripts/test-feature-access-contract.mjs mirrors the
+ * rules for the hand-written cases in tests/fixtures/feature_access_cases.json, and the
+ * Nuxie.Evaluator.FixtureCases automation test runs the same cases through this class. Change
+ * the script together with the rules.
+ * Game thread only.
+ */
+class FNuxieEntitlementEvaluator
+{
+public:
+  struct FFeatureRow
+  {
+    ENuxieFeatureType Type = ENuxieFeatureType::Boolean;
+    bool bGranted = false;
+    bool bUnlimited = false;
+    bool bHasBalance = false;
+    int32 Balance = 0;
+
+    /** The RequiredBalance bGranted answered, for balance features whose balance is not known. */
+    int32 GrantedFor = 1;
+  };
+
+  /** RequiredBalance is the requirement Access was answered for; pushed changes answer 1. */
+  static FFeatureRow MakeRow(const FNuxieFeatureAccess& Access, int32 RequiredBalance);
+
+  /**
+   * Returns false when the row cannot answer RequiredBalance: a balance feature without a balance
+   * whose grant was for a requirement that does not bound this one.
+   */
+  static bool EvaluateRow(const FFeatureRow& Row, int32 RequiredBalance, FNuxieFeatureAccess& OutAccess);
+
+  /**
+   * Returns false when the feature (or, for balance features, the entity) is unknown locally and
+   * the caller has to ask the native SDK.
+   */
+  bool Evaluate(const FNuxieName& FeatureId, int32 RequiredBalance, const FNuxieName& EntityId, FNuxieFeatureAccess& OutAccess) const;
+
+  /**
+   * Records an authoritative answer for RequiredBalance. A None EntityId targets the feature itself
+   * rather than an entity.
+   */
+  void Record(const FNuxieName& FeatureId, int32 RequiredBalance, const FNuxieName& EntityId, const FNuxieFeatureAccess& Access);
+
+  /**
+   * Rebuilds the table from a profile JSON object with a `features` array of
+   * `{ id, type, granted?, unlimited?, balance?, entities?: { <entityId>: { balance } } }`.
+   * Returns false (leaving the table untouched) when RawJson has no such array.
+   */
+  bool LoadProfileJson(const FString& RawJson);
+
+  void Reset();
+  int32 Num() const;
+
+private:
+  struct FEntityRow
+  {
+    FNuxieName FeatureId;
+    FNuxieName EntityId;
+    FFeatureRow Row;
+  };
+
+  int32 FindFeatureIndex(const FNuxieName& FeatureId) const;
+  int32 FindEntityIndex(const FNuxieName& FeatureId, const FNuxieName& EntityId) const;
+  void Upsert(const FNuxieName& FeatureId, const FFeatureRow& Row);
+  void UpsertEntity(const FNuxieName& FeatureId, const FNuxieName& EntityId, const FFeatureRow& Row);
+
+  TArray<FNuxieName> FeatureIds;
+  TArray<FFeatureRow> FeatureRows;
+  TArray<FEntityRow> EntityRows;
+};
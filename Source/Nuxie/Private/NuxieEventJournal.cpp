@@ -0,0 +1,392 @@
+#include "NuxieEventJournal.h"
+
+#include "Async/MappedFileHandle.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "NuxieStats.h"
+
+DECLARE_CYCLE_STAT(TEXT("Journal Append"), STAT_NuxieJournalAppend, STATGROUP_Nuxie);
+DECLARE_CYCLE_STAT(TEXT("Journal Recover"), STAT_NuxieJournalRecover, STATGROUP_Nuxie);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Journal Records"), STAT_NuxieJournalRecords, STATGROUP_Nuxie);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Journal Records Dropped"), STAT_NuxieJournalDropped, STATGROUP_Nuxie);
+
+namespace
+{
+  // Segment files start with this magic; records follow as [size][crc32][payload]. Fields are in
+  // native byte order, since a journal is only ever read back on the machine that wrote it.
+  constexpr uint32 SegmentMagic = 0x314A584E; // "NXJ1"
+  constexpr uint8 UseFeatureRecordKind = 1;
+  constexpr int32 FrameHeaderSize = 2 * sizeof(uint32);
+
+  void WriteRaw(TArray<uint8>& Out, const void* Data, int32 Size)
+  {
+    Out.Append(static_cast<const uint8*>(Data), Size);
+  }
+
+  void WriteUInt32(TArray<uint8>& Out, uint32 Value)
+  {
+    WriteRaw(Out, &Value, sizeof(Value));
+  }
+
+  void WriteString(TArray<uint8>& Out, const FString& Value)
+  {
+    const FTCHARToUTF8 Utf8(*Value);
+    WriteUInt32(Out, static_cast<uint32>(Utf8.Length()));
+    WriteRaw(Out, Utf8.Get(), Utf8.Length());
+  }
+
+  struct FRecordReader
+  {
+    const uint8* Data = nullptr;
+    int64 Size = 0;
+    int64 Offset = 0;
+
+    bool ReadRaw(void* Out, int64 Count)
+    {
+      if (Count > Size - Offset)
+      {
+        return false;
+      }
+      FMemory::Memcpy(Out, Data + Offset, Count);
+      Offset += Count;
+      return true;
+    }
+
+    bool ReadUInt32(uint32& Out)
+    {
+      return ReadRaw(&Out, sizeof(Out));
+    }
+
+    bool ReadString(FString& Out)
+    {
+      uint32 Length = 0;
+      if (!ReadUInt32(Length) || Length > Size - Offset)
+      {
+        return false;
+      }
+
+      const FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Data + Offset), Length);
+      Out.Reset(Converted.Length());
+      Out.AppendChars(Converted.Get(), Converted.Length());
+      Offset += Length;
+      return true;
+    }
+  };
+
+  bool DecodeUseFeature(FRecordReader& Reader, FNuxieEventJournal::FUseFeatureRecord& OutRecord)
+  {
+    uint8 Kind = 0;
+    uint32 NumMetadata = 0;
+    if (!Reader.ReadRaw(&Kind, sizeof(Kind))
+      || Kind != UseFeatureRecordKind
+      || !Reader.ReadString(OutRecord.FeatureId)
+      || !Reader.ReadRaw(&OutRecord.Amount, sizeof(OutRecord.Amount))
+      || !Reader.ReadString(OutRecord.EntityId)
+      || !Reader.ReadUInt32(NumMetadata))
+    {
+      return false;
+    }
+
+    for (uint32 Index = 0; Index < NumMetadata; ++Index)
+    {
+      FString Key;
+      FString Value;
+      if (!Reader.ReadString(Key) || !Reader.ReadString(Value))
+      {
+        return false;
+      }
+      OutRecord.Metadata.Add(MoveTemp(Key), MoveTemp(Value));
+    }
+    return true;
+  }
+}
+
+FNuxieEventJournal::FNuxieEventJournal(FString InDirectory)
+  : Directory(MoveTemp(InDirectory))
+{
+}
+
+FNuxieEventJournal::~FNuxieEventJournal()
+{
+  Close();
+}
+
+void FNuxieEventJournal::Open(int32 InMaxRecords)
+{
+  SCOPE_CYCLE_COUNTER(STAT_NuxieJournalRecover);
+
+  IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+  PlatformFile.CreateDirectoryTree(*Directory);
+
+  TArray<int64> Indices;
+  PlatformFile.IterateDirectory(*Directory, [&Indices](const TCHAR* Path, bool bIsDirectory)
+  {
+    const FString Name = FPaths::GetBaseFilename(Path);
+    if (!bIsDirectory && FPaths::GetExtension(Path) == TEXT("seg") && Name.IsNumeric())
+    {
+      Indices.Add(FCString::Atoi64(*Name));
+    }
+    return true;
+  });
+  Indices.Sort();
+
+  FScopeLock Lock(&Mutex);
+  if (bOpen)
+  {
+    return;
+  }
+
+  bOpen = true;
+  MaxRecords = FMath::Max(InMaxRecords, 1);
+  NextSegmentIndex = Indices.Num() > 0 ? Indices.Last() + 1 : 0;
+  for (const int64 Index : Indices)
+  {
+    int32 SegmentRecords = 0;
+    if (!ReadSegment(GetSegmentPath(Index), Recovered, SegmentRecords) || SegmentRecords == 0)
+    {
+      PlatformFile.DeleteFile(*GetSegmentPath(Index));
+      continue;
+    }
+    Segments.Add({ Index, SegmentRecords });
+    NumRecords += SegmentRecords;
+  }
+
+  // The newest records win, as in the native queue.
+  while (NumRecords > MaxRecords && Segments.Num() > 0)
+  {
+    const int32 SegmentRecords = Segments[0].NumRecords;
+    Recovered.RemoveAt(0, SegmentRecords);
+    NumDropped += SegmentRecords;
+    INC_DWORD_STAT_BY(STAT_NuxieJournalDropped, SegmentRecords);
+    DeleteSegmentLocked(0);
+  }
+  SET_DWORD_STAT(STAT_NuxieJournalRecords, NumRecords);
+}
+
+bool FNuxieEventJournal::IsOpen() const
+{
+  FScopeLock Lock(&Mutex);
+  return bOpen;
+}
+
+void FNuxieEventJournal::Close()
+{
+  FScopeLock Lock(&Mutex);
+  CloseActiveLocked(true);
+  bOpen = false;
+  NumRecords = 0;
+  Segments.Reset();
+  Recovered.Reset();
+}
+
+void FNuxieEventJournal::SetMaxRecords(int32 InMaxRecords)
+{
+  FScopeLock Lock(&Mutex);
+  MaxRecords = FMath::Max(InMaxRecords, 1);
+  EnforceCapacityLocked();
+}
+
+void FNuxieEventJournal::AppendUseFeature(const FString& FeatureId, float Amount, const FString& EntityId, const TMap<FString, FString>& Metadata)
+{
+  SCOPE_CYCLE_COUNTER(STAT_NuxieJournalAppend);
+  if (!IsOpen())
+  {
+    return;
+  }
+
+  // Encoded outside the lock; the frame is then written with a single call so a kill can tear
+  // only the last record, which the CRC catches on recovery.
+  TArray<uint8> Frame;
+  Frame.Reserve(128);
+  Frame.AddZeroed(FrameHeaderSize);
+  Frame.Add(UseFeatureRecordKind);
+  WriteString(Frame, FeatureId);
+  WriteRaw(Frame, &Amount, sizeof(Amount));
+  WriteString(Frame, EntityId);
+  WriteUInt32(Frame, static_cast<uint32>(Metadata.Num()));
+  for (const TPair<FString, FString>& Pair : Metadata)
+  {
+    WriteString(Frame, Pair.Key);
+    WriteString(Frame, Pair.Value);
+  }
+
+  const uint32 PayloadSize = static_cast<uint32>(Frame.Num() - FrameHeaderSize);
+  const uint32 Crc = FCrc::MemCrc32(Frame.GetData() + FrameHeaderSize, PayloadSize);
+  FMemory::Memcpy(Frame.GetData(), &PayloadSize, sizeof(PayloadSize));
+  FMemory::Memcpy(Frame.GetData() + sizeof(PayloadSize), &Crc, sizeof(Crc));
+
+  FScopeLock Lock(&Mutex);
+  if (!bOpen)
+  {
+    return;
+  }
+
+  if (ActiveHandle.IsValid() && Segments.Last().NumRecords >= GetSegmentCapacity())
+  {
+    CloseActiveLocked(false);
+  }
+
+  if (!ActiveHandle.IsValid())
+  {
+    const int64 Index = NextSegmentIndex++;
+    ActiveHandle.Reset(FPlatformFileManager::Get().GetPlatformFile().OpenWrite(*GetSegmentPath(Index)));
+    if (!ActiveHandle.IsValid() || !ActiveHandle->Write(reinterpret_cast<const uint8*>(&SegmentMagic), sizeof(SegmentMagic)))
+    {
+      ActiveHandle.Reset();
+      return;
+    }
+    Segments.Add({ Index, 0 });
+  }
+
+  // No Flush: the write reaches the OS page cache, which outlives the process.
+  if (!ActiveHandle->Write(Frame.GetData(), Frame.Num()))
+  {
+    return;
+  }
+
+  ++Segments.Last().NumRecords;
+  ++NumRecords;
+  EnforceCapacityLocked();
+  SET_DWORD_STAT(STAT_NuxieJournalRecords, NumRecords);
+}
+
+void FNuxieEventJournal::TakeRecovered(TArray<FUseFeatureRecord>& OutRecords)
+{
+  FScopeLock Lock(&Mutex);
+  OutRecords = MoveTemp(Recovered);
+  Recovered.Reset();
+}
+
+int64 FNuxieEventJournal::Seal()
+{
+  FScopeLock Lock(&Mutex);
+  CloseActiveLocked(false);
+  return Segments.Num() > 0 ? Segments.Last().Index : INDEX_NONE;
+}
+
+void FNuxieEventJournal::Acknowledge(int64 Mark)
+{
+  FScopeLock Lock(&Mutex);
+
+  // Segments created after the mark have higher indices, so the active one is never removed here.
+  while (Segments.Num() > 0 && Segments[0].Index <= Mark)
+  {
+    DeleteSegmentLocked(0);
+  }
+  SET_DWORD_STAT(STAT_NuxieJournalRecords, NumRecords);
+}
+
+int32 FNuxieEventJournal::Num() const
+{
+  FScopeLock Lock(&Mutex);
+  return NumRecords;
+}
+
+int64 FNuxieEventJournal::GetDroppedCount() const
+{
+  FScopeLock Lock(&Mutex);
+  return NumDropped;
+}
+
+FString FNuxieEventJournal::GetSegmentPath(int64 Index) const
+{
+  return Directory / FString::Printf(TEXT("%010lld.seg"), Index);
+}
+
+bool FNuxieEventJournal::ReadSegment(const FString& Path, TArray<FUseFeatureRecord>& OutRecords, int32& OutNumRecords) const
+{
+  // Mapping avoids copying the segment; platforms without mapped files read it into memory.
+  IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+  TUniquePtr<IMappedFileHandle> MappedFile(PlatformFile.OpenMapped(*Path));
+  TUniquePtr<IMappedFileRegion> MappedRegion(MappedFile.IsValid() && MappedFile->GetFileSize() > 0 ? MappedFile->MapRegion() : nullptr);
+
+  TArray<uint8> Buffer;
+  FRecordReader Reader;
+  if (MappedRegion.IsValid())
+  {
+    Reader.Data = MappedRegion->GetMappedPtr();
+    Reader.Size = MappedRegion->GetMappedSize();
+  }
+  else
+  {
+    if (!FFileHelper::LoadFileToArray(Buffer, *Path, FILEREAD_Silent))
+    {
+      return false;
+    }
+    Reader.Data = Buffer.GetData();
+    Reader.Size = Buffer.Num();
+  }
+
+  uint32 Magic = 0;
+  if (!Reader.ReadUInt32(Magic) || Magic != SegmentMagic)
+  {
+    return false;
+  }
+
+  OutNumRecords = 0;
+  uint32 PayloadSize = 0;
+  uint32 Crc = 0;
+  while (Reader.ReadUInt32(PayloadSize) && Reader.ReadUInt32(Crc))
+  {
+    if (PayloadSize > Reader.Size - Reader.Offset || FCrc::MemCrc32(Reader.Data + Reader.Offset, PayloadSize) != Crc)
+    {
+      // Torn tail from a kill mid-write; nothing after it was ever acknowledged by a write call.
+      break;
+    }
+
+    FRecordReader Payload { Reader.Data + Reader.Offset, PayloadSize, 0 };
+    Reader.Offset += PayloadSize;
+
+    FUseFeatureRecord Record;
+    if (DecodeUseFeature(Payload, Record))
+    {
+      OutRecords.Add(MoveTemp(Record));
+      ++OutNumRecords;
+    }
+  }
+  return true;
+}
+
+void FNuxieEventJournal::CloseActiveLocked(bool bSync)
+{
+  if (!ActiveHandle.IsValid())
+  {
+    return;
+  }
+
+  if (bSync)
+  {
+    ActiveHandle->Flush(true);
+  }
+  ActiveHandle.Reset();
+}
+
+void FNuxieEventJournal::DeleteSegmentLocked(int32 SegmentSlot)
+{
+  const FSegment Segment = Segments[SegmentSlot];
+  if (ActiveHandle.IsValid() && SegmentSlot == Segments.Num() - 1)
+  {
+    ActiveHandle.Reset();
+  }
+
+  NumRecords -= Segment.NumRecords;
+  Segments.RemoveAt(SegmentSlot);
+  FPlatformFileManager::Get().GetPlatformFile().DeleteFile(*GetSegmentPath(Segment.Index));
+}
+
+void FNuxieEventJournal::EnforceCapacityLocked()
+{
+  // Whole segments go at once, so after a drop the journal may hold up to one segment under the cap.
+  while (NumRecords > MaxRecords && Segments.Num() > 1)
+  {
+    NumDropped += Segments[0].NumRecords;
+    INC_DWORD_STAT_BY(STAT_NuxieJournalDropped, Segments[0].NumRecords);
+    DeleteSegmentLocked(0);
+  }
+}
+
+int32 FNuxieEventJournal::GetSegmentCapacity() const
+{
+  return FMath::Clamp(MaxRecords / 8, 16, 1024);
+}
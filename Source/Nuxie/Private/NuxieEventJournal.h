@@ -0,0 +1,81 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "HAL/CriticalSection.h"
+
+class IFileHandle;
+
+/**
+ * Crash-safe journal of UseFeature calls that reached the bridge but are not yet known to be sent.
+ *
+ * Records go to numbered segment files under Directory, one unbuffered write per record and no
+ * fsync, so they survive the process being killed (not a power loss). A segment is sealed when it
+ * holds SegmentCapacity records and whenever Seal takes a mark; once everything up to the mark is
+ * known to be sent, Acknowledge deletes those segments. Past MaxRecords the oldest segments are dropped, as the native
+ * queue drops its oldest events. Segments left by an earlier process are read once by Open, through
+ * a memory mapping where the platform has one, and handed out by TakeRecovered. Thread-safe.
+ */
+class FNuxieEventJournal
+{
+public:
+  struct FUseFeatureRecord
+  {
+    FString FeatureId;
+    float Amount = 0.0f;
+    FString EntityId;
+    TMap<FString, FString> Metadata;
+  };
+
+  explicit FNuxieEventJournal(FString InDirectory);
+  ~FNuxieEventJournal();
+
+  /** Reads the segments already in Directory and starts appending to a new one. */
+  void Open(int32 InMaxRecords);
+  bool IsOpen() const;
+
+  /** Syncs the active segment to disk and closes it. Records stay on disk for the next Open. */
+  void Close();
+
+  void SetMaxRecords(int32 InMaxRecords);
+
+  void AppendUseFeature(const FString& FeatureId, float Amount, const FString& EntityId, const TMap<FString, FString>& Metadata);
+
+  /** Records read by Open, oldest first. Each segment stops at its first torn or corrupt record. */
+  void TakeRecovered(TArray<FUseFeatureRecord>& OutRecords);
+
+  /** Seals the active segment and returns a mark covering every record appended so far. */
+  int64 Seal();
+
+  /** Deletes the segments covered by a mark from Seal, once their records are known to be sent. */
+  void Acknowledge(int64 Mark);
+
+  int32 Num() const;
+  int64 GetDroppedCount() const;
+
+private:
+  struct FSegment
+  {
+    int64 Index = 0;
+    int32 NumRecords = 0;
+  };
+
+  FString GetSegmentPath(int64 Index) const;
+  bool ReadSegment(const FString& Path, TArray<FUseFeatureRecord>& OutRecords, int32& OutNumRecords) const;
+  void CloseActiveLocked(bool bSync);
+  void DeleteSegmentLocked(int32 SegmentSlot);
+  void EnforceCapacityLocked();
+  int32 GetSegmentCapacity() const;
+
+  FString Directory;
+
+  mutable FCriticalSection Mutex;
+  bool bOpen = false;
+  int32 MaxRecords = 1000;
+  int32 NumRecords = 0;
+  int64 NumDropped = 0;
+  int64 NextSegmentIndex = 0;
+  TArray<FSegment> Segments;
+  TUniquePtr<IFileHandle> ActiveHandle;
+  TArray<FUseFeatureRecord> Recovered;
+};
@@ -0,0 +1,77 @@
+#include "NuxieFeatureAccessBatcher.h"
+
+#include "Async/Async.h"
+#include "Misc/ScopeLock.h"
+
+void FNuxieFeatureAccessBatcher::SetListener(INuxiePlatformBridgeListener* InListener)
+{
+  FScopeLock Lock(&Mutex);
+  Listener = InListener;
+  if (Listener == nullptr)
+  {
+    Pending.Reset();
+  }
+}
+
+void FNuxieFeatureAccessBatcher::Enqueue(const FString& FeatureId, const FNuxieFeatureAccess& Previous, const FNuxieFeatureAccess& Current)
+{
+  {
+    FScopeLock Lock(&Mutex);
+    if (Listener == nullptr)
+    {
+      return;
+    }
+
+    FNuxieFeatureAccessChange* Existing = Pending.FindByPredicate([&FeatureId](const FNuxieFeatureAccessChange& Change)
+    {
+      return Change.FeatureId == FeatureId;
+    });
+
+    if (Existing != nullptr)
+    {
+      Existing->Current = Current;
+    }
+    else
+    {
+      FNuxieFeatureAccessChange& Change = Pending.AddDefaulted_GetRef();
+      Change.FeatureId = FeatureId;
+      Change.Previous = Previous;
+      Change.Current = Current;
+    }
+
+    if (bFlushScheduled)
+    {
+      return;
+    }
+    bFlushScheduled = true;
+  }
+
+  // Always defer, even on the game thread, so changes reported back-to-back share one batch.
+  AsyncTask(ENamedThreads::GameThread, [WeakThis = AsWeak()]()
+  {
+    if (const TSharedPtr<FNuxieFeatureAccessBatcher, ESPMode::ThreadSafe> This = WeakThis.Pin())
+    {
+      This->Flush();
+    }
+  });
+}
+
+void FNuxieFeatureAccessBatcher::Flush()
+{
+  check(IsInGameThread());
+
+  TArray<FNuxieFeatureAccessChange> Changes;
+  INuxiePlatformBridgeListener* LocalListener = nullptr;
+  {
+    FScopeLock Lock(&Mutex);
+    Changes = MoveTemp(Pending);
+    Pending.Reset();
+    bFlushScheduled = false;
+    LocalListener = Listener;
+  }
+
+  if (LocalListener != nullptr && Changes.Num() > 0)
+  {
+    LocalListener->OnFeatureAccessBatchChanged(Changes);
+  }
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "HAL/CriticalSection.h"
+#include "NuxiePlatformBridge.h"
+#include "Templates/SharedPointer.h"
+
+/**
+ * Collects feature-access changes reported by a bridge from any thread and hands them to the
+ * listener as one batch on the next game-thread pump. A feature that flips more than once in the
+ * same window is reported once, from its first previous state to its latest state.
+ */
+class FNuxieFeatureAccessBatcher final : public TSharedFromThis<FNuxieFeatureAccessBatcher, ESPMode::ThreadSafe>
+{
+public:
+  void SetListener(INuxiePlatformBridgeListener* InListener);
+  void Enqueue(const FString& FeatureId, const FNuxieFeatureAccess& Previous, const FNuxieFeatureAccess& Current);
+
+  /** Delivers whatever is pending. Game thread only. */
+  void Flush();
+
+private:
+  FCriticalSection Mutex;
+  INuxiePlatformBridgeListener* Listener = nullptr;
+  TArray<FNuxieFeatureAccessChange> Pending;
+  bool bFlushScheduled = false;
+};
@@ -0,0 +1,189 @@
+#include "NuxieFeatureCheckCache.h"
+
+#include "HAL/PlatformTime.h"
+#include "Misc/ScopeLock.h"
+#include "NuxieEntitlementEvaluator.h"
+
+FNuxieFeatureCheckCache::FKey FNuxieFeatureCheckCache::MakeKey(const FString& FeatureId, int32 RequiredBalance, const FString& EntityId)
+{
+  FKey Key;
+  Key.FeatureId = FNuxieName(FeatureId);
+  Key.EntityId = FNuxieName::FromOptional(EntityId);
+  Key.RequiredBalance = RequiredBalance;
+  return Key;
+}
+
+bool FNuxieFeatureCheckCache::FindKey(const FString& FeatureId, int32 RequiredBalance, const FString& EntityId, FKey& OutKey)
+{
+  OutKey.FeatureId = FNuxieName(FeatureId, FNAME_Find);
+  OutKey.EntityId = FNuxieName::FromOptional(EntityId, FNAME_Find);
+  OutKey.RequiredBalance = RequiredBalance;
+  return !OutKey.FeatureId.IsNone() && (EntityId.IsEmpty() || !OutKey.EntityId.IsNone());
+}
+
+FNuxieFeatureCheckCache::ELookup FNuxieFeatureCheckCache::Find(
+  const FString& FeatureId,
+  int32 RequiredBalance,
+  const FString& EntityId,
+  const FNuxieFeatureCachePolicy& Policy,
+  FNuxieFeatureCheckResult& OutResult) const
+{
+  FKey Key;
+  if (!FindKey(FeatureId, RequiredBalance, EntityId, Key))
+  {
+    return ELookup::Miss;
+  }
+
+  FScopeLock Lock(&Mutex);
+  const FEntry* Entry = Entries.Find(Key);
+  if (Entry == nullptr)
+  {
+    return ELookup::Miss;
+  }
+
+  const double AgeSeconds = FPlatformTime::Seconds() - Entry->StoredAtSeconds;
+  if (AgeSeconds <= Policy.MaxAgeSeconds)
+  {
+    OutResult = Entry->Result;
+    OutResult.Source = ENuxieFeatureResultSource::Cache;
+    OutResult.AgeSeconds = static_cast<float>(AgeSeconds);
+    return ELookup::Fresh;
+  }
+
+  if (AgeSeconds <= Policy.MaxAgeSeconds + Policy.StaleWhileRevalidateSeconds)
+  {
+    OutResult = Entry->Result;
+    OutResult.Source = ENuxieFeatureResultSource::StaleCache;
+    OutResult.AgeSeconds = static_cast<float>(AgeSeconds);
+    return ELookup::Stale;
+  }
+
+  return ELookup::Expired;
+}
+
+bool FNuxieFeatureCheckCache::Store(
+  const FString& FeatureId,
+  int32 RequiredBalance,
+  const FString& EntityId,
+  const FNuxieFeatureCheckResult& Result,
+  FNuxieFeatureAccess& OutPrevious)
+{
+  const FKey Key = MakeKey(FeatureId, RequiredBalance, EntityId);
+
+  FScopeLock Lock(&Mutex);
+  FEntry* Existing = Entries.Find(Key);
+  const bool bReplaced = Existing != nullptr;
+  if (bReplaced)
+  {
+    OutPrevious = Existing->Result.Access;
+  }
+  else
+  {
+    Existing = &Entries.Add(Key);
+  }
+
+  Existing->Result = Result;
+  Existing->Result.Source = ENuxieFeatureResultSource::Native;
+  Existing->Result.AgeSeconds = 0.0f;
+  Existing->StoredAtSeconds = FPlatformTime::Seconds();
+  return bReplaced;
+}
+
+void FNuxieFeatureCheckCache::ApplyAccessChange(const FString& FeatureId, const FNuxieFeatureAccess& Current)
+{
+  const FNuxieName FeatureName(FeatureId, FNAME_Find);
+  if (FeatureName.IsNone())
+  {
+    return;
+  }
+
+  // Balances are tracked per entity, so a feature-level balance only answers entity-less entries.
+  const bool bBalanceFeature = Current.Type != ENuxieFeatureType::Boolean && !Current.bUnlimited;
+  const FNuxieEntitlementEvaluator::FFeatureRow Row = FNuxieEntitlementEvaluator::MakeRow(Current, 1);
+
+  FScopeLock Lock(&Mutex);
+  const double NowSeconds = FPlatformTime::Seconds();
+  for (auto It = Entries.CreateIterator(); It; ++It)
+  {
+    if (It.Key().FeatureId != FeatureName)
+    {
+      continue;
+    }
+
+    if (bBalanceFeature && (!Current.bHasBalance || !It.Key().EntityId.IsNone()))
+    {
+      It.RemoveCurrent();
+      continue;
+    }
+
+    if (!FNuxieEntitlementEvaluator::EvaluateRow(Row, It.Key().RequiredBalance, It.Value().Result.Access))
+    {
+      It.RemoveCurrent();
+      continue;
+    }
+    It.Value().StoredAtSeconds = NowSeconds;
+  }
+}
+
+bool FNuxieFeatureCheckCache::TryBeginRevalidate(const FString& FeatureId, int32 RequiredBalance, const FString& EntityId)
+{
+  FKey Key;
+  if (!FindKey(FeatureId, RequiredBalance, EntityId, Key))
+  {
+    return false;
+  }
+
+  FScopeLock Lock(&Mutex);
+  FEntry* Entry = Entries.Find(Key);
+  if (Entry == nullptr || Entry->bRevalidating)
+  {
+    return false;
+  }
+
+  Entry->bRevalidating = true;
+  return true;
+}
+
+void FNuxieFeatureCheckCache::EndRevalidate(const FString& FeatureId, int32 RequiredBalance, const FString& EntityId)
+{
+  FKey Key;
+  if (!FindKey(FeatureId, RequiredBalance, EntityId, Key))
+  {
+    return;
+  }
+
+  FScopeLock Lock(&Mutex);
+  if (FEntry* Entry = Entries.Find(Key))
+  {
+    Entry->bRevalidating = false;
+  }
+}
+
+bool FNuxieFeatureCheckCache::TryBeginFetch(const FString& FeatureId, int32 RequiredBalance, const FString& EntityId)
+{
+  const FKey Key = MakeKey(FeatureId, RequiredBalance, EntityId);
+
+  FScopeLock Lock(&Mutex);
+  bool bAlreadyFetching = false;
+  Fetching.Add(Key, &bAlreadyFetching);
+  return !bAlreadyFetching;
+}
+
+void FNuxieFeatureCheckCache::EndFetch(const FString& FeatureId, int32 RequiredBalance, const FString& EntityId)
+{
+  FKey Key;
+  if (!FindKey(FeatureId, RequiredBalance, EntityId, Key))
+  {
+    return;
+  }
+
+  FScopeLock Lock(&Mutex);
+  Fetching.Remove(Key);
+}
+
+void FNuxieFeatureCheckCache::Reset()
+{
+  FScopeLock Lock(&Mutex);
+  Entries.Reset();
+  Fetching.Reset();
+}
@@ -0,0 +1,92 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "HAL/CriticalSection.h"
+#include "NuxieName.h"
+#include "NuxieTypes.h"
+
+/**
+ * Subsystem-side cache of CheckFeatureAsync answers, keyed by feature, entity and required balance.
+ * IDs are interned as FNuxieNames, so lookups hash and compare integers, and match case-sensitively.
+ * Safe to use from any thread.
+ */
+class FNuxieFeatureCheckCache
+{
+public:
+  enum class ELookup : uint8
+  {
+    Miss,
+    Fresh,
+    Stale,
+    Expired
+  };
+
+  /** Fills OutResult (with Source and AgeSeconds) for Fresh and Stale hits. */
+  ELookup Find(
+    const FString& FeatureId,
+    int32 RequiredBalance,
+    const FString& EntityId,
+    const FNuxieFeatureCachePolicy& Policy,
+    FNuxieFeatureCheckResult& OutResult) const;
+
+  /** Returns true and sets OutPrevious when an entry was replaced. */
+  bool Store(
+    const FString& FeatureId,
+    int32 RequiredBalance,
+    const FString& EntityId,
+    const FNuxieFeatureCheckResult& Result,
+    FNuxieFeatureAccess& OutPrevious);
+
+  /**
+   * Applies a pushed feature-level access change to the cached entries of the feature and marks them
+   * fresh, re-evaluating each against its own RequiredBalance. Entries the push says nothing about
+   * (an entity's balance, or a balance the push does not carry) are dropped instead.
+   */
+  void ApplyAccessChange(const FString& FeatureId, const FNuxieFeatureAccess& Current);
+
+  /** At most one background refresh runs per entry. */
+  bool TryBeginRevalidate(const FString& FeatureId, int32 RequiredBalance, const FString& EntityId);
+  void EndRevalidate(const FString& FeatureId, int32 RequiredBalance, const FString& EntityId);
+
+  /** As TryBeginRevalidate, for a key that has no entry yet: at most one first fetch runs per key. */
+  bool TryBeginFetch(const FString& FeatureId, int32 RequiredBalance, const FString& EntityId);
+  void EndFetch(const FString& FeatureId, int32 RequiredBalance, const FString& EntityId);
+
+  void Reset();
+
+private:
+  struct FKey
+  {
+    FNuxieName FeatureId;
+    FNuxieName EntityId;
+    int32 RequiredBalance = 1;
+
+    bool operator==(const FKey& Other) const
+    {
+      return RequiredBalance == Other.RequiredBalance && FeatureId == Other.FeatureId && EntityId == Other.EntityId;
+    }
+
+    friend uint32 GetTypeHash(const FKey& Key)
+    {
+      return HashCombine(HashCombine(GetTypeHash(Key.FeatureId), GetTypeHash(Key.EntityId)), ::GetTypeHash(Key.RequiredBalance));
+    }
+  };
+
+  struct FEntry
+  {
+    FNuxieFeatureCheckResult Result;
+    double StoredAtSeconds = 0.0;
+    bool bRevalidating = false;
+  };
+
+  /** Adds unseen IDs to the name table. */
+  static FKey MakeKey(const FString& FeatureId, int32 RequiredBalance, const FString& EntityId);
+
+  /** Returns false without touching the name table when an ID was never interned, so cannot be cached. */
+  static bool FindKey(const FString& FeatureId, int32 RequiredBalance, const FString& EntityId, FKey& OutKey);
+
+  mutable FCriticalSection Mutex;
+  TMap<FKey, FEntry> Entries;
+  TSet<FKey> Fetching;
+};
@@ -0,0 +1,199 @@
+#include "NuxieFeatureSubscriptions.h"
+
+FDelegateHandle FNuxieFeatureSubscriptionIndex::Add(const FNuxieName& FeatureId, const FNuxieName& EntityId, FNuxieFeatureAccessChangedDelegate Callback)
+{
+  if (FeatureId.IsNone() || !Callback.IsBound())
+  {
+    return FDelegateHandle();
+  }
+
+  FSubscription Subscription;
+  Subscription.Handle = FDelegateHandle(FDelegateHandle::GenerateNewHandle);
+  Subscription.EntityId = EntityId;
+  Subscription.Callback = MoveTemp(Callback);
+
+  const FDelegateHandle Handle = Subscription.Handle;
+  FeatureByHandle.Add(Handle, FeatureId);
+
+  if (DispatchDepth > 0)
+  {
+    // Growing a bucket (or the map) would move the delegate that is currently executing.
+    PendingAdds.Emplace(FeatureId, MoveTemp(Subscription));
+    return Handle;
+  }
+
+  TArray<FSubscription>& Bucket = SubscriptionsByFeature.FindOrAdd(FeatureId);
+  Compact(Bucket);
+  Bucket.Add(MoveTemp(Subscription));
+  return Handle;
+}
+
+bool FNuxieFeatureSubscriptionIndex::Remove(FDelegateHandle Handle)
+{
+  FNuxieName FeatureId;
+  if (!Handle.IsValid() || !FeatureByHandle.RemoveAndCopyValue(Handle, FeatureId))
+  {
+    return false;
+  }
+
+  for (TPair<FNuxieName, FSubscription>& Pending : PendingAdds)
+  {
+    if (Pending.Value.Handle == Handle)
+    {
+      Pending.Value.Callback.Unbind();
+      return true;
+    }
+  }
+
+  TArray<FSubscription>* Bucket = SubscriptionsByFeature.Find(FeatureId);
+  if (Bucket == nullptr)
+  {
+    return false;
+  }
+
+  for (FSubscription& Subscription : *Bucket)
+  {
+    if (Subscription.Handle == Handle)
+    {
+      // Unbinding keeps indices stable while a dispatch is iterating; Compact drops the slot.
+      Subscription.Callback.Unbind();
+      break;
+    }
+  }
+
+  if (DispatchDepth == 0)
+  {
+    Compact(*Bucket);
+  }
+  return true;
+}
+
+void FNuxieFeatureSubscriptionIndex::RemoveAll(const void* UserObject)
+{
+  if (UserObject == nullptr)
+  {
+    return;
+  }
+
+  for (TPair<FNuxieName, TArray<FSubscription>>& Pair : SubscriptionsByFeature)
+  {
+    for (FSubscription& Subscription : Pair.Value)
+    {
+      if (Subscription.Callback.IsBoundToObject(UserObject))
+      {
+        Subscription.Callback.Unbind();
+      }
+    }
+  }
+
+  for (TPair<FNuxieName, FSubscription>& Pending : PendingAdds)
+  {
+    if (Pending.Value.Callback.IsBoundToObject(UserObject))
+    {
+      Pending.Value.Callback.Unbind();
+    }
+  }
+
+  if (DispatchDepth > 0)
+  {
+    return;
+  }
+
+  for (auto It = SubscriptionsByFeature.CreateIterator(); It; ++It)
+  {
+    Compact(It.Value());
+    if (It.Value().IsEmpty())
+    {
+      It.RemoveCurrent();
+    }
+  }
+}
+
+void FNuxieFeatureSubscriptionIndex::Reset()
+{
+  for (TPair<FNuxieName, TArray<FSubscription>>& Pair : SubscriptionsByFeature)
+  {
+    for (FSubscription& Subscription : Pair.Value)
+    {
+      Subscription.Callback.Unbind();
+    }
+  }
+
+  PendingAdds.Reset();
+  FeatureByHandle.Reset();
+  if (DispatchDepth == 0)
+  {
+    SubscriptionsByFeature.Reset();
+  }
+}
+
+void FNuxieFeatureSubscriptionIndex::Dispatch(
+  const FString& FeatureId,
+  const FString& EntityId,
+  const FNuxieFeatureAccess& Previous,
+  const FNuxieFeatureAccess& Current)
+{
+  // A feature nobody subscribed to was never interned by Add.
+  const FNuxieName FeatureName(FeatureId, FNAME_Find);
+  TArray<FSubscription>* Bucket = FeatureName.IsNone() ? nullptr : SubscriptionsByFeature.Find(FeatureName);
+  if (Bucket == nullptr)
+  {
+    return;
+  }
+
+  // An entity that was never interned only reaches subscribers to the whole feature.
+  const FNuxieName EntityName = FNuxieName::FromOptional(EntityId, FNAME_Find);
+
+  // The bucket cannot move while DispatchDepth > 0: adds are deferred and removals only unbind.
+  ++DispatchDepth;
+  for (const FSubscription& Subscription : *Bucket)
+  {
+    if (!EntityId.IsEmpty() && !Subscription.EntityId.IsNone() && Subscription.EntityId != EntityName)
+    {
+      continue;
+    }
+
+    Subscription.Callback.ExecuteIfBound(FeatureId, Previous, Current);
+  }
+  --DispatchDepth;
+
+  if (DispatchDepth == 0)
+  {
+    Compact(*Bucket);
+    FlushPendingAdds();
+  }
+}
+
+int32 FNuxieFeatureSubscriptionIndex::Num() const
+{
+  return FeatureByHandle.Num();
+}
+
+void FNuxieFeatureSubscriptionIndex::Compact(TArray<FSubscription>& Bucket)
+{
+  Bucket.RemoveAll([this](const FSubscription& Subscription)
+  {
+    if (Subscription.Callback.IsBound())
+    {
+      return false;
+    }
+
+    FeatureByHandle.Remove(Subscription.Handle);
+    return true;
+  });
+}
+
+void FNuxieFeatureSubscriptionIndex::FlushPendingAdds()
+{
+  for (TPair<FNuxieName, FSubscription>& Pending : PendingAdds)
+  {
+    if (!Pending.Value.Callback.IsBound())
+    {
+      FeatureByHandle.Remove(Pending.Value.Handle);
+      continue;
+    }
+
+    SubscriptionsByFeature.FindOrAdd(Pending.Key).Add(MoveTemp(Pending.Value));
+  }
+  PendingAdds.Reset();
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "NuxieName.h"
+#include "NuxieSubsystem.h"
+
+/**
+ * Feature-access subscriptions bucketed by feature ID, so a change notification only visits the
+ * subscribers of that feature. IDs are held as FNuxieNames, so finding a bucket and matching an
+ * entity compare integers, case-sensitively. Subscriptions bound to a UObject (CreateUObject / CreateWeakLambda)
+ * are dropped automatically once their owner is destroyed. Game thread only.
+ */
+class FNuxieFeatureSubscriptionIndex
+{
+public:
+  FDelegateHandle Add(const FNuxieName& FeatureId, const FNuxieName& EntityId, FNuxieFeatureAccessChangedDelegate Callback);
+  bool Remove(FDelegateHandle Handle);
+  void RemoveAll(const void* UserObject);
+  void Reset();
+
+  /** Invokes subscribers of FeatureId. An empty EntityId reaches every subscriber of the feature. */
+  void Dispatch(const FString& FeatureId, const FString& EntityId, const FNuxieFeatureAccess& Previous, const FNuxieFeatureAccess& Current);
+
+  int32 Num() const;
+
+private:
+  struct FSubscription
+  {
+    FDelegateHandle Handle;
+    FNuxieName EntityId;
+    FNuxieFeatureAccessChangedDelegate Callback;
+  };
+
+  void Compact(TArray<FSubscription>& Bucket);
+  void FlushPendingAdds();
+
+  TMap<FNuxieName, TArray<FSubscription>> SubscriptionsByFeature;
+  TMap<FDelegateHandle, FNuxieName> FeatureByHandle;
+
+  /** Subscriptions made from inside a callback; merged once the outermost dispatch returns. */
+  TArray<TPair<FNuxieName, FSubscription>> PendingAdds;
+  int32 DispatchDepth = 0;
+};
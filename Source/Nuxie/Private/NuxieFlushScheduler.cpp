@@ -0,0 +1,170 @@
+#include "NuxieFlushScheduler.h"
+
+#include "Misc/CoreDelegates.h"
+#include "NuxieSubsystem.h"
+
+namespace
+{
+  // Rough size of one queued event as the native SDKs serialize it.
+  constexpr int64 ApproxBytesPerEvent = 512;
+}
+
+FNuxieFlushScheduler::FNuxieFlushScheduler(UNuxieSubsystem* InOwner, FReportCallback InOnReport)
+  : Owner(InOwner)
+  , OnReport(MoveTemp(InOnReport))
+{
+  WillEnterBackgroundHandle = FCoreDelegates::ApplicationWillEnterBackgroundDelegate.AddRaw(this, &FNuxieFlushScheduler::HandleWillEnterBackground);
+  HasEnteredForegroundHandle = FCoreDelegates::ApplicationHasEnteredForegroundDelegate.AddRaw(this, &FNuxieFlushScheduler::HandleHasEnteredForeground);
+  WillTerminateHandle = FCoreDelegates::GetApplicationWillTerminateDelegate().AddRaw(this, &FNuxieFlushScheduler::HandleWillTerminate);
+}
+
+FNuxieFlushScheduler::~FNuxieFlushScheduler()
+{
+  FCoreDelegates::ApplicationWillEnterBackgroundDelegate.Remove(WillEnterBackgroundHandle);
+  FCoreDelegates::ApplicationHasEnteredForegroundDelegate.Remove(HasEnteredForegroundHandle);
+  FCoreDelegates::GetApplicationWillTerminateDelegate().Remove(WillTerminateHandle);
+}
+
+void FNuxieFlushScheduler::SetGameplayCritical(bool bCritical)
+{
+  check(IsInGameThread());
+  UNuxieSubsystem* Subsystem = Owner.Get();
+
+  if (bCritical)
+  {
+    if (CriticalDepth++ == 0 && Subsystem != nullptr && !bInBackground)
+    {
+      Subsystem->PauseEventQueueAsync(FSimpleDelegate(), [](const FNuxieError&) {});
+    }
+    return;
+  }
+
+  if (!ensureMsgf(CriticalDepth > 0, TEXT("SetGameplayCritical(false) without a matching SetGameplayCritical(true).")))
+  {
+    return;
+  }
+
+  if (--CriticalDepth == 0 && Subsystem != nullptr && !bInBackground)
+  {
+    // Leaving the last critical scope is the safe point the held-back events were waiting for.
+    Subsystem->ResumeEventQueueAsync(FSimpleDelegate(), [](const FNuxieError&) {});
+    Flush(ENuxieFlushReason::SafePoint, true);
+  }
+}
+
+bool FNuxieFlushScheduler::IsGameplayCritical() const
+{
+  return CriticalDepth > 0;
+}
+
+void FNuxieFlushScheduler::MarkSafePoint()
+{
+  check(IsInGameThread());
+  if (CriticalDepth == 0)
+  {
+    Flush(ENuxieFlushReason::SafePoint, true);
+  }
+}
+
+const FNuxieFlushReport& FNuxieFlushScheduler::GetLastReport() const
+{
+  return LastReport;
+}
+
+void FNuxieFlushScheduler::HandleWillEnterBackground()
+{
+  bInBackground = true;
+  if (UNuxieSubsystem* Subsystem = Owner.Get())
+  {
+    if (CriticalDepth > 0)
+    {
+      Subsystem->ResumeEventQueueAsync(FSimpleDelegate(), [](const FNuxieError&) {});
+    }
+    Flush(ENuxieFlushReason::Background, false);
+  }
+}
+
+void FNuxieFlushScheduler::HandleHasEnteredForeground()
+{
+  bInBackground = false;
+  UNuxieSubsystem* Subsystem = Owner.Get();
+  if (Subsystem != nullptr && CriticalDepth > 0)
+  {
+    Subsystem->PauseEventQueueAsync(FSimpleDelegate(), [](const FNuxieError&) {});
+  }
+}
+
+void FNuxieFlushScheduler::HandleWillTerminate()
+{
+  Flush(ENuxieFlushReason::Terminate, false);
+}
+
+void FNuxieFlushScheduler::Flush(ENuxieFlushReason Reason, bool bCountFirst)
+{
+  UNuxieSubsystem* Subsystem = Owner.Get();
+  if (Subsystem == nullptr)
+  {
+    return;
+  }
+
+  if (!bCountFirst)
+  {
+    // The OS may suspend us at any moment; do not spend a round trip on bookkeeping.
+    StartFlush(Reason, INDEX_NONE);
+    return;
+  }
+
+  TWeakPtr<FNuxieFlushScheduler> WeakThis = AsShared();
+  Subsystem->GetQueuedEventCountAsync(
+    [WeakThis, Reason](int32 Count)
+    {
+      if (const TSharedPtr<FNuxieFlushScheduler> This = WeakThis.Pin())
+      {
+        This->StartFlush(Reason, Count);
+      }
+    },
+    [WeakThis, Reason](const FNuxieError&)
+    {
+      if (const TSharedPtr<FNuxieFlushScheduler> This = WeakThis.Pin())
+      {
+        This->StartFlush(Reason, INDEX_NONE);
+      }
+    });
+}
+
+void FNuxieFlushScheduler::StartFlush(ENuxieFlushReason Reason, int32 EventCount)
+{
+  UNuxieSubsystem* Subsystem = Owner.Get();
+  if (Subsystem == nullptr || EventCount == 0)
+  {
+    return;
+  }
+
+  FNuxieFlushReport Report;
+  Report.Reason = Reason;
+  Report.EventCount = EventCount;
+  Report.ApproxBytes = EventCount > 0 ? EventCount * ApproxBytesPerEvent : 0;
+
+  const double StartSeconds = FPlatformTime::Seconds();
+  TWeakPtr<FNuxieFlushScheduler> WeakThis = AsShared();
+  auto Complete = [WeakThis, Report, StartSeconds](bool bSuccess) mutable
+  {
+    const TSharedPtr<FNuxieFlushScheduler> This = WeakThis.Pin();
+    if (!This.IsValid())
+    {
+      return;
+    }
+
+    Report.bSuccess = bSuccess;
+    Report.LatencyMs = static_cast<float>((FPlatformTime::Seconds() - StartSeconds) * 1000.0);
+    This->LastReport = Report;
+    if (This->OnReport)
+    {
+      This->OnReport(Report);
+    }
+  };
+
+  Subsystem->FlushEventsAsync(
+    [Complete](bool bSuccess) mutable { Complete(bSuccess); },
+    [Complete](const FNuxieError&) mutable { Complete(false); });
+}
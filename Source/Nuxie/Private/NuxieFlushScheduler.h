@@ -0,0 +1,50 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "NuxieTypes.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+class UNuxieSubsystem;
+
+/**
+ * Decides when the native event queue is paused and flushed.
+ *
+ * The queue is paused while any gameplay-critical scope is open and flushed in one burst when the
+ * last one closes or at an explicit safe point. Entering the background or terminating forces a
+ * flush even inside a critical scope; the pause is restored on returning to the foreground.
+ * Game thread only; async completions hold a weak pointer, so the scheduler may be destroyed with
+ * flushes outstanding.
+ */
+class FNuxieFlushScheduler : public TSharedFromThis<FNuxieFlushScheduler>
+{
+public:
+  using FReportCallback = TFunction<void(const FNuxieFlushReport&)>;
+
+  FNuxieFlushScheduler(UNuxieSubsystem* InOwner, FReportCallback InOnReport);
+  ~FNuxieFlushScheduler();
+
+  void SetGameplayCritical(bool bCritical);
+  bool IsGameplayCritical() const;
+  void MarkSafePoint();
+
+  const FNuxieFlushReport& GetLastReport() const;
+
+private:
+  void HandleWillEnterBackground();
+  void HandleHasEnteredForeground();
+  void HandleWillTerminate();
+
+  void Flush(ENuxieFlushReason Reason, bool bCountFirst);
+  void StartFlush(ENuxieFlushReason Reason, int32 EventCount);
+
+  TWeakObjectPtr<UNuxieSubsystem> Owner;
+  FReportCallback OnReport;
+  FNuxieFlushReport LastReport;
+  int32 CriticalDepth = 0;
+  bool bInBackground = false;
+
+  FDelegateHandle WillEnterBackgroundHandle;
+  FDelegateHandle HasEnteredForegroundHandle;
+  FDelegateHandle WillTerminateHandle;
+};
@@ -0,0 +1,135 @@
+#include "NuxieIdentifyDiffer.h"
+
+#include "Misc/Crc.h"
+
+namespace
+{
+  // Seeded with the type so that 1, 1.0, true and "1" hash differently. MemCrc32 over the
+  // characters is case-sensitive, unlike GetTypeHash(FString), so a change of case is still sent.
+  uint32 HashValue(const FNuxiePropertyBag::FProperty& Property)
+  {
+    const uint32 Seed = static_cast<uint32>(Property.Type);
+    switch (Property.Type)
+    {
+    case ENuxiePropertyType::Int:
+      return FCrc::MemCrc32(&Property.Int, sizeof(Property.Int), Seed);
+    case ENuxiePropertyType::Double:
+      return FCrc::MemCrc32(&Property.Double, sizeof(Property.Double), Seed);
+    case ENuxiePropertyType::Bool:
+      return FCrc::MemCrc32(&Property.bBool, sizeof(Property.bBool), Seed);
+    case ENuxiePropertyType::String:
+    default:
+      return FCrc::MemCrc32(Property.String.GetData(), Property.String.Len() * sizeof(TCHAR), Seed);
+    }
+  }
+}
+
+bool FNuxieIdentifyDiffer::IsSwitch(const FString& DistinctId) const
+{
+  return !bHasCurrent || !CurrentDistinctId.Equals(DistinctId, ESearchCase::CaseSensitive);
+}
+
+FNuxieIdentifyDiffer::EResult FNuxieIdentifyDiffer::Add(
+  const FString& DistinctId,
+  const FNuxiePropertyBag& UserProperties,
+  const FNuxiePropertyBag& UserPropertiesSetOnce,
+  FUpdate& OutUpdate)
+{
+  FSentState& State = StatesByDistinctId.FindOrAdd(DistinctId);
+  if (IsSwitch(DistinctId))
+  {
+    // The switch itself must reach the native SDK even when no property changed.
+    check(!bHasPending);
+    OutUpdate.DistinctId = DistinctId;
+    OutUpdate.UserProperties.Reset();
+    OutUpdate.UserPropertiesSetOnce.Reset();
+    CollectChanges(State, UserProperties, UserPropertiesSetOnce, OutUpdate.UserProperties, OutUpdate.UserPropertiesSetOnce);
+    CurrentDistinctId = DistinctId;
+    bHasCurrent = true;
+    return EResult::SendNow;
+  }
+
+  if (!CollectChanges(State, UserProperties, UserPropertiesSetOnce, Pending.UserProperties, Pending.UserPropertiesSetOnce))
+  {
+    ++SuppressedCount;
+    return EResult::Suppressed;
+  }
+
+  if (bHasPending)
+  {
+    ++MergedCount;
+  }
+  Pending.DistinctId = DistinctId;
+  bHasPending = true;
+  return EResult::Merged;
+}
+
+bool FNuxieIdentifyDiffer::TakePending(FUpdate& OutUpdate)
+{
+  if (!bHasPending)
+  {
+    return false;
+  }
+
+  OutUpdate = MoveTemp(Pending);
+  Pending = FUpdate();
+  bHasPending = false;
+  return true;
+}
+
+void FNuxieIdentifyDiffer::Forget(const FString& DistinctId)
+{
+  StatesByDistinctId.Remove(DistinctId);
+}
+
+void FNuxieIdentifyDiffer::Reset()
+{
+  StatesByDistinctId.Reset();
+  CurrentDistinctId.Reset();
+  bHasCurrent = false;
+  Pending = FUpdate();
+  bHasPending = false;
+}
+
+int64 FNuxieIdentifyDiffer::GetSuppressedCount() const
+{
+  return SuppressedCount;
+}
+
+int64 FNuxieIdentifyDiffer::GetMergedCount() const
+{
+  return MergedCount;
+}
+
+bool FNuxieIdentifyDiffer::CollectChanges(
+  FSentState& State,
+  const FNuxiePropertyBag& UserProperties,
+  const FNuxiePropertyBag& UserPropertiesSetOnce,
+  FNuxiePropertyBag& OutProperties,
+  FNuxiePropertyBag& OutPropertiesSetOnce)
+{
+  bool bChanged = false;
+  for (const FNuxiePropertyBag::FProperty& Property : UserProperties)
+  {
+    const uint32 Hash = HashValue(Property);
+    uint32& SentHash = State.PropertyHashes.FindOrAdd(FString(Property.Key), ~Hash);
+    if (SentHash != Hash)
+    {
+      SentHash = Hash;
+      OutProperties.Set(Property);
+      bChanged = true;
+    }
+  }
+
+  for (const FNuxiePropertyBag::FProperty& Property : UserPropertiesSetOnce)
+  {
+    bool bAlreadySent = false;
+    State.SetOnceKeys.Add(FString(Property.Key), &bAlreadySent);
+    if (!bAlreadySent)
+    {
+      OutPropertiesSetOnce.Set(Property);
+      bChanged = true;
+    }
+  }
+  return bChanged;
+}
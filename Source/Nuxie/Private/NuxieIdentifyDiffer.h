@@ -0,0 +1,76 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "NuxieCaseSensitiveKeyFuncs.h"
+#include "NuxiePropertyBag.h"
+
+/**
+ * Reduces Identify calls to the user properties that changed since they were last sent.
+ *
+ * Keeps a CRC of every property value and type sent per distinct ID, and the set-once keys already sent,
+ * which the server would ignore anyway. A call for the current distinct ID that changes nothing is
+ * suppressed; one that changes something is merged into a pending update that the owner sends once
+ * per frame. A call for another distinct ID is sent right away, also reduced to its changed keys.
+ * Distinct IDs and property keys are case-sensitive, as the backend's are. Game thread only.
+ */
+class FNuxieIdentifyDiffer
+{
+public:
+  enum class EResult : uint8
+  {
+    /** Switches distinct ID: send OutUpdate now, after any pending update. */
+    SendNow,
+    /** Merged into the pending update for the current distinct ID. */
+    Merged,
+    /** Nothing changed; no call is needed. */
+    Suppressed,
+  };
+
+  struct FUpdate
+  {
+    FString DistinctId;
+    FNuxiePropertyBag UserProperties;
+    FNuxiePropertyBag UserPropertiesSetOnce;
+  };
+
+  /** True when DistinctId is not the last distinct ID sent, so the pending update must go out first. */
+  bool IsSwitch(const FString& DistinctId) const;
+
+  EResult Add(
+    const FString& DistinctId,
+    const FNuxiePropertyBag& UserProperties,
+    const FNuxiePropertyBag& UserPropertiesSetOnce,
+    FUpdate& OutUpdate);
+
+  bool TakePending(FUpdate& OutUpdate);
+
+  /** Drops the values recorded for DistinctId, e.g. after a failed call, so its next call sends everything. */
+  void Forget(const FString& DistinctId);
+  void Reset();
+
+  int64 GetSuppressedCount() const;
+  int64 GetMergedCount() const;
+
+private:
+  struct FSentState
+  {
+    TNuxieCaseSensitiveMap<uint32> PropertyHashes;
+    FNuxieCaseSensitiveSet SetOnceKeys;
+  };
+
+  /** Copies the entries of the incoming bags that differ from State into the outgoing bags and records them. */
+  static bool CollectChanges(
+    FSentState& State,
+    const FNuxiePropertyBag& UserProperties,
+    const FNuxiePropertyBag& UserPropertiesSetOnce,
+    FNuxiePropertyBag& OutProperties,
+    FNuxiePropertyBag& OutPropertiesSetOnce);
+
+  TNuxieCaseSensitiveMap<FSentState> StatesByDistinctId;
+  FString CurrentDistinctId;
+  bool bHasCurrent = false;
+  FUpdate Pending;
+  bool bHasPending = false;
+  int64 SuppressedCount = 0;
+  int64 MergedCount = 0;
+};
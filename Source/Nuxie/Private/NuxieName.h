@@ -0,0 +1,82 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Misc/StringBuilder.h"
+
+/**
+ * A feature ID, entity ID or event name interned as an FName, plus the letter case FName drops.
+ *
+ * FName compares ignoring case, and outside the editor it keeps only the first spelling it saw, so
+ * "Gems" and "gems" share one FName. CaseMask has a bit set for each upper-case character; two IDs
+ * whose FNames are equal differ only in case, so the mask tells them apart. Hashing and comparing
+ * stay integer operations. Exact for IDs up to 64 characters; past that, upper-case positions are
+ * folded into the mask by hash.
+ */
+struct FNuxieName
+{
+  FName Name;
+  uint64 CaseMask = 0;
+
+  FNuxieName() = default;
+
+  /** With FNAME_Find the result is None when the ID was never interned. */
+  explicit FNuxieName(FStringView Id, EFindName FindType = FNAME_Add)
+    : Name(Id, FindType)
+    , CaseMask(Name.IsNone() ? 0 : MakeCaseMask(Id))
+  {
+  }
+
+  /** Takes the case the FName kept: the caller's spelling in the editor, the first one seen elsewhere. */
+  explicit FNuxieName(FName InName)
+    : Name(InName)
+    , CaseMask(InName.IsNone() ? 0 : MakeCaseMask(FNameBuilder(InName).ToView()))
+  {
+  }
+
+  /** An empty ID is None, which stands for "no entity". */
+  static FNuxieName FromOptional(const FString& Id, EFindName FindType = FNAME_Add)
+  {
+    return Id.IsEmpty() ? FNuxieName() : FNuxieName(Id, FindType);
+  }
+
+  bool IsNone() const
+  {
+    return Name.IsNone();
+  }
+
+  /** Any strict order works for the sorted tables; this one needs no string compare. */
+  bool FastLess(const FNuxieName& Other) const
+  {
+    return Name != Other.Name ? Name.FastLess(Other.Name) : CaseMask < Other.CaseMask;
+  }
+
+  bool operator==(const FNuxieName& Other) const
+  {
+    return Name == Other.Name && CaseMask == Other.CaseMask;
+  }
+
+  bool operator!=(const FNuxieName& Other) const
+  {
+    return !(*this == Other);
+  }
+
+  friend uint32 GetTypeHash(const FNuxieName& Id)
+  {
+    return HashCombineFast(GetTypeHash(Id.Name), ::GetTypeHash(Id.CaseMask));
+  }
+
+private:
+  static uint64 MakeCaseMask(FStringView Id)
+  {
+    uint64 Mask = 0;
+    for (int32 Index = 0; Index < Id.Len(); ++Index)
+    {
+      if (FChar::IsUpper(Id[Index]))
+      {
+        Mask ^= Index < 64 ? (uint64(1) << Index) : uint64(Index) * 0x9E3779B97F4A7C15ull;
+      }
+    }
+    return Mask;
+  }
+};
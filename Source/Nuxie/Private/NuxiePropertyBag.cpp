@@ -0,0 +1,305 @@
+#include "NuxiePropertyBag.h"
+
+namespace
+{
+  int32 BytesToWords(int32 NumBytes)
+  {
+    return (NumBytes + static_cast<int32>(sizeof(uint64)) - 1) / static_cast<int32>(sizeof(uint64));
+  }
+}
+
+FString FNuxiePropertyBag::FProperty::ValueToString() const
+{
+  switch (Type)
+  {
+  case ENuxiePropertyType::Int:
+    return FString::Printf(TEXT("%lld"), Int);
+  case ENuxiePropertyType::Double:
+    return FString::SanitizeFloat(Double);
+  case ENuxiePropertyType::Bool:
+    return bBool ? TEXT("true") : TEXT("false");
+  case ENuxiePropertyType::String:
+  default:
+    return FString(String);
+  }
+}
+
+FNuxiePropertyBag::FConstIterator::FConstIterator(const FNuxiePropertyBag& InBag, int32 InWordIndex)
+  : Bag(InBag)
+  , WordIndex(InWordIndex)
+{
+}
+
+FNuxiePropertyBag::FProperty FNuxiePropertyBag::FConstIterator::operator*() const
+{
+  return Bag.ReadEntry(WordIndex);
+}
+
+FNuxiePropertyBag::FConstIterator& FNuxiePropertyBag::FConstIterator::operator++()
+{
+  int32 NumWords = 0;
+  Bag.ReadEntry(WordIndex, &NumWords);
+  WordIndex += NumWords;
+  return *this;
+}
+
+bool FNuxiePropertyBag::FConstIterator::operator!=(const FConstIterator& Other) const
+{
+  return WordIndex != Other.WordIndex;
+}
+
+FNuxiePropertyBag::FNuxiePropertyBag(FNuxiePropertyBag&& Other)
+  : Words(MoveTemp(Other.Words))
+  , NumProperties(Other.NumProperties)
+{
+  Other.Words.Reset();
+  Other.NumProperties = 0;
+}
+
+FNuxiePropertyBag& FNuxiePropertyBag::operator=(FNuxiePropertyBag&& Other)
+{
+  if (this != &Other)
+  {
+    Words = MoveTemp(Other.Words);
+    NumProperties = Other.NumProperties;
+    Other.Words.Reset();
+    Other.NumProperties = 0;
+  }
+  return *this;
+}
+
+FNuxiePropertyBag FNuxiePropertyBag::FromStringMap(const TMap<FString, FString>& Values)
+{
+  FNuxiePropertyBag Bag;
+  for (const TPair<FString, FString>& Pair : Values)
+  {
+    // Map keys are unique already, so skip the replace lookup of SetString.
+    Bag.AppendEntry(ENuxiePropertyType::String, Pair.Key, *Pair.Value, Pair.Value.Len() * sizeof(TCHAR));
+  }
+  return Bag;
+}
+
+FNuxiePropertyBag FNuxiePropertyBag::Clone() const
+{
+  FNuxiePropertyBag Copy;
+  Copy.Words = Words;
+  Copy.NumProperties = NumProperties;
+  return Copy;
+}
+
+FNuxiePropertyBag& FNuxiePropertyBag::SetInt(FStringView Key, int64 Value)
+{
+  Remove(Key);
+  AppendEntry(ENuxiePropertyType::Int, Key, &Value, sizeof(Value));
+  return *this;
+}
+
+FNuxiePropertyBag& FNuxiePropertyBag::SetDouble(FStringView Key, double Value)
+{
+  Remove(Key);
+  AppendEntry(ENuxiePropertyType::Double, Key, &Value, sizeof(Value));
+  return *this;
+}
+
+FNuxiePropertyBag& FNuxiePropertyBag::SetBool(FStringView Key, bool Value)
+{
+  const uint8 Byte = Value ? 1 : 0;
+  Remove(Key);
+  AppendEntry(ENuxiePropertyType::Bool, Key, &Byte, sizeof(Byte));
+  return *this;
+}
+
+FNuxiePropertyBag& FNuxiePropertyBag::SetString(FStringView Key, FStringView Value)
+{
+  Remove(Key);
+  AppendEntry(ENuxiePropertyType::String, Key, Value.GetData(), Value.Len() * sizeof(TCHAR));
+  return *this;
+}
+
+void FNuxiePropertyBag::Set(const FProperty& Property)
+{
+  switch (Property.Type)
+  {
+  case ENuxiePropertyType::Int:
+    SetInt(Property.Key, Property.Int);
+    break;
+  case ENuxiePropertyType::Double:
+    SetDouble(Property.Key, Property.Double);
+    break;
+  case ENuxiePropertyType::Bool:
+    SetBool(Property.Key, Property.bBool);
+    break;
+  case ENuxiePropertyType::String:
+  default:
+    SetString(Property.Key, Property.String);
+    break;
+  }
+}
+
+void FNuxiePropertyBag::AppendMissing(const FNuxiePropertyBag& Other)
+{
+  check(&Other != this);
+  for (const FProperty& Property : Other)
+  {
+    if (!Contains(Property.Key))
+    {
+      Set(Property);
+    }
+  }
+}
+
+bool FNuxiePropertyBag::Remove(FStringView Key)
+{
+  const int32 WordIndex = FindEntry(Key);
+  if (WordIndex == INDEX_NONE)
+  {
+    return false;
+  }
+
+  int32 NumWords = 0;
+  ReadEntry(WordIndex, &NumWords);
+  Words.RemoveAt(WordIndex, NumWords);
+  --NumProperties;
+  return true;
+}
+
+bool FNuxiePropertyBag::Contains(FStringView Key) const
+{
+  return FindEntry(Key) != INDEX_NONE;
+}
+
+bool FNuxiePropertyBag::Find(FStringView Key, FProperty& OutProperty) const
+{
+  const int32 WordIndex = FindEntry(Key);
+  if (WordIndex == INDEX_NONE)
+  {
+    return false;
+  }
+
+  OutProperty = ReadEntry(WordIndex);
+  return true;
+}
+
+int32 FNuxiePropertyBag::Num() const
+{
+  return NumProperties;
+}
+
+bool FNuxiePropertyBag::IsEmpty() const
+{
+  return NumProperties == 0;
+}
+
+void FNuxiePropertyBag::Reset()
+{
+  Words.Reset();
+  NumProperties = 0;
+}
+
+void FNuxiePropertyBag::ToStringMap(TMap<FString, FString>& OutValues) const
+{
+  OutValues.Reserve(OutValues.Num() + NumProperties);
+  for (const FProperty& Property : *this)
+  {
+    OutValues.Add(FString(Property.Key), Property.ValueToString());
+  }
+}
+
+TMap<FString, FString> FNuxiePropertyBag::ToStringMap() const
+{
+  TMap<FString, FString> Values;
+  ToStringMap(Values);
+  return Values;
+}
+
+FNuxiePropertyBag::FConstIterator FNuxiePropertyBag::begin() const
+{
+  return FConstIterator(*this, 0);
+}
+
+FNuxiePropertyBag::FConstIterator FNuxiePropertyBag::end() const
+{
+  return FConstIterator(*this, Words.Num());
+}
+
+int32 FNuxiePropertyBag::GetEntryWords(const FEntryHeader& Header)
+{
+  return 1 + BytesToWords(Header.KeyLength * sizeof(TCHAR)) + BytesToWords(Header.ValueBytes);
+}
+
+FNuxiePropertyBag::FProperty FNuxiePropertyBag::ReadEntry(int32 WordIndex, int32* OutNumWords) const
+{
+  const uint64* Entry = Words.GetData() + WordIndex;
+  FEntryHeader Header;
+  FMemory::Memcpy(&Header, Entry, sizeof(Header));
+
+  const TCHAR* KeyChars = reinterpret_cast<const TCHAR*>(Entry + 1);
+  const uint64* Value = Entry + 1 + BytesToWords(Header.KeyLength * sizeof(TCHAR));
+
+  FProperty Property;
+  Property.Type = Header.Type;
+  Property.Key = FStringView(KeyChars, Header.KeyLength);
+  switch (Header.Type)
+  {
+  case ENuxiePropertyType::Int:
+    FMemory::Memcpy(&Property.Int, Value, sizeof(Property.Int));
+    break;
+  case ENuxiePropertyType::Double:
+    FMemory::Memcpy(&Property.Double, Value, sizeof(Property.Double));
+    break;
+  case ENuxiePropertyType::Bool:
+    Property.bBool = *reinterpret_cast<const uint8*>(Value) != 0;
+    break;
+  case ENuxiePropertyType::String:
+  default:
+    Property.String = FStringView(reinterpret_cast<const TCHAR*>(Value), Header.ValueBytes / sizeof(TCHAR));
+    break;
+  }
+
+  if (OutNumWords != nullptr)
+  {
+    *OutNumWords = GetEntryWords(Header);
+  }
+  return Property;
+}
+
+int32 FNuxiePropertyBag::FindEntry(FStringView Key) const
+{
+  int32 WordIndex = 0;
+  while (WordIndex < Words.Num())
+  {
+    int32 NumWords = 0;
+    const FProperty Property = ReadEntry(WordIndex, &NumWords);
+    if (Property.Key.Equals(Key, ESearchCase::CaseSensitive))
+    {
+      return WordIndex;
+    }
+    WordIndex += NumWords;
+  }
+  return INDEX_NONE;
+}
+
+void FNuxiePropertyBag::AppendEntry(ENuxiePropertyType Type, FStringView Key, const void* Value, int32 ValueBytes)
+{
+  check(Key.Len() <= MAX_uint16);
+
+  FEntryHeader Header;
+  Header.Type = Type;
+  Header.Padding = 0;
+  Header.KeyLength = static_cast<uint16>(Key.Len());
+  Header.ValueBytes = static_cast<uint32>(ValueBytes);
+
+  const int32 KeyWords = BytesToWords(Key.Len() * sizeof(TCHAR));
+  const int32 WordIndex = Words.AddZeroed(GetEntryWords(Header));
+  uint64* Entry = Words.GetData() + WordIndex;
+  FMemory::Memcpy(Entry, &Header, sizeof(Header));
+  if (Key.Len() > 0)
+  {
+    FMemory::Memcpy(Entry + 1, Key.GetData(), Key.Len() * sizeof(TCHAR));
+  }
+  if (ValueBytes > 0)
+  {
+    FMemory::Memcpy(Entry + 1 + KeyWords, Value, ValueBytes);
+  }
+  ++NumProperties;
+}
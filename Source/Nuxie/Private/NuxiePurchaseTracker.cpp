@@ -0,0 +1,186 @@
+#include "NuxiePurchaseTracker.h"
+
+#include "Misc/ScopeLock.h"
+#include "NuxieAsyncQueue.h"
+#include "NuxiePurchaseController.h"
+#include "NuxieStats.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Purchases Pending"), STAT_NuxiePurchasesPending, STATGROUP_Nuxie);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Last Purchase Latency (ms)"), STAT_NuxieLastPurchaseLatency, STATGROUP_Nuxie);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Last Restore Latency (ms)"), STAT_NuxieLastRestoreLatency, STATGROUP_Nuxie);
+
+bool FNuxiePurchaseCompletion::Complete(const FNuxiePurchaseResult& Result) const
+{
+  return Tracker.IsValid() && Tracker->CompletePurchase(RequestId, Result);
+}
+
+bool FNuxiePurchaseCompletion::IsPending() const
+{
+  return Tracker.IsValid() && Tracker->IsPending(RequestId);
+}
+
+bool FNuxieRestoreCompletion::Complete(const FNuxieRestoreResult& Result) const
+{
+  return Tracker.IsValid() && Tracker->CompleteRestore(RequestId, Result);
+}
+
+bool FNuxieRestoreCompletion::IsPending() const
+{
+  return Tracker.IsValid() && Tracker->IsPending(RequestId);
+}
+
+FNuxiePurchaseTracker::FNuxiePurchaseTracker(FPurchaseSink InPurchaseSink, FRestoreSink InRestoreSink)
+  : PurchaseSink(MoveTemp(InPurchaseSink))
+  , RestoreSink(MoveTemp(InRestoreSink))
+{
+}
+
+void FNuxiePurchaseTracker::Begin(const FString& RequestId, EKind Kind)
+{
+  Begin(RequestId, Kind, FPlatformTime::Seconds());
+}
+
+void FNuxiePurchaseTracker::Begin(const FString& RequestId, EKind Kind, double NowSeconds)
+{
+  FScopeLock Lock(&Mutex);
+  for (auto It = PendingById.CreateIterator(); It; ++It)
+  {
+    if (IsExpired(It.Value(), NowSeconds))
+    {
+      --GetKindStats(It.Value().Kind).Stats.Pending;
+      It.RemoveCurrent();
+    }
+  }
+
+  FPending& Pending = PendingById.FindOrAdd(RequestId);
+  if (Pending.BeganAtSeconds == 0.0)
+  {
+    ++GetKindStats(Kind).Stats.Pending;
+  }
+  Pending.Kind = Kind;
+  Pending.BeganAtSeconds = NowSeconds;
+  SET_DWORD_STAT(STAT_NuxiePurchasesPending, PendingById.Num());
+}
+
+bool FNuxiePurchaseTracker::Claim(const FString& RequestId, EKind Kind)
+{
+  return Claim(RequestId, Kind, FPlatformTime::Seconds());
+}
+
+bool FNuxiePurchaseTracker::Claim(const FString& RequestId, EKind Kind, double NowSeconds)
+{
+  FScopeLock Lock(&Mutex);
+  const FPending* Pending = PendingById.Find(RequestId);
+  if (Pending == nullptr || Pending->Kind != Kind)
+  {
+    return false;
+  }
+
+  // The platform SDK has failed the request by now; a late result has nowhere to go.
+  if (IsExpired(*Pending, NowSeconds))
+  {
+    --GetKindStats(Pending->Kind).Stats.Pending;
+    PendingById.Remove(RequestId);
+    SET_DWORD_STAT(STAT_NuxiePurchasesPending, PendingById.Num());
+    return false;
+  }
+
+  const float LatencyMs = static_cast<float>((NowSeconds - Pending->BeganAtSeconds) * 1000.0);
+  PendingById.Remove(RequestId);
+
+  FKindStats& KindStats = GetKindStats(Kind);
+  FNuxiePurchaseLatencyStats& Stats = KindStats.Stats;
+  --Stats.Pending;
+  ++Stats.Completed;
+  KindStats.TotalLatencyMs += LatencyMs;
+  Stats.LastLatencyMs = LatencyMs;
+  Stats.AverageLatencyMs = static_cast<float>(KindStats.TotalLatencyMs / Stats.Completed);
+  Stats.MaxLatencyMs = FMath::Max(Stats.MaxLatencyMs, LatencyMs);
+
+  SET_DWORD_STAT(STAT_NuxiePurchasesPending, PendingById.Num());
+  if (Kind == EKind::Purchase)
+  {
+    SET_FLOAT_STAT(STAT_NuxieLastPurchaseLatency, LatencyMs);
+  }
+  else
+  {
+    SET_FLOAT_STAT(STAT_NuxieLastRestoreLatency, LatencyMs);
+  }
+  return true;
+}
+
+bool FNuxiePurchaseTracker::IsPending(const FString& RequestId) const
+{
+  return IsPending(RequestId, FPlatformTime::Seconds());
+}
+
+bool FNuxiePurchaseTracker::IsPending(const FString& RequestId, double NowSeconds) const
+{
+  FScopeLock Lock(&Mutex);
+  const FPending* Pending = PendingById.Find(RequestId);
+  return Pending != nullptr && !IsExpired(*Pending, NowSeconds);
+}
+
+bool FNuxiePurchaseTracker::CompletePurchase(const FString& RequestId, const FNuxiePurchaseResult& Result)
+{
+  if (!Claim(RequestId, EKind::Purchase))
+  {
+    return false;
+  }
+
+  NuxieRunOnGameThread([WeakThis = TWeakPtr<FNuxiePurchaseTracker, ESPMode::ThreadSafe>(AsShared()), RequestId, Result]()
+  {
+    if (const TSharedPtr<FNuxiePurchaseTracker, ESPMode::ThreadSafe> This = WeakThis.Pin())
+    {
+      This->PurchaseSink(RequestId, Result);
+    }
+  });
+  return true;
+}
+
+bool FNuxiePurchaseTracker::CompleteRestore(const FString& RequestId, const FNuxieRestoreResult& Result)
+{
+  if (!Claim(RequestId, EKind::Restore))
+  {
+    return false;
+  }
+
+  NuxieRunOnGameThread([WeakThis = TWeakPtr<FNuxiePurchaseTracker, ESPMode::ThreadSafe>(AsShared()), RequestId, Result]()
+  {
+    if (const TSharedPtr<FNuxiePurchaseTracker, ESPMode::ThreadSafe> This = WeakThis.Pin())
+    {
+      This->RestoreSink(RequestId, Result);
+    }
+  });
+  return true;
+}
+
+FNuxiePurchaseLatencyStats FNuxiePurchaseTracker::GetStats(EKind Kind) const
+{
+  FScopeLock Lock(&Mutex);
+  return GetKindStats(Kind).Stats;
+}
+
+void FNuxiePurchaseTracker::Reset()
+{
+  FScopeLock Lock(&Mutex);
+  PendingById.Reset();
+  PurchaseStats.Stats.Pending = 0;
+  RestoreStats.Stats.Pending = 0;
+  SET_DWORD_STAT(STAT_NuxiePurchasesPending, 0);
+}
+
+bool FNuxiePurchaseTracker::IsExpired(const FPending& Pending, double NowSeconds)
+{
+  return NowSeconds - Pending.BeganAtSeconds >= ExpireAfterSeconds;
+}
+
+FNuxiePurchaseTracker::FKindStats& FNuxiePurchaseTracker::GetKindStats(EKind Kind)
+{
+  return Kind == EKind::Purchase ? PurchaseStats : RestoreStats;
+}
+
+const FNuxiePurchaseTracker::FKindStats& FNuxiePurchaseTracker::GetKindStats(EKind Kind) const
+{
+  return Kind == EKind::Purchase ? PurchaseStats : RestoreStats;
+}
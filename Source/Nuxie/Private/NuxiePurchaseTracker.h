@@ -0,0 +1,83 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "HAL/CriticalSection.h"
+#include "NuxieTypes.h"
+
+/**
+ * Purchase and restore requests that reached the game and are not completed yet, with the time
+ * each one waited. A request completes at most once: completion handles claim it here, from any
+ * thread, and the claimed result is forwarded to the platform SDK on the game thread. Safe to use
+ * from any thread.
+ */
+class FNuxiePurchaseTracker : public TSharedFromThis<FNuxiePurchaseTracker, ESPMode::ThreadSafe>
+{
+public:
+  enum class EKind : uint8
+  {
+    Purchase,
+    Restore
+  };
+
+  /**
+   * How long the platform SDK waits for a result before failing the request natively. The Android
+   * bridge passes it down at Configure, so both sides give up together.
+   */
+  static constexpr int32 TimeoutSeconds = 60;
+
+  using FPurchaseSink = TFunction<void(const FString&, const FNuxiePurchaseResult&)>;
+  using FRestoreSink = TFunction<void(const FString&, const FNuxieRestoreResult&)>;
+
+  /** The sinks run on the game thread and send a claimed result to the platform SDK. */
+  FNuxiePurchaseTracker(FPurchaseSink InPurchaseSink, FRestoreSink InRestoreSink);
+
+  void Begin(const FString& RequestId, EKind Kind);
+  void Begin(const FString& RequestId, EKind Kind, double NowSeconds);
+
+  /** Removes a pending request and records its latency; false when it is not pending or has expired. */
+  bool Claim(const FString& RequestId, EKind Kind);
+  bool Claim(const FString& RequestId, EKind Kind, double NowSeconds);
+  bool IsPending(const FString& RequestId) const;
+  bool IsPending(const FString& RequestId, double NowSeconds) const;
+
+  /** Claims the request, then forwards Result from the game thread. */
+  bool CompletePurchase(const FString& RequestId, const FNuxiePurchaseResult& Result);
+  bool CompleteRestore(const FString& RequestId, const FNuxieRestoreResult& Result);
+
+  FNuxiePurchaseLatencyStats GetStats(EKind Kind) const;
+  void Reset();
+
+  /**
+   * A request expires here a second before the platform SDK fails it, so a result claimed in time
+   * still finds the native request waiting after the hop to the game thread.
+   */
+  static constexpr double ExpireAfterSeconds = TimeoutSeconds - 1.0;
+  static_assert(ExpireAfterSeconds > 0.0 && ExpireAfterSeconds <= TimeoutSeconds, "Requests must expire no later than the platform SDK fails them.");
+
+private:
+  struct FPending
+  {
+    EKind Kind = EKind::Purchase;
+    double BeganAtSeconds = 0.0;
+  };
+
+  struct FKindStats
+  {
+    FNuxiePurchaseLatencyStats Stats;
+    double TotalLatencyMs = 0.0;
+  };
+
+  static bool IsExpired(const FPending& Pending, double NowSeconds);
+
+  FKindStats& GetKindStats(EKind Kind);
+  const FKindStats& GetKindStats(EKind Kind) const;
+
+  const FPurchaseSink PurchaseSink;
+  const FRestoreSink RestoreSink;
+
+  mutable FCriticalSection Mutex;
+  TMap<FString, FPending> PendingById;
+  FKindStats PurchaseStats;
+  FKindStats RestoreStats;
+};
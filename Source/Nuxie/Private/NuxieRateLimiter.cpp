@@ -0,0 +1,260 @@
+#include "NuxieRateLimiter.h"
+
+namespace
+{
+  const FNuxieName WildcardKey(TEXT("*"));
+}
+
+void FNuxieRateLimiter::SetRules(const TArray<FNuxieRateLimitRule>& InRules, double NowSeconds)
+{
+  // Calls already waiting keep their place if their rule survives; otherwise they are lost.
+  TArray<FBucket> Previous = MoveTemp(Buckets);
+  Buckets.Reset();
+  TriggerBuckets.Reset();
+  FeatureBuckets.Reset();
+
+  for (const FNuxieRateLimitRule& Rule : InRules)
+  {
+    if (Rule.Key.IsEmpty())
+    {
+      continue;
+    }
+
+    TMap<FNuxieName, int32>& Index = Rule.Target == ENuxieRateLimitTarget::Trigger ? TriggerBuckets : FeatureBuckets;
+    const FNuxieName Key(Rule.Key);
+    FBucket* Bucket = nullptr;
+    if (const int32* Existing = Index.Find(Key))
+    {
+      Bucket = &Buckets[*Existing];
+    }
+    else
+    {
+      Index.Add(Key, Buckets.Num());
+      Bucket = &Buckets.AddDefaulted_GetRef();
+      Bucket->Tokens = FMath::Max(Rule.Burst, 1);
+      Bucket->LastRefillSeconds = NowSeconds;
+    }
+    Bucket->Rule = Rule;
+  }
+
+  for (FBucket& Old : Previous)
+  {
+    if (FBucket* Bucket = FindBucket(Old.Rule.Target, Old.Rule.Key))
+    {
+      if (Bucket->Rule.Key.Equals(Old.Rule.Key, ESearchCase::CaseSensitive))
+      {
+        Bucket->Tokens = FMath::Min<double>(Old.Tokens, Bucket->Rule.Burst);
+        Bucket->LastRefillSeconds = Old.LastRefillSeconds;
+        Bucket->Deferred = MoveTemp(Old.Deferred);
+      }
+    }
+  }
+}
+
+FNuxieRateLimiter::EAdmission FNuxieRateLimiter::AdmitTrigger(
+  const FString& EventName,
+  FNuxiePropertyBag& Properties,
+  const FNuxieTriggerOptions& Options,
+  double NowSeconds,
+  FString& InOutRequestId)
+{
+  FBucket* Bucket = FindBucket(ENuxieRateLimitTarget::Trigger, EventName);
+  if (Bucket == nullptr)
+  {
+    return EAdmission::Admitted;
+  }
+
+  const EAdmission Admission = Admit(*Bucket, NowSeconds);
+  if (Admission != EAdmission::Deferred)
+  {
+    return Admission;
+  }
+
+  if (Bucket->Rule.Policy == ENuxieRateLimitPolicy::Coalesce)
+  {
+    for (const FDeferred& Waiting : Bucket->Deferred)
+    {
+      const FDeferredTrigger* Trigger = Waiting.TryGet<FDeferredTrigger>();
+      if (Trigger != nullptr && Trigger->EventName.Equals(EventName, ESearchCase::CaseSensitive))
+      {
+        InOutRequestId = Trigger->RequestId;
+        ++Stats.Deferred;
+        return EAdmission::Coalesced;
+      }
+    }
+  }
+
+  if (Bucket->Deferred.Num() >= Bucket->Rule.MaxDeferred)
+  {
+    ++Stats.Dropped;
+    return EAdmission::Dropped;
+  }
+
+  FDeferredTrigger Trigger;
+  Trigger.RequestId = InOutRequestId;
+  Trigger.EventName = EventName;
+  Trigger.Properties = MoveTemp(Properties);
+  Trigger.Options = Options;
+  Trigger.Options.Properties.Empty();
+  Bucket->Deferred.Emplace(TInPlaceType<FDeferredTrigger>(), MoveTemp(Trigger));
+  ++Stats.Deferred;
+  return EAdmission::Deferred;
+}
+
+FNuxieRateLimiter::EAdmission FNuxieRateLimiter::AdmitUse(
+  const FString& FeatureId,
+  float Amount,
+  const FString& EntityId,
+  FNuxiePropertyBag& Metadata,
+  double NowSeconds)
+{
+  FBucket* Bucket = FindBucket(ENuxieRateLimitTarget::Feature, FeatureId);
+  if (Bucket == nullptr)
+  {
+    return EAdmission::Admitted;
+  }
+
+  const EAdmission Admission = Admit(*Bucket, NowSeconds);
+  if (Admission != EAdmission::Deferred)
+  {
+    return Admission;
+  }
+
+  if (Bucket->Rule.Policy == ENuxieRateLimitPolicy::Coalesce)
+  {
+    for (FDeferred& Waiting : Bucket->Deferred)
+    {
+      FDeferredUse* Use = Waiting.TryGet<FDeferredUse>();
+      if (Use != nullptr && Use->FeatureId.Equals(FeatureId, ESearchCase::CaseSensitive) && Use->EntityId.Equals(EntityId, ESearchCase::CaseSensitive))
+      {
+        Use->Amount += Amount;
+        Use->Metadata.AppendMissing(Metadata);
+        ++Stats.Deferred;
+        return EAdmission::Coalesced;
+      }
+    }
+  }
+
+  if (Bucket->Deferred.Num() >= Bucket->Rule.MaxDeferred)
+  {
+    ++Stats.Dropped;
+    return EAdmission::Dropped;
+  }
+
+  FDeferredUse Use;
+  Use.FeatureId = FeatureId;
+  Use.Amount = Amount;
+  Use.EntityId = EntityId;
+  Use.Metadata = MoveTemp(Metadata);
+  Bucket->Deferred.Emplace(TInPlaceType<FDeferredUse>(), MoveTemp(Use));
+  ++Stats.Deferred;
+  return EAdmission::Deferred;
+}
+
+void FNuxieRateLimiter::Drain(double NowSeconds, TArray<FDeferred>& OutReady)
+{
+  for (FBucket& Bucket : Buckets)
+  {
+    if (Bucket.Deferred.Num() == 0)
+    {
+      continue;
+    }
+
+    Refill(Bucket, NowSeconds);
+    const int32 NumReady = FMath::Min(Bucket.Deferred.Num(), FMath::FloorToInt(Bucket.Tokens));
+    for (int32 Index = 0; Index < NumReady; ++Index)
+    {
+      OutReady.Add(MoveTemp(Bucket.Deferred[Index]));
+    }
+    Bucket.Deferred.RemoveAt(0, NumReady);
+    Bucket.Tokens -= NumReady;
+  }
+}
+
+bool FNuxieRateLimiter::CancelDeferred(const FString& RequestId)
+{
+  for (FBucket& Bucket : Buckets)
+  {
+    const int32 NumRemoved = Bucket.Deferred.RemoveAll([&RequestId](const FDeferred& Waiting)
+    {
+      const FDeferredTrigger* Trigger = Waiting.TryGet<FDeferredTrigger>();
+      return Trigger != nullptr && Trigger->RequestId == RequestId;
+    });
+    if (NumRemoved > 0)
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+void FNuxieRateLimiter::DiscardDeferred(TArray<FString>& OutRequestIds)
+{
+  for (FBucket& Bucket : Buckets)
+  {
+    for (const FDeferred& Waiting : Bucket.Deferred)
+    {
+      if (const FDeferredTrigger* Trigger = Waiting.TryGet<FDeferredTrigger>())
+      {
+        OutRequestIds.Add(Trigger->RequestId);
+      }
+    }
+    Bucket.Deferred.Reset();
+  }
+}
+
+bool FNuxieRateLimiter::HasDeferred() const
+{
+  return Buckets.ContainsByPredicate([](const FBucket& Bucket) { return Bucket.Deferred.Num() > 0; });
+}
+
+const FNuxieRateLimitStats& FNuxieRateLimiter::GetStats() const
+{
+  return Stats;
+}
+
+FNuxieRateLimiter::FBucket* FNuxieRateLimiter::FindBucket(ENuxieRateLimitTarget Target, const FString& Key)
+{
+  const TMap<FNuxieName, int32>& Index = Target == ENuxieRateLimitTarget::Trigger ? TriggerBuckets : FeatureBuckets;
+  if (Index.Num() == 0)
+  {
+    return nullptr;
+  }
+
+  const FNuxieName Name(Key, FNAME_Find);
+  const int32* BucketIndex = Name.IsNone() ? nullptr : Index.Find(Name);
+  if (BucketIndex == nullptr)
+  {
+    BucketIndex = Index.Find(WildcardKey);
+  }
+  return BucketIndex != nullptr ? &Buckets[*BucketIndex] : nullptr;
+}
+
+void FNuxieRateLimiter::Refill(FBucket& Bucket, double NowSeconds)
+{
+  const double Elapsed = FMath::Max(0.0, NowSeconds - Bucket.LastRefillSeconds);
+  Bucket.Tokens = FMath::Min<double>(Bucket.Rule.Burst, Bucket.Tokens + Elapsed * Bucket.Rule.TokensPerSecond);
+  Bucket.LastRefillSeconds = NowSeconds;
+}
+
+FNuxieRateLimiter::EAdmission FNuxieRateLimiter::Admit(FBucket& Bucket, double NowSeconds)
+{
+  Refill(Bucket, NowSeconds);
+
+  // Calls already waiting go first, so a fresh token does not let a new call overtake them.
+  if (Bucket.Deferred.Num() == 0 && Bucket.Tokens >= 1.0)
+  {
+    Bucket.Tokens -= 1.0;
+    ++Stats.Admitted;
+    return EAdmission::Admitted;
+  }
+
+  if (Bucket.Rule.Policy == ENuxieRateLimitPolicy::Drop)
+  {
+    ++Stats.Dropped;
+    return EAdmission::Dropped;
+  }
+
+  // Counted by the caller once it knows whether the call fits in the queue.
+  return EAdmission::Deferred;
+}
@@ -0,0 +1,92 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Misc/TVariant.h"
+#include "NuxieName.h"
+#include "NuxiePropertyBag.h"
+#include "NuxieTypes.h"
+
+/**
+ * Token-bucket admission control for StartTrigger and UseFeature.
+ *
+ * Calls without a matching rule are always admitted and not counted. A deferred call waits in
+ * its rule's FIFO and is handed back by Drain once a token is available; later calls for the same
+ * rule queue behind it rather than overtaking it. Keys and IDs match case-sensitively. Game thread only.
+ */
+class FNuxieRateLimiter
+{
+public:
+  enum class EAdmission : uint8
+  {
+    Admitted,
+    Deferred,
+    /** Merged into a call that is already deferred (ENuxieRateLimitPolicy::Coalesce). */
+    Coalesced,
+    Dropped
+  };
+
+  struct FDeferredTrigger
+  {
+    FString RequestId;
+    FString EventName;
+    /** Sent instead of Options.Properties, which is left empty. */
+    FNuxiePropertyBag Properties;
+    FNuxieTriggerOptions Options;
+  };
+
+  struct FDeferredUse
+  {
+    FString FeatureId;
+    float Amount = 0.0f;
+    FString EntityId;
+    FNuxiePropertyBag Metadata;
+  };
+
+  using FDeferred = TVariant<FDeferredTrigger, FDeferredUse>;
+
+  void SetRules(const TArray<FNuxieRateLimitRule>& InRules, double NowSeconds);
+
+  /**
+   * On Coalesced, InOutRequestId is replaced by the waiting request it was merged into. Properties
+   * is moved from only when the call is queued as a new deferral.
+   */
+  EAdmission AdmitTrigger(const FString& EventName, FNuxiePropertyBag& Properties, const FNuxieTriggerOptions& Options, double NowSeconds, FString& InOutRequestId);
+
+  /**
+   * On Coalesced, Amount is added to a waiting use of the same feature and entity, and its metadata
+   * gains the keys it did not have. Metadata is moved from only when the call is queued as a new deferral.
+   */
+  EAdmission AdmitUse(const FString& FeatureId, float Amount, const FString& EntityId, FNuxiePropertyBag& Metadata, double NowSeconds);
+
+  /** Moves every deferred call that now has a token into OutReady, oldest first per rule. */
+  void Drain(double NowSeconds, TArray<FDeferred>& OutReady);
+
+  /** Removes a trigger start that is still waiting. Returns false when it is not deferred. */
+  bool CancelDeferred(const FString& RequestId);
+
+  /** Discards deferred calls; returns the request ids of discarded triggers. */
+  void DiscardDeferred(TArray<FString>& OutRequestIds);
+
+  bool HasDeferred() const;
+  const FNuxieRateLimitStats& GetStats() const;
+
+private:
+  struct FBucket
+  {
+    FNuxieRateLimitRule Rule;
+    double Tokens = 0.0;
+    double LastRefillSeconds = 0.0;
+    TArray<FDeferred> Deferred;
+  };
+
+  /** Keys are interned once in SetRules; a call whose key was never interned can only hit the wildcard. */
+  FBucket* FindBucket(ENuxieRateLimitTarget Target, const FString& Key);
+  static void Refill(FBucket& Bucket, double NowSeconds);
+  EAdmission Admit(FBucket& Bucket, double NowSeconds);
+
+  TArray<FBucket> Buckets;
+  TMap<FNuxieName, int32> TriggerBuckets;
+  TMap<FNuxieName, int32> FeatureBuckets;
+  FNuxieRateLimitStats Stats;
+};
@@ -0,0 +1,33 @@
+#include "NuxieRequestIdGenerator.h"
+
+#include "Misc/Guid.h"
+
+FNuxieRequestIdGenerator::FNuxieRequestIdGenerator()
+{
+  const FString Digits = FGuid::NewGuid().ToString(EGuidFormats::Digits).ToLower();
+  check(Digits.Len() == PrefixLength);
+  FMemory::Memcpy(Prefix, *Digits, PrefixLength * sizeof(TCHAR));
+}
+
+void FNuxieRequestIdGenerator::Next(FString& OutRequestId)
+{
+  const uint64 Value = Counter.fetch_add(1, std::memory_order_relaxed) + 1;
+
+  TCHAR Digits[16];
+  int32 NumDigits = 0;
+  uint64 Remaining = Value;
+  do
+  {
+    Digits[NumDigits++] = TEXT("0123456789abcdef")[Remaining & 0xF];
+    Remaining >>= 4;
+  }
+  while (Remaining != 0);
+
+  OutRequestId.Reset(PrefixLength + 1 + NumDigits);
+  OutRequestId.Append(Prefix, PrefixLength);
+  OutRequestId.AppendChar(TEXT('-'));
+  while (NumDigits > 0)
+  {
+    OutRequestId.AppendChar(Digits[--NumDigits]);
+  }
+}
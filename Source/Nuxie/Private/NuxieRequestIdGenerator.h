@@ -0,0 +1,27 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include <atomic>
+
+/**
+ * Trigger request ids: a random prefix drawn once per subsystem, then a counter.
+ *
+ * The prefix is a GUID, so ids stay unique across sessions and installs. Each id after that costs
+ * one atomic increment and a few characters of formatting, where FGuid::NewGuid asks the platform
+ * for randomness and formats 36 characters per call. Any thread.
+ */
+class FNuxieRequestIdGenerator
+{
+public:
+  FNuxieRequestIdGenerator();
+
+  /** Writes the next id into OutRequestId, reusing its allocation when it is large enough. */
+  void Next(FString& OutRequestId);
+
+private:
+  static constexpr int32 PrefixLength = 32;
+
+  TCHAR Prefix[PrefixLength];
+  std::atomic<uint64> Counter { 0 };
+};
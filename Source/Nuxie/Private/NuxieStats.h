@@ -0,0 +1,5 @@
+#pragma once
+
+#include "Stats/Stats.h"
+
+DECLARE_STATS_GROUP(TEXT("Nuxie"), STATGROUP_Nuxie, STATCAT_Advanced);
@@ -0,0 +1,114 @@
+#include "NuxieSubmissionQueue.h"
+
+#include "Async/Async.h"
+#include "Misc/ScopeLock.h"
+#include "NuxieEventJournal.h"
+
+FNuxieSubmissionQueue::FNuxieSubmissionQueue(
+  INuxiePlatformBridge* InBridge,
+  INuxiePlatformBridgeListener* InListener,
+  TSharedPtr<FNuxieEventJournal, ESPMode::ThreadSafe> InJournal)
+  : Bridge(InBridge)
+  , Listener(InListener)
+  , Journal(MoveTemp(InJournal))
+{
+}
+
+bool FNuxieSubmissionQueue::Push(FSubmission&& Submission)
+{
+  if (bShutDown.load(std::memory_order_acquire))
+  {
+    return false;
+  }
+
+  PendingCount.fetch_add(1, std::memory_order_relaxed);
+  Queue.Enqueue(MoveTemp(Submission));
+
+  // Whoever flips the flag owns the single consumer slot until Drain hands it back.
+  if (!bDrainScheduled.exchange(true, std::memory_order_acq_rel))
+  {
+    Async(EAsyncExecution::ThreadPool, [WeakThis = AsWeak()]()
+    {
+      if (const TSharedPtr<FNuxieSubmissionQueue, ESPMode::ThreadSafe> This = WeakThis.Pin())
+      {
+        This->Drain();
+      }
+    });
+  }
+  return true;
+}
+
+void FNuxieSubmissionQueue::Shutdown()
+{
+  // A push that read the flag just before this still lands; the drain finds no bridge and drops it.
+  bShutDown.store(true, std::memory_order_release);
+  FScopeLock Lock(&BridgeMutex);
+  Bridge = nullptr;
+  Listener = nullptr;
+  Journal.Reset();
+}
+
+int32 FNuxieSubmissionQueue::GetPendingCount() const
+{
+  return PendingCount.load(std::memory_order_relaxed);
+}
+
+void FNuxieSubmissionQueue::Drain()
+{
+  for (;;)
+  {
+    FSubmission Submission;
+    while (Queue.Dequeue(Submission))
+    {
+      Execute(Submission);
+      PendingCount.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    bDrainScheduled.store(false, std::memory_order_release);
+
+    // A producer may have pushed after the last Dequeue but seen the flag still set; reclaim the
+    // consumer slot for it unless another drain has already been scheduled.
+    if (Queue.IsEmpty() || bDrainScheduled.exchange(true, std::memory_order_acq_rel))
+    {
+      return;
+    }
+  }
+}
+
+void FNuxieSubmissionQueue::Execute(FSubmission& Submission)
+{
+  FScopeLock Lock(&BridgeMutex);
+  if (Bridge == nullptr)
+  {
+    return;
+  }
+
+  FNuxieError Error;
+  if (FUseFeature* UseFeature = Submission.TryGet<FUseFeature>())
+  {
+    // The journal stores strings; convert before the bag is moved into the bridge.
+    const bool bJournal = Journal.IsValid() && Journal->IsOpen();
+    const TMap<FString, FString> JournalMetadata = bJournal ? UseFeature->Metadata.ToStringMap() : TMap<FString, FString>();
+    if (Bridge->UseFeature(UseFeature->FeatureId, UseFeature->Amount, UseFeature->EntityId, MoveTemp(UseFeature->Metadata), Error) && bJournal)
+    {
+      Journal->AppendUseFeature(UseFeature->FeatureId, UseFeature->Amount, UseFeature->EntityId, JournalMetadata);
+    }
+  }
+  else if (FStartTrigger* StartTrigger = Submission.TryGet<FStartTrigger>())
+  {
+    if (!Bridge->StartTrigger(StartTrigger->RequestId, StartTrigger->EventName, MoveTemp(StartTrigger->Properties), StartTrigger->Options, Error) && Listener != nullptr)
+    {
+      // The caller already holds the request id, so a rejected start still ends that request.
+      FNuxieTriggerUpdate Update;
+      Update.Kind = ENuxieTriggerUpdateKind::Error;
+      Update.Error = Error;
+      Update.TimestampMs = FDateTime::UtcNow().ToUnixTimestamp() * 1000;
+      Update.bIsTerminal = true;
+      Listener->OnTriggerUpdate(StartTrigger->RequestId, Update);
+    }
+  }
+  else if (FIdentify* Identify = Submission.TryGet<FIdentify>())
+  {
+    Bridge->Identify(Identify->DistinctId, MoveTemp(Identify->UserProperties), MoveTemp(Identify->UserPropertiesSetOnce), Error);
+  }
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Containers/Queue.h"
+#include "HAL/CriticalSection.h"
+#include "Misc/TVariant.h"
+#include "NuxiePlatformBridge.h"
+#include "Templates/SharedPointer.h"
+
+#include <atomic>
+
+/**
+ * Multi-producer, single-consumer queue for fire-and-forget bridge calls made off the game thread.
+ *
+ * Producers push without taking a lock. A single pool task drains the queue and calls the bridge,
+ * so the native SDK only ever sees one submitting thread at a time.
+ *
+ * Ordering: submissions pushed by one thread reach the bridge in the order that thread pushed them.
+ * Submissions from different threads interleave in the order their pushes complete. Queued
+ * submissions are not ordered against direct (synchronous) subsystem calls.
+ *
+ * UseFeature submissions the bridge accepts are appended to the event journal by the consumer, so
+ * producers never wait on its lock or its file write.
+ */
+class FNuxieSubmissionQueue final : public TSharedFromThis<FNuxieSubmissionQueue, ESPMode::ThreadSafe>
+{
+public:
+  struct FUseFeature
+  {
+    FString FeatureId;
+    float Amount = 1.0f;
+    FString EntityId;
+    FNuxiePropertyBag Metadata;
+  };
+
+  struct FStartTrigger
+  {
+    FString RequestId;
+    FString EventName;
+    FNuxiePropertyBag Properties;
+    FNuxieTriggerOptions Options;
+  };
+
+  struct FIdentify
+  {
+    FString DistinctId;
+    FNuxiePropertyBag UserProperties;
+    FNuxiePropertyBag UserPropertiesSetOnce;
+  };
+
+  using FSubmission = TVariant<FUseFeature, FStartTrigger, FIdentify>;
+
+  FNuxieSubmissionQueue(
+    INuxiePlatformBridge* InBridge,
+    INuxiePlatformBridgeListener* InListener,
+    TSharedPtr<class FNuxieEventJournal, ESPMode::ThreadSafe> InJournal);
+
+  /** Any thread. Returns false, dropping the submission, once Shutdown has been called. */
+  bool Push(FSubmission&& Submission);
+
+  /**
+   * Detaches the bridge, waiting for an in-flight call to return. Anything still queued is dropped,
+   * and later pushes are rejected. The queue itself stays valid for producers that still hold it.
+   */
+  void Shutdown();
+
+  int32 GetPendingCount() const;
+
+private:
+  void Drain();
+  void Execute(FSubmission& Submission);
+
+  TQueue<FSubmission, EQueueMode::Mpsc> Queue;
+  std::atomic<int32> PendingCount { 0 };
+  std::atomic<bool> bDrainScheduled { false };
+  std::atomic<bool> bShutDown { false };
+
+  FCriticalSection BridgeMutex;
+  INuxiePlatformBridge* Bridge = nullptr;
+  INuxiePlatformBridgeListener* Listener = nullptr;
+  TSharedPtr<class FNuxieEventJournal, ESPMode::ThreadSafe> Journal;
+};
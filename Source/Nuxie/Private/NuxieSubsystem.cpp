@@ -2,8 +2,193 @@
 
 #include "Async/Async.h"
 #include "Engine/Engine.h"
-#include "Misc/Guid.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/ConfigCacheIni.h"
+#include "Misc/Paths.h"
+#include "NuxieAsyncQueue.h"
+#include "NuxieBalanceLedger.h"
+#include "NuxieCampaignEventIndex.h"
+#include "NuxieEntitlementEvaluator.h"
+#include "NuxieEventJournal.h"
+#include "NuxieFeatureCheckCache.h"
+#include "NuxieFeatureSubscriptions.h"
+#include "NuxieFlushScheduler.h"
+#include "NuxieIdentifyDiffer.h"
+#include "NuxieName.h"
 #include "NuxiePlatformBridge.h"
+#include "NuxiePurchaseTracker.h"
+#include "NuxieRateLimiter.h"
+#include "NuxieRequestIdGenerator.h"
+#include "NuxieStats.h"
+#include "NuxieSubmissionQueue.h"
+#include "NuxieTriggerDebouncer.h"
+#include "NuxieTriggerRegistry.h"
+
+DECLARE_CYCLE_STAT(TEXT("Dispatch Trigger Update"), STAT_NuxieDispatchTriggerUpdate, STATGROUP_Nuxie);
+DECLARE_CYCLE_STAT(TEXT("Dispatch Feature Access Change"), STAT_NuxieDispatchFeatureAccess, STATGROUP_Nuxie);
+DECLARE_CYCLE_STAT(TEXT("Dispatch Purchase Request"), STAT_NuxieDispatchPurchase, STATGROUP_Nuxie);
+DECLARE_CYCLE_STAT(TEXT("Dispatch Flow Event"), STAT_NuxieDispatchFlow, STATGROUP_Nuxie);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Blueprint Broadcasts"), STAT_NuxieBlueprintBroadcasts, STATGROUP_Nuxie);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Blueprint Broadcasts Skipped"), STAT_NuxieBlueprintBroadcastsSkipped, STATGROUP_Nuxie);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Balance Corrections"), STAT_NuxieBalanceCorrections, STATGROUP_Nuxie);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Trigger Bridge Calls Saved"), STAT_NuxieTriggersResolvedLocally, STATGROUP_Nuxie);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Trigger Starts Coalesced"), STAT_NuxieTriggersCoalesced, STATGROUP_Nuxie);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Active Triggers"), STAT_NuxieActiveTriggers, STATGROUP_Nuxie);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Trigger Timeouts"), STAT_NuxieTriggerTimeouts, STATGROUP_Nuxie);
+DECLARE_MEMORY_STAT(TEXT("Active Trigger Memory"), STAT_NuxieActiveTriggerMemory, STATGROUP_Nuxie);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Rate Limit Admitted"), STAT_NuxieRateLimitAdmitted, STATGROUP_Nuxie);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Rate Limit Dropped"), STAT_NuxieRateLimitDropped, STATGROUP_Nuxie);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Rate Limit Deferred"), STAT_NuxieRateLimitDeferred, STATGROUP_Nuxie);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Last Flush Latency (ms)"), STAT_NuxieLastFlushLatency, STATGROUP_Nuxie);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Flushed Bytes (approx)"), STAT_NuxieFlushedBytes, STATGROUP_Nuxie);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Journal Records Replayed"), STAT_NuxieJournalReplayed, STATGROUP_Nuxie);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Identify Calls Suppressed"), STAT_NuxieIdentifySuppressed, STATGROUP_Nuxie);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Identify Calls Merged"), STAT_NuxieIdentifyMerged, STATGROUP_Nuxie);
+
+namespace
+{
+  // How often journaled uses are checked against the native queue, which flushes on its own.
+  constexpr float EventJournalAckIntervalSeconds = 5.0f;
+
+  // Dynamic multicast delegates marshal every parameter through UFunction reflection per bound
+  // script listener, so only pay for it when something is actually bound.
+  template <typename EventType, typename... ArgTypes>
+  void BroadcastIfBound(EventType& Event, const ArgTypes&... Args)
+  {
+    if (!Event.IsBound())
+    {
+      INC_DWORD_STAT(STAT_NuxieBlueprintBroadcastsSkipped);
+      return;
+    }
+
+    INC_DWORD_STAT(STAT_NuxieBlueprintBroadcasts);
+    Event.Broadcast(Args...);
+  }
+
+  bool IsSameAccess(const FNuxieFeatureAccess& A, const FNuxieFeatureAccess& B)
+  {
+    return A.bAllowed == B.bAllowed
+      && A.bUnlimited == B.bUnlimited
+      && A.bHasBalance == B.bHasBalance
+      && A.Balance == B.Balance
+      && A.Type == B.Type;
+  }
+
+  void PublishRateLimitStats(const FNuxieRateLimitStats& Stats)
+  {
+    SET_DWORD_STAT(STAT_NuxieRateLimitAdmitted, Stats.Admitted);
+    SET_DWORD_STAT(STAT_NuxieRateLimitDropped, Stats.Dropped);
+    SET_DWORD_STAT(STAT_NuxieRateLimitDeferred, Stats.Deferred);
+  }
+
+  void LoadIniRateLimits(TArray<FNuxieRateLimitRule>& OutRules)
+  {
+    TArray<FString> Lines;
+    GConfig->GetArray(TEXT("/Script/Nuxie.NuxieSubsystem"), TEXT("RateLimits"), Lines, GGameIni);
+    for (const FString& Line : Lines)
+    {
+      FNuxieRateLimitRule Rule;
+      if (FNuxieRateLimitRule::StaticStruct()->ImportText(*Line, &Rule, nullptr, PPF_None, GLog, TEXT("RateLimits")) != nullptr)
+      {
+        OutRules.Add(MoveTemp(Rule));
+      }
+    }
+  }
+
+  void OnRuntimeConsoleVariableChanged(IConsoleVariable* Variable);
+
+  TAutoConsoleVariable<int32> CVarNuxieBatchSize(
+    TEXT("nuxie.BatchSize"),
+    -1,
+    TEXT("Overrides the Nuxie event batch size of the running session. -1 keeps the configured value."),
+    FConsoleVariableDelegate::CreateStatic(&OnRuntimeConsoleVariableChanged));
+
+  TAutoConsoleVariable<int32> CVarNuxieFlushAt(
+    TEXT("nuxie.FlushAt"),
+    -1,
+    TEXT("Overrides the number of queued Nuxie events that triggers a flush. -1 keeps the configured value."),
+    FConsoleVariableDelegate::CreateStatic(&OnRuntimeConsoleVariableChanged));
+
+  TAutoConsoleVariable<int32> CVarNuxieFlushIntervalSeconds(
+    TEXT("nuxie.FlushIntervalSeconds"),
+    -1,
+    TEXT("Overrides the Nuxie periodic flush interval in seconds. -1 keeps the configured value."),
+    FConsoleVariableDelegate::CreateStatic(&OnRuntimeConsoleVariableChanged));
+
+  TAutoConsoleVariable<int32> CVarNuxieMaxQueueSize(
+    TEXT("nuxie.MaxQueueSize"),
+    -1,
+    TEXT("Overrides the maximum number of queued Nuxie events. -1 keeps the configured value."),
+    FConsoleVariableDelegate::CreateStatic(&OnRuntimeConsoleVariableChanged));
+
+  TAutoConsoleVariable<int32> CVarNuxieRetryCount(
+    TEXT("nuxie.RetryCount"),
+    -1,
+    TEXT("Overrides the Nuxie network retry count. -1 keeps the configured value."),
+    FConsoleVariableDelegate::CreateStatic(&OnRuntimeConsoleVariableChanged));
+
+  TAutoConsoleVariable<int32> CVarNuxieRequestTimeoutSeconds(
+    TEXT("nuxie.RequestTimeoutSeconds"),
+    -1,
+    TEXT("Overrides the Nuxie network request timeout in seconds. -1 keeps the configured value."),
+    FConsoleVariableDelegate::CreateStatic(&OnRuntimeConsoleVariableChanged));
+
+  void ApplyConsoleOverride(const TAutoConsoleVariable<int32>& Variable, int32& InOutValue)
+  {
+    const int32 Value = Variable.GetValueOnGameThread();
+    if (Value >= 0)
+    {
+      InOutValue = Value;
+    }
+  }
+
+  void ApplyConsoleOverrides(FNuxieRuntimeOptions& Options)
+  {
+    ApplyConsoleOverride(CVarNuxieBatchSize, Options.EventBatchSize);
+    ApplyConsoleOverride(CVarNuxieFlushAt, Options.FlushAt);
+    ApplyConsoleOverride(CVarNuxieFlushIntervalSeconds, Options.FlushIntervalSeconds);
+    ApplyConsoleOverride(CVarNuxieMaxQueueSize, Options.MaxQueueSize);
+    ApplyConsoleOverride(CVarNuxieRetryCount, Options.RetryCount);
+    ApplyConsoleOverride(CVarNuxieRequestTimeoutSeconds, Options.RequestTimeoutSeconds);
+  }
+
+  void OnRuntimeConsoleVariableChanged(IConsoleVariable* Variable)
+  {
+    if (GEngine == nullptr)
+    {
+      return;
+    }
+
+    for (const FWorldContext& Context : GEngine->GetWorldContexts())
+    {
+      UNuxieSubsystem* Subsystem = Context.OwningGameInstance != nullptr ? Context.OwningGameInstance->GetSubsystem<UNuxieSubsystem>() : nullptr;
+      if (Subsystem != nullptr && Subsystem->GetIsConfigured())
+      {
+        FNuxieError IgnoreError;
+        Subsystem->ReapplyRuntimeOptions(IgnoreError);
+      }
+    }
+  }
+
+  void ListTriggers(const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+  {
+    UGameInstance* GameInstance = World != nullptr ? World->GetGameInstance() : nullptr;
+    UNuxieSubsystem* Subsystem = GameInstance != nullptr ? GameInstance->GetSubsystem<UNuxieSubsystem>() : nullptr;
+    if (Subsystem == nullptr)
+    {
+      Ar.Log(TEXT("Nuxie subsystem is unavailable."));
+      return;
+    }
+    Subsystem->DumpActiveTriggers(Ar);
+  }
+
+  FAutoConsoleCommandWithWorldArgsAndOutputDevice ListTriggersCommand(
+    TEXT("nuxie.ListTriggers"),
+    TEXT("Lists in-flight Nuxie trigger requests with their age, last update and memory."),
+    FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateStatic(&ListTriggers));
+}
 
 class FNuxieBridgeListener final : public INuxiePlatformBridgeListener
 {
@@ -20,31 +205,64 @@ public:
       return;
     }
 
-    AsyncTask(ENamedThreads::GameThread, [Owner = Owner, RequestId, Update]()
+    NuxieRunOnGameThread([Owner = Owner, RequestId, Update]()
     {
       if (!Owner.IsValid())
       {
         return;
       }
+
+      SCOPE_CYCLE_COUNTER(STAT_NuxieDispatchTriggerUpdate);
+      if (Owner->TriggerDebouncer != nullptr && (Update.bIsTerminal || Nuxie::FTriggerContract::IsTerminal(Update)))
+      {
+        Owner->TriggerDebouncer->OnTerminal(RequestId);
+      }
+      if (Owner->TriggerRegistry != nullptr)
+      {
+        Owner->TriggerRegistry->OnUpdate(RequestId, Update, FPlatformTime::Seconds());
+      }
+
       Owner->OnTriggerUpdateNative.Broadcast(RequestId, Update);
-      Owner->OnTriggerUpdate.Broadcast(RequestId, Update);
+      BroadcastIfBound(Owner->OnTriggerUpdate, RequestId, Update);
     });
   }
 
   virtual void OnFeatureAccessChanged(const FString& FeatureId, const FNuxieFeatureAccess& Previous, const FNuxieFeatureAccess& Current) override
   {
-    if (!Owner.IsValid())
+    FNuxieFeatureAccessChange Change;
+    Change.FeatureId = FeatureId;
+    Change.Previous = Previous;
+    Change.Current = Current;
+    OnFeatureAccessBatchChanged({ MoveTemp(Change) });
+  }
+
+  virtual void OnFeatureAccessBatchChanged(const TArray<FNuxieFeatureAccessChange>& Changes) override
+  {
+    if (!Owner.IsValid() || Changes.Num() == 0)
     {
       return;
     }
 
-    AsyncTask(ENamedThreads::GameThread, [Owner = Owner, FeatureId, Previous, Current]()
+    NuxieRunOnGameThread([Owner = Owner, Changes]()
     {
       if (!Owner.IsValid())
       {
         return;
       }
-      Owner->OnFeatureAccessChanged.Broadcast(FeatureId, Previous, Current);
+
+      SCOPE_CYCLE_COUNTER(STAT_NuxieDispatchFeatureAccess);
+      for (const FNuxieFeatureAccessChange& Change : Changes)
+      {
+        // Pushed changes are feature-level: they carry no entity.
+        if (Owner->FeatureCheckCache.IsValid())
+        {
+          Owner->FeatureCheckCache->ApplyAccessChange(Change.FeatureId, Change.Current);
+        }
+        Owner->ApplyFeatureAccessChange(Change, FString());
+      }
+
+      Owner->OnFeatureAccessBatchChangedNative.Broadcast(Changes);
+      BroadcastIfBound(Owner->OnFeatureAccessBatchChanged, Changes);
     });
   }
 
@@ -55,16 +273,29 @@ public:
       return;
     }
 
-    AsyncTask(ENamedThreads::GameThread, [Owner = Owner, Request]()
+    NuxieRunOnGameThread([Owner = Owner, Request]()
     {
       if (!Owner.IsValid())
       {
         return;
       }
 
-      Owner->OnPurchaseRequest.Broadcast(Request);
+      SCOPE_CYCLE_COUNTER(STAT_NuxieDispatchPurchase);
+      if (Owner->PurchaseTracker.IsValid())
+      {
+        Owner->PurchaseTracker->Begin(Request.RequestId, FNuxiePurchaseTracker::EKind::Purchase);
+      }
+      Owner->OnPurchaseRequestNative.Broadcast(Request);
+      BroadcastIfBound(Owner->OnPurchaseRequest, Request);
 
-      if (Owner->PurchaseController.GetObject() != nullptr)
+      if (Owner->AsyncPurchaseController.GetObject() != nullptr)
+      {
+        FNuxiePurchaseCompletion Completion;
+        Completion.RequestId = Request.RequestId;
+        Completion.Tracker = Owner->PurchaseTracker;
+        INuxieAsyncPurchaseController::Execute_OnPurchaseRequestedAsync(Owner->AsyncPurchaseController.GetObject(), Request, Completion);
+      }
+      else if (Owner->PurchaseController.GetObject() != nullptr)
       {
         FNuxiePurchaseResult Result = INuxiePurchaseController::Execute_OnPurchaseRequested(Owner->PurchaseController.GetObject(), Request);
         FNuxieError CompletionError;
@@ -80,16 +311,29 @@ public:
       return;
     }
 
-    AsyncTask(ENamedThreads::GameThread, [Owner = Owner, Request]()
+    NuxieRunOnGameThread([Owner = Owner, Request]()
     {
       if (!Owner.IsValid())
       {
         return;
       }
 
-      Owner->OnRestoreRequest.Broadcast(Request);
+      SCOPE_CYCLE_COUNTER(STAT_NuxieDispatchPurchase);
+      if (Owner->PurchaseTracker.IsValid())
+      {
+        Owner->PurchaseTracker->Begin(Request.RequestId, FNuxiePurchaseTracker::EKind::Restore);
+      }
+      Owner->OnRestoreRequestNative.Broadcast(Request);
+      BroadcastIfBound(Owner->OnRestoreRequest, Request);
 
-      if (Owner->PurchaseController.GetObject() != nullptr)
+      if (Owner->AsyncPurchaseController.GetObject() != nullptr)
+      {
+        FNuxieRestoreCompletion Completion;
+        Completion.RequestId = Request.RequestId;
+        Completion.Tracker = Owner->PurchaseTracker;
+        INuxieAsyncPurchaseController::Execute_OnRestoreRequestedAsync(Owner->AsyncPurchaseController.GetObject(), Request, Completion);
+      }
+      else if (Owner->PurchaseController.GetObject() != nullptr)
       {
         FNuxieRestoreResult Result = INuxiePurchaseController::Execute_OnRestoreRequested(Owner->PurchaseController.GetObject(), Request);
         FNuxieError CompletionError;
@@ -105,13 +349,16 @@ public:
       return;
     }
 
-    AsyncTask(ENamedThreads::GameThread, [Owner = Owner, FlowId]()
+    NuxieRunOnGameThread([Owner = Owner, FlowId]()
     {
       if (!Owner.IsValid())
       {
         return;
       }
-      Owner->OnFlowPresented.Broadcast(FlowId);
+
+      SCOPE_CYCLE_COUNTER(STAT_NuxieDispatchFlow);
+      Owner->OnFlowPresentedNative.Broadcast(FlowId);
+      BroadcastIfBound(Owner->OnFlowPresented, FlowId);
     });
   }
 
@@ -122,13 +369,16 @@ public:
       return;
     }
 
-    AsyncTask(ENamedThreads::GameThread, [Owner = Owner, FlowId]()
+    NuxieRunOnGameThread([Owner = Owner, FlowId]()
     {
       if (!Owner.IsValid())
       {
         return;
       }
-      Owner->OnFlowDismissed.Broadcast(FlowId);
+
+      SCOPE_CYCLE_COUNTER(STAT_NuxieDispatchFlow);
+      Owner->OnFlowDismissedNative.Broadcast(FlowId);
+      BroadcastIfBound(Owner->OnFlowDismissed, FlowId);
     });
   }
 
@@ -141,30 +391,169 @@ UNuxieSubsystem::~UNuxieSubsystem() = default;
 void UNuxieSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
   Super::Initialize(Collection);
+  InitializeWith(CreateNuxiePlatformBridge(), FPaths::ProjectSavedDir() / TEXT("Nuxie"));
+}
 
-  Bridge = CreateNuxiePlatformBridge();
+void UNuxieSubsystem::InitializeWith(TUniquePtr<INuxiePlatformBridge> InBridge, const FString& StateDirectory)
+{
+  FeatureSubscriptions = new FNuxieFeatureSubscriptionIndex();
+  FeatureCheckCache = MakeShared<FNuxieFeatureCheckCache, ESPMode::ThreadSafe>();
+  EntitlementEvaluator = new FNuxieEntitlementEvaluator();
+  BalanceLedger = new FNuxieBalanceLedger(StateDirectory / TEXT("PendingUsage.json"));
+  BalanceLedger->Load();
+  EventJournal = MakeShared<FNuxieEventJournal, ESPMode::ThreadSafe>(StateDirectory / TEXT("Journal"));
+  CampaignEventIndex = new FNuxieCampaignEventIndex();
+  TriggerDebouncer = new FNuxieTriggerDebouncer();
+  TriggerRegistry = new FNuxieTriggerRegistry();
+  RateLimiter = new FNuxieRateLimiter();
+  IdentifyDiffer = new FNuxieIdentifyDiffer();
+  Bridge = MoveTemp(InBridge);
   BridgeListener = new FNuxieBridgeListener(this);
   Bridge->SetListener(BridgeListener);
+  SubmissionQueue = MakeShared<FNuxieSubmissionQueue, ESPMode::ThreadSafe>(Bridge.Get(), BridgeListener, EventJournal);
+  RequestIds = MakeShared<FNuxieRequestIdGenerator, ESPMode::ThreadSafe>();
+  PurchaseTracker = MakeShared<FNuxiePurchaseTracker, ESPMode::ThreadSafe>(
+    [WeakThis = TWeakObjectPtr<UNuxieSubsystem>(this)](const FString& RequestId, const FNuxiePurchaseResult& Result)
+    {
+      FNuxieError CompletionError;
+      UNuxieSubsystem* This = WeakThis.Get();
+      if (This != nullptr && This->EnsureBridge(CompletionError))
+      {
+        This->Bridge->CompletePurchase(RequestId, Result, CompletionError);
+      }
+    },
+    [WeakThis = TWeakObjectPtr<UNuxieSubsystem>(this)](const FString& RequestId, const FNuxieRestoreResult& Result)
+    {
+      FNuxieError CompletionError;
+      UNuxieSubsystem* This = WeakThis.Get();
+      if (This != nullptr && This->EnsureBridge(CompletionError))
+      {
+        This->Bridge->CompleteRestore(RequestId, Result, CompletionError);
+      }
+    });
+  FlushScheduler = MakeShared<FNuxieFlushScheduler>(this, [WeakThis = TWeakObjectPtr<UNuxieSubsystem>(this)](const FNuxieFlushReport& Report)
+  {
+    UNuxieSubsystem* This = WeakThis.Get();
+    if (This == nullptr)
+    {
+      return;
+    }
+
+    SET_FLOAT_STAT(STAT_NuxieLastFlushLatency, Report.LatencyMs);
+    INC_DWORD_STAT_BY(STAT_NuxieFlushedBytes, Report.ApproxBytes);
+    This->OnEventsFlushedNative.Broadcast(Report);
+    BroadcastIfBound(This->OnEventsFlushed, Report);
+  });
+  TriggerTimeoutTicker = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UNuxieSubsystem::TickTriggerTimeouts), 1.0f);
+  EventJournalTicker = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UNuxieSubsystem::TickEventJournal), EventJournalAckIntervalSeconds);
 }
 
 void UNuxieSubsystem::Deinitialize()
 {
+  FlushScheduler.Reset();
+  FTSTicker::GetCoreTicker().RemoveTicker(TriggerTimeoutTicker);
+  TriggerTimeoutTicker.Reset();
+  FTSTicker::GetCoreTicker().RemoveTicker(RateLimitDrainTicker);
+  RateLimitDrainTicker.Reset();
+  FTSTicker::GetCoreTicker().RemoveTicker(IdentifyFlushTicker);
+  IdentifyFlushTicker.Reset();
+  FTSTicker::GetCoreTicker().RemoveTicker(EventJournalTicker);
+  EventJournalTicker.Reset();
+  FlushPendingIdentify();
+
+  // Producers on other threads may still hold the subsystem, so the queue lives until the
+  // destructor; from here on it rejects their pushes.
+  if (SubmissionQueue.IsValid())
+  {
+    SubmissionQueue->Shutdown();
+  }
+
+  bool bShutDownCleanly = false;
   if (Bridge != nullptr)
   {
     FNuxieError IgnoreError;
-    Bridge->Shutdown(IgnoreError);
+    bShutDownCleanly = Bridge->Shutdown(IgnoreError);
     Bridge->SetListener(nullptr);
     Bridge.Reset();
   }
 
+  if (EventJournal.IsValid())
+  {
+    // Only a session that did not end cleanly leaves records for the next Configure to replay.
+    if (bShutDownCleanly)
+    {
+      EventJournal->Acknowledge(EventJournal->Seal());
+    }
+    EventJournal->Close();
+    EventJournal.Reset();
+  }
+
   if (BridgeListener != nullptr)
   {
     delete BridgeListener;
     BridgeListener = nullptr;
   }
 
+  if (FeatureSubscriptions != nullptr)
+  {
+    delete FeatureSubscriptions;
+    FeatureSubscriptions = nullptr;
+  }
+
+  FeatureCheckCache.Reset();
+
+  if (EntitlementEvaluator != nullptr)
+  {
+    delete EntitlementEvaluator;
+    EntitlementEvaluator = nullptr;
+  }
+
+  if (BalanceLedger != nullptr)
+  {
+    delete BalanceLedger;
+    BalanceLedger = nullptr;
+  }
+
+  if (CampaignEventIndex != nullptr)
+  {
+    delete CampaignEventIndex;
+    CampaignEventIndex = nullptr;
+  }
+
+  if (TriggerDebouncer != nullptr)
+  {
+    delete TriggerDebouncer;
+    TriggerDebouncer = nullptr;
+  }
+
+  if (TriggerRegistry != nullptr)
+  {
+    delete TriggerRegistry;
+    TriggerRegistry = nullptr;
+  }
+
+  if (RateLimiter != nullptr)
+  {
+    delete RateLimiter;
+    RateLimiter = nullptr;
+  }
+
+  if (IdentifyDiffer != nullptr)
+  {
+    delete IdentifyDiffer;
+    IdentifyDiffer = nullptr;
+  }
+
+  if (PurchaseTracker.IsValid())
+  {
+    // Completion handles held by game code outlive the subsystem; they now return false.
+    PurchaseTracker->Reset();
+    PurchaseTracker.Reset();
+  }
+
   bIsConfigured = false;
   PurchaseController = nullptr;
+  AsyncPurchaseController = nullptr;
 
   Super::Deinitialize();
 }
@@ -186,8 +575,44 @@ bool UNuxieSubsystem::Configure(const FNuxieConfigureOptions& Options, FNuxieErr
     return false;
   }
 
-  const bool bSuccess = Bridge->Configure(Options, OutError);
+  // Options come last so they override ini rules with the same target and key.
+  TArray<FNuxieRateLimitRule> RateLimits;
+  LoadIniRateLimits(RateLimits);
+  RateLimits.Append(Options.RateLimits);
+  for (int32 Index = 0; Index < RateLimits.Num(); ++Index)
+  {
+    const FNuxieRateLimitRule& Rule = RateLimits[Index];
+    const bool bReplaced = RateLimits.FindLastByPredicate([&Rule](const FNuxieRateLimitRule& Other)
+    {
+      return Other.Target == Rule.Target && Other.Key.Equals(Rule.Key, ESearchCase::CaseSensitive);
+    }) != Index;
+    if (!Rule.Key.IsEmpty() && !bReplaced && !Rule.IsValid())
+    {
+      OutError = FNuxieError::Make(
+        TEXT("INVALID_ARGUMENT"),
+        FString::Printf(TEXT("Rate limit \"%s\" queues calls but never refills; TokensPerSecond must be positive unless Policy is Drop."), *Rule.Key));
+      return false;
+    }
+  }
+
+  // Console overrides set before Configure (e.g. from an ini or remote config) apply from the start.
+  RuntimeOptions = FNuxieRuntimeOptions::FromConfigureOptions(Options);
+  FNuxieConfigureOptions EffectiveOptions = Options;
+  GetRuntimeOptions().ApplyTo(EffectiveOptions);
+
+  const bool bSuccess = Bridge->Configure(EffectiveOptions, OutError);
   bIsConfigured = bSuccess;
+  bSkipUnmatchedTriggers = bSuccess && Options.bSkipUnmatchedTriggers;
+  TriggerTimeoutSeconds = Options.TriggerTimeoutSeconds;
+
+  RateLimiter->SetRules(RateLimits, FPlatformTime::Seconds());
+
+  // The journal stays open across Shutdown/Configure so this run's records are not replayed to itself.
+  if (bSuccess && Options.bEnableEventJournal && !EventJournal->IsOpen())
+  {
+    EventJournal->Open(GetRuntimeOptions().MaxQueueSize);
+    ReplayEventJournal();
+  }
   return bSuccess;
 }
 
@@ -198,23 +623,151 @@ bool UNuxieSubsystem::Shutdown(FNuxieError& OutError)
     return false;
   }
 
+  FlushPendingIdentify();
   const bool bSuccess = Bridge->Shutdown(OutError);
   bIsConfigured = false;
+
+  // The native SDK has taken everything handed to it; see Deinitialize.
+  if (bSuccess)
+  {
+    EventJournal->Acknowledge(EventJournal->Seal());
+  }
+
+  // The native SDK will not finish these anymore, and starts still held back by a rate limit
+  // will not be sent.
+  TArray<FString> RequestIds;
+  RateLimiter->DiscardDeferred(RequestIds);
+  TriggerRegistry->GetRequestIds(RequestIds);
+  TriggerRegistry->Reset();
+  for (const FString& RequestId : RequestIds)
+  {
+    EndTriggerWithError(RequestId, FNuxieError::Make(TEXT("TRIGGER_ABORTED"), TEXT("Nuxie was shut down before the trigger finished.")));
+  }
   return bSuccess;
 }
 
+bool UNuxieSubsystem::UpdateRuntimeOptions(const FNuxieRuntimeOptions& Options, FNuxieError& OutError)
+{
+  if (!EnsureBridge(OutError))
+  {
+    return false;
+  }
+
+  FNuxieRuntimeOptions EffectiveOptions = Options;
+  ApplyConsoleOverrides(EffectiveOptions);
+  if (!EffectiveOptions.IsValid())
+  {
+    OutError = FNuxieError::Make(TEXT("INVALID_ARGUMENT"), TEXT("Runtime options must be positive; only RetryCount may be zero."));
+    return false;
+  }
+
+  if (!Bridge->UpdateRuntimeOptions(EffectiveOptions, OutError))
+  {
+    return false;
+  }
+
+  RuntimeOptions = Options;
+  EventJournal->SetMaxRecords(EffectiveOptions.MaxQueueSize);
+  return true;
+}
+
+FNuxieRuntimeOptions UNuxieSubsystem::GetRuntimeOptions() const
+{
+  FNuxieRuntimeOptions EffectiveOptions = RuntimeOptions;
+  ApplyConsoleOverrides(EffectiveOptions);
+  return EffectiveOptions;
+}
+
+bool UNuxieSubsystem::ReapplyRuntimeOptions(FNuxieError& OutError)
+{
+  return UpdateRuntimeOptions(RuntimeOptions, OutError);
+}
+
 bool UNuxieSubsystem::Identify(
   const FString& DistinctId,
   const TMap<FString, FString>& UserProperties,
   const TMap<FString, FString>& UserPropertiesSetOnce,
   FNuxieError& OutError)
+{
+  return Identify(DistinctId, FNuxiePropertyBag::FromStringMap(UserProperties), FNuxiePropertyBag::FromStringMap(UserPropertiesSetOnce), OutError);
+}
+
+bool UNuxieSubsystem::Identify(
+  const FString& DistinctId,
+  FNuxiePropertyBag&& UserProperties,
+  FNuxiePropertyBag&& UserPropertiesSetOnce,
+  FNuxieError& OutError)
 {
   if (!EnsureBridge(OutError))
   {
     return false;
   }
 
-  return Bridge->Identify(DistinctId, UserProperties, UserPropertiesSetOnce, OutError);
+  if (IdentifyDiffer->IsSwitch(DistinctId))
+  {
+    FlushPendingIdentify();
+  }
+
+  FNuxieIdentifyDiffer::FUpdate Update;
+  switch (IdentifyDiffer->Add(DistinctId, UserProperties, UserPropertiesSetOnce, Update))
+  {
+  case FNuxieIdentifyDiffer::EResult::Suppressed:
+    SET_DWORD_STAT(STAT_NuxieIdentifySuppressed, IdentifyDiffer->GetSuppressedCount());
+    return true;
+
+  case FNuxieIdentifyDiffer::EResult::Merged:
+    SET_DWORD_STAT(STAT_NuxieIdentifyMerged, IdentifyDiffer->GetMergedCount());
+    if (!IdentifyFlushTicker.IsValid())
+    {
+      IdentifyFlushTicker = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateWeakLambda(this, [this](float)
+      {
+        IdentifyFlushTicker.Reset();
+        FlushPendingIdentify();
+        return false;
+      }));
+    }
+    return true;
+
+  case FNuxieIdentifyDiffer::EResult::SendNow:
+    break;
+  }
+
+  if (!Bridge->Identify(Update.DistinctId, MoveTemp(Update.UserProperties), MoveTemp(Update.UserPropertiesSetOnce), OutError))
+  {
+    // The native SDK is still on the previous distinct ID.
+    IdentifyDiffer->Reset();
+    return false;
+  }
+
+  // Cached answers belong to the previous user. The ledger remembers whose uses it holds across
+  // sessions, so the first Identify of a session does not drop them.
+  FeatureCheckCache->Reset();
+  EntitlementEvaluator->Reset();
+  BalanceLedger->SetDistinctId(Update.DistinctId);
+  CampaignEventIndex->Reset();
+  OnFeatureStateReloadedNative.Broadcast();
+  return true;
+}
+
+void UNuxieSubsystem::FlushPendingIdentify()
+{
+  FNuxieIdentifyDiffer::FUpdate Update;
+  if (IdentifyDiffer == nullptr || !IdentifyDiffer->TakePending(Update))
+  {
+    return;
+  }
+
+  FNuxieError Error;
+  if (Bridge == nullptr || !Bridge->Identify(Update.DistinctId, MoveTemp(Update.UserProperties), MoveTemp(Update.UserPropertiesSetOnce), Error))
+  {
+    // The server may not have these values, so the next Identify sends every property again.
+    IdentifyDiffer->Forget(Update.DistinctId);
+  }
+}
+
+int64 UNuxieSubsystem::GetSuppressedIdentifyCount() const
+{
+  return IdentifyDiffer != nullptr ? IdentifyDiffer->GetSuppressedCount() : 0;
 }
 
 bool UNuxieSubsystem::Reset(bool bKeepAnonymousId, FNuxieError& OutError)
@@ -224,7 +777,19 @@ bool UNuxieSubsystem::Reset(bool bKeepAnonymousId, FNuxieError& OutError)
     return false;
   }
 
-  return Bridge->Reset(bKeepAnonymousId, OutError);
+  FlushPendingIdentify();
+  if (!Bridge->Reset(bKeepAnonymousId, OutError))
+  {
+    return false;
+  }
+
+  IdentifyDiffer->Reset();
+  FeatureCheckCache->Reset();
+  EntitlementEvaluator->Reset();
+  BalanceLedger->Reset();
+  CampaignEventIndex->Reset();
+  OnFeatureStateReloadedNative.Broadcast();
+  return true;
 }
 
 FString UNuxieSubsystem::GetDistinctId() const
@@ -260,89 +825,657 @@ bool UNuxieSubsystem::StartTrigger(
   FString& OutRequestId,
   FNuxieError& OutError)
 {
-  if (!EnsureBridge(OutError))
-  {
-    return false;
-  }
-
-  OutRequestId = FGuid::NewGuid().ToString(EGuidFormats::DigitsWithHyphensLower);
-  return Bridge->StartTrigger(OutRequestId, EventName, Options, OutError);
+  return StartTrigger(EventName, FNuxiePropertyBag::FromStringMap(Options.Properties), Options, OutRequestId, OutError);
 }
 
-bool UNuxieSubsystem::CancelTrigger(const FString& RequestId, FNuxieError& OutError)
+bool UNuxieSubsystem::StartTrigger(
+  const FString& EventName,
+  FNuxiePropertyBag&& Properties,
+  const FNuxieTriggerOptions& Options,
+  FString& OutRequestId,
+  FNuxieError& OutError)
 {
   if (!EnsureBridge(OutError))
   {
     return false;
   }
 
-  return Bridge->CancelTrigger(RequestId, OutError);
-}
+  // Campaigns may target on properties merged earlier this frame.
+  FlushPendingIdentify();
 
-bool UNuxieSubsystem::ShowFlow(const FString& FlowId, FNuxieError& OutError)
-{
-  if (!EnsureBridge(OutError))
+  // Interned once; the debouncer, campaign index and registry all key on it.
+  const FNuxieName EventKey(EventName);
+  const bool bDebounce = Options.DebounceWindowSeconds > 0.0f && TriggerDebouncer != nullptr;
+  const double NowSeconds = FPlatformTime::Seconds();
+  if (bDebounce && TriggerDebouncer->TryAttach(EventKey, NowSeconds, OutRequestId))
   {
-    return false;
+    INC_DWORD_STAT(STAT_NuxieTriggersCoalesced);
+    return true;
   }
 
-  return Bridge->ShowFlow(FlowId, OutError);
-}
+  RequestIds->Next(OutRequestId);
+  if (bSkipUnmatchedTriggers && CampaignEventIndex != nullptr && !CampaignEventIndex->CanMatch(EventKey.Name))
+  {
+    ResolveTriggerLocally(OutRequestId);
+    return true;
+  }
 
-bool UNuxieSubsystem::UseFeature(
-  const FString& FeatureId,
-  float Amount,
-  const FString& EntityId,
-  const TMap<FString, FString>& Metadata,
-  FNuxieError& OutError)
-{
-  if (!EnsureBridge(OutError))
+  const FNuxieRateLimiter::EAdmission Admission = RateLimiter->AdmitTrigger(EventName, Properties, Options, NowSeconds, OutRequestId);
+  PublishRateLimitStats(RateLimiter->GetStats());
+  if (Admission == FNuxieRateLimiter::EAdmission::Dropped)
   {
+    OutRequestId.Reset();
+    OutError = FNuxieError::Make(TEXT("RATE_LIMITED"), FString::Printf(TEXT("Trigger '%s' was dropped by its rate limit."), *EventName));
     return false;
   }
 
-  return Bridge->UseFeature(FeatureId, Amount, EntityId, Metadata, OutError);
-}
+  if (Admission == FNuxieRateLimiter::EAdmission::Coalesced)
+  {
+    // OutRequestId now names the start that is already waiting.
+    ScheduleRateLimitDrain();
+    return true;
+  }
 
-bool UNuxieSubsystem::CompletePurchase(const FString& RequestId, const FNuxiePurchaseResult& Result, FNuxieError& OutError)
-{
-  if (!EnsureBridge(OutError))
+  // A deferred start joins the registry, and so starts its timeout clock, when the drain sends it.
+  if (Admission == FNuxieRateLimiter::EAdmission::Deferred)
+  {
+    ScheduleRateLimitDrain();
+  }
+  else if (!Bridge->StartTrigger(OutRequestId, EventName, MoveTemp(Properties), Options, OutError))
   {
     return false;
   }
+  else
+  {
+    TriggerRegistry->Add(OutRequestId, EventKey.Name, NowSeconds);
+  }
 
-  return Bridge->CompletePurchase(RequestId, Result, OutError);
+  if (bDebounce)
+  {
+    TriggerDebouncer->Track(EventKey, OutRequestId, Options.DebounceWindowSeconds, NowSeconds);
+  }
+  return true;
 }
 
-bool UNuxieSubsystem::CompleteRestore(const FString& RequestId, const FNuxieRestoreResult& Result, FNuxieError& OutError)
+void UNuxieSubsystem::SetGameplayCritical(bool bCritical)
 {
-  if (!EnsureBridge(OutError))
+  if (FlushScheduler.IsValid())
   {
-    return false;
+    FlushScheduler->SetGameplayCritical(bCritical);
   }
+}
 
-  return Bridge->CompleteRestore(RequestId, Result, OutError);
+bool UNuxieSubsystem::IsGameplayCritical() const
+{
+  return FlushScheduler.IsValid() && FlushScheduler->IsGameplayCritical();
 }
 
-void UNuxieSubsystem::SetPurchaseController(const TScriptInterface<INuxiePurchaseController>& Controller)
+void UNuxieSubsystem::MarkFlushSafePoint()
 {
-  PurchaseController = Controller;
+  if (FlushScheduler.IsValid())
+  {
+    FlushScheduler->MarkSafePoint();
+  }
 }
 
-bool UNuxieSubsystem::GetIsConfigured() const
+FNuxieFlushReport UNuxieSubsystem::GetLastFlushReport() const
 {
-  return bIsConfigured;
+  return FlushScheduler.IsValid() ? FlushScheduler->GetLastReport() : FNuxieFlushReport();
 }
 
-void UNuxieSubsystem::RefreshProfileAsync(FNuxieProfileSuccessCallback OnSuccess, FNuxieErrorCallback OnError)
+FNuxieGameplayCriticalScope::FNuxieGameplayCriticalScope(UNuxieSubsystem* InSubsystem)
+  : Subsystem(InSubsystem)
 {
+  if (InSubsystem != nullptr)
+  {
+    InSubsystem->SetGameplayCritical(true);
+  }
+}
+
+FNuxieGameplayCriticalScope::~FNuxieGameplayCriticalScope()
+{
+  if (UNuxieSubsystem* Resolved = Subsystem.Get())
+  {
+    Resolved->SetGameplayCritical(false);
+  }
+}
+
+FNuxieRateLimitStats UNuxieSubsystem::GetRateLimitStats() const
+{
+  return RateLimiter != nullptr ? RateLimiter->GetStats() : FNuxieRateLimitStats();
+}
+
+void UNuxieSubsystem::ScheduleRateLimitDrain()
+{
+  if (!RateLimitDrainTicker.IsValid())
+  {
+    RateLimitDrainTicker = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UNuxieSubsystem::TickRateLimiter));
+  }
+}
+
+bool UNuxieSubsystem::TickRateLimiter(float DeltaTime)
+{
+  TArray<FNuxieRateLimiter::FDeferred> Ready;
+  RateLimiter->Drain(FPlatformTime::Seconds(), Ready);
+  for (FNuxieRateLimiter::FDeferred& Deferred : Ready)
+  {
+    FNuxieError Error;
+    if (FNuxieRateLimiter::FDeferredTrigger* Trigger = Deferred.TryGet<FNuxieRateLimiter::FDeferredTrigger>())
+    {
+      if (Bridge == nullptr || !Bridge->StartTrigger(Trigger->RequestId, Trigger->EventName, MoveTemp(Trigger->Properties), Trigger->Options, Error))
+      {
+        EndTriggerWithError(Trigger->RequestId, Error);
+      }
+      else
+      {
+        TriggerRegistry->Add(Trigger->RequestId, FName(*Trigger->EventName), FPlatformTime::Seconds());
+      }
+    }
+    else if (FNuxieRateLimiter::FDeferredUse* Use = Deferred.TryGet<FNuxieRateLimiter::FDeferredUse>())
+    {
+      if (Bridge == nullptr)
+      {
+        continue;
+      }
+
+      const bool bJournal = EventJournal->IsOpen();
+      const TMap<FString, FString> JournalMetadata = bJournal ? Use->Metadata.ToStringMap() : TMap<FString, FString>();
+      if (Bridge->UseFeature(Use->FeatureId, Use->Amount, Use->EntityId, MoveTemp(Use->Metadata), Error) && bJournal)
+      {
+        EventJournal->AppendUseFeature(Use->FeatureId, Use->Amount, Use->EntityId, JournalMetadata);
+      }
+    }
+  }
+
+  if (RateLimiter->HasDeferred())
+  {
+    return true;
+  }
+
+  RateLimitDrainTicker.Reset();
+  return false;
+}
+
+int32 UNuxieSubsystem::GetActiveTriggerCount() const
+{
+  return TriggerRegistry != nullptr ? TriggerRegistry->Num() : 0;
+}
+
+int64 UNuxieSubsystem::GetTimedOutTriggerCount() const
+{
+  return TriggersTimedOut;
+}
+
+void UNuxieSubsystem::DumpActiveTriggers(FOutputDevice& Ar) const
+{
+  check(IsInGameThread());
+  if (TriggerRegistry != nullptr)
+  {
+    TriggerRegistry->Dump(Ar, FPlatformTime::Seconds());
+  }
+}
+
+void UNuxieSubsystem::EndTriggerWithError(const FString& RequestId, const FNuxieError& Error)
+{
+  FNuxieTriggerUpdate Update;
+  Update.Kind = ENuxieTriggerUpdateKind::Error;
+  Update.Error = Error;
+  Update.TimestampMs = FDateTime::UtcNow().ToUnixTimestamp() * 1000;
+  Update.bIsTerminal = true;
+  if (BridgeListener != nullptr)
+  {
+    BridgeListener->OnTriggerUpdate(RequestId, Update);
+  }
+}
+
+bool UNuxieSubsystem::TickTriggerTimeouts(float DeltaTime)
+{
+  if (TriggerRegistry == nullptr)
+  {
+    return true;
+  }
+
+  if (TriggerTimeoutSeconds > 0.0f)
+  {
+    TArray<FString> TimedOut;
+    TriggerRegistry->CollectTimedOut(FPlatformTime::Seconds(), TriggerTimeoutSeconds, TimedOut);
+    for (const FString& RequestId : TimedOut)
+    {
+      ++TriggersTimedOut;
+      INC_DWORD_STAT(STAT_NuxieTriggerTimeouts);
+
+      // A start still held back by a rate limit must not be sent by a later drain.
+      FNuxieError IgnoreError;
+      if (!RateLimiter->CancelDeferred(RequestId) && Bridge != nullptr)
+      {
+        Bridge->CancelTrigger(RequestId, IgnoreError);
+      }
+      EndTriggerWithError(
+        RequestId,
+        FNuxieError::Make(TEXT("TRIGGER_TIMEOUT"), FString::Printf(TEXT("No trigger update for %.0f seconds."), TriggerTimeoutSeconds)));
+    }
+  }
+
+  SET_DWORD_STAT(STAT_NuxieActiveTriggers, TriggerRegistry->Num());
+  SET_MEMORY_STAT(STAT_NuxieActiveTriggerMemory, TriggerRegistry->GetAllocatedSize());
+  return true;
+}
+
+int64 UNuxieSubsystem::GetCoalescedTriggerCount() const
+{
+  return TriggerDebouncer != nullptr ? TriggerDebouncer->GetCoalescedCount() : 0;
+}
+
+void UNuxieSubsystem::ResolveTriggerLocally(const FString& RequestId)
+{
+  ++TriggersResolvedLocally;
+  INC_DWORD_STAT(STAT_NuxieTriggersResolvedLocally);
+
+  FNuxieTriggerUpdate Update;
+  Update.Kind = ENuxieTriggerUpdateKind::Decision;
+  Update.DecisionKind = ENuxieTriggerDecisionKind::NoMatch;
+  Update.TimestampMs = FDateTime::UtcNow().ToUnixTimestamp() * 1000;
+  Update.bIsTerminal = true;
+
+  // Deferred rather than broadcast inline so callers can bind to the request id StartTrigger returns.
+  AsyncTask(ENamedThreads::GameThread, [WeakThis = TWeakObjectPtr<UNuxieSubsystem>(this), RequestId, Update]()
+  {
+    UNuxieSubsystem* This = WeakThis.Get();
+    if (This != nullptr && This->BridgeListener != nullptr)
+    {
+      This->BridgeListener->OnTriggerUpdate(RequestId, Update);
+    }
+  });
+}
+
+int64 UNuxieSubsystem::GetTriggersResolvedLocally() const
+{
+  return TriggersResolvedLocally;
+}
+
+bool UNuxieSubsystem::CancelTrigger(const FString& RequestId, FNuxieError& OutError)
+{
+  if (!EnsureBridge(OutError))
+  {
+    return false;
+  }
+
+  // A coalesced request keeps running until every caller attached to it has cancelled.
+  if (TriggerDebouncer != nullptr && !TriggerDebouncer->Release(RequestId))
+  {
+    return true;
+  }
+
+  // Never reached the native SDK, so there is nothing to cancel there.
+  if (RateLimiter->CancelDeferred(RequestId))
+  {
+    return true;
+  }
+
+  return Bridge->CancelTrigger(RequestId, OutError);
+}
+
+bool UNuxieSubsystem::ShowFlow(const FString& FlowId, FNuxieError& OutError)
+{
+  if (!EnsureBridge(OutError))
+  {
+    return false;
+  }
+
+  return Bridge->ShowFlow(FlowId, OutError);
+}
+
+bool UNuxieSubsystem::UseFeature(
+  const FString& FeatureId,
+  float Amount,
+  const FString& EntityId,
+  const TMap<FString, FString>& Metadata,
+  FNuxieError& OutError)
+{
+  return UseFeature(FeatureId, Amount, EntityId, FNuxiePropertyBag::FromStringMap(Metadata), OutError);
+}
+
+bool UNuxieSubsystem::UseFeature(
+  const FString& FeatureId,
+  float Amount,
+  const FString& EntityId,
+  FNuxiePropertyBag&& Metadata,
+  FNuxieError& OutError)
+{
+  if (!EnsureBridge(OutError))
+  {
+    return false;
+  }
+
+  const FNuxieRateLimiter::EAdmission Admission = RateLimiter->AdmitUse(FeatureId, Amount, EntityId, Metadata, FPlatformTime::Seconds());
+  PublishRateLimitStats(RateLimiter->GetStats());
+  if (Admission == FNuxieRateLimiter::EAdmission::Dropped)
+  {
+    OutError = FNuxieError::Make(TEXT("RATE_LIMITED"), FString::Printf(TEXT("Usage of '%s' was dropped by its rate limit."), *FeatureId));
+    return false;
+  }
+
+  // Held back uses are journaled by TickRateLimiter when they reach the bridge.
+  if (Admission == FNuxieRateLimiter::EAdmission::Deferred || Admission == FNuxieRateLimiter::EAdmission::Coalesced)
+  {
+    ScheduleRateLimitDrain();
+    return true;
+  }
+
+  // The journal stores strings; convert before the bag is moved into the bridge.
+  const bool bJournal = EventJournal->IsOpen();
+  const TMap<FString, FString> JournalMetadata = bJournal ? Metadata.ToStringMap() : TMap<FString, FString>();
+  if (!Bridge->UseFeature(FeatureId, Amount, EntityId, MoveTemp(Metadata), OutError))
+  {
+    return false;
+  }
+
+  if (bJournal)
+  {
+    EventJournal->AppendUseFeature(FeatureId, Amount, EntityId, JournalMetadata);
+  }
+  return true;
+}
+
+int32 UNuxieSubsystem::GetJournaledEventCount() const
+{
+  return EventJournal.IsValid() ? EventJournal->Num() : 0;
+}
+
+int64 UNuxieSubsystem::GetReplayedEventCount() const
+{
+  return JournalEventsReplayed;
+}
+
+bool UNuxieSubsystem::TickEventJournal(float DeltaTime)
+{
+  if (Bridge == nullptr || !EventJournal->IsOpen() || EventJournal->Num() == 0)
+  {
+    return true;
+  }
+
+  // The native SDK also flushes on its own (FlushAt, FlushIntervalSeconds). Every record sealed here
+  // reached the bridge before the count was asked for, so an empty queue means all were sent.
+  Bridge->GetQueuedEventCountAsync(
+    [WeakJournal = TWeakPtr<FNuxieEventJournal, ESPMode::ThreadSafe>(EventJournal), Mark = EventJournal->Seal()](int32 Count)
+    {
+      const TSharedPtr<FNuxieEventJournal, ESPMode::ThreadSafe> Journal = WeakJournal.Pin();
+      if (Count == 0 && Journal.IsValid())
+      {
+        Journal->Acknowledge(Mark);
+      }
+    },
+    [](const FNuxieError&) {});
+  return true;
+}
+
+void UNuxieSubsystem::ReplayEventJournal()
+{
+  // Trigger starts are not journaled: replaying one would run campaign logic, and possibly present
+  // a flow, long after the moment it belonged to, with no listener left for its request id.
+  TArray<FNuxieEventJournal::FUseFeatureRecord> Records;
+  EventJournal->TakeRecovered(Records);
+  if (Records.Num() == 0)
+  {
+    return;
+  }
+
+  // Straight to the bridge: these passed the rate limits in the run that recorded them. They stay
+  // in their old segments until the flush below is acknowledged.
+  for (const FNuxieEventJournal::FUseFeatureRecord& Record : Records)
+  {
+    FNuxieError IgnoreError;
+    Bridge->UseFeature(Record.FeatureId, Record.Amount, Record.EntityId, Record.Metadata, IgnoreError);
+  }
+
+  JournalEventsReplayed += Records.Num();
+  INC_DWORD_STAT_BY(STAT_NuxieJournalReplayed, Records.Num());
+  FlushEventsAsync([](bool) {}, [](const FNuxieError&) {});
+}
+
+void UNuxieSubsystem::RecordFeatureAccess(
+  TWeakObjectPtr<UNuxieSubsystem> WeakThis,
+  const FString& FeatureId,
+  int32 RequiredBalance,
+  const FString& EntityId,
+  const FNuxieFeatureAccess& Access)
+{
+  NuxieRunOnGameThread([WeakThis, FeatureId, RequiredBalance, EntityId, Access]()
+  {
+    UNuxieSubsystem* This = WeakThis.Get();
+    if (This == nullptr || This->EntitlementEvaluator == nullptr)
+    {
+      return;
+    }
+
+    const FNuxieName FeatureName(FeatureId);
+    const FNuxieName EntityName = FNuxieName::FromOptional(EntityId);
+    FNuxieFeatureAccess Previous;
+    const bool bKnown = This->EntitlementEvaluator->Evaluate(FeatureName, RequiredBalance, EntityName, Previous);
+    This->EntitlementEvaluator->Record(FeatureName, RequiredBalance, EntityName, Access);
+
+    // A first answer, or one that differs from the recorded one, is a change for subscribers such
+    // as feature gates, which read the evaluator when called.
+    if ((!bKnown || !IsSameAccess(Previous, Access)) && This->FeatureSubscriptions != nullptr)
+    {
+      This->FeatureSubscriptions->Dispatch(FeatureId, EntityId, bKnown ? Previous : FNuxieFeatureAccess(), Access);
+    }
+  });
+}
+
+bool UNuxieSubsystem::EvaluateFeatureAccess(FName FeatureId, int32 RequiredBalance, FName EntityId, FNuxieFeatureAccess& OutAccess) const
+{
+  check(IsInGameThread());
+  return EntitlementEvaluator != nullptr && EntitlementEvaluator->Evaluate(FNuxieName(FeatureId), RequiredBalance, FNuxieName(EntityId), OutAccess);
+}
+
+bool UNuxieSubsystem::EvaluateFeatureAccess(const FString& FeatureId, int32 RequiredBalance, const FString& EntityId, FNuxieFeatureAccess& OutAccess) const
+{
+  check(IsInGameThread());
+
+  // FindName avoids adding unseen IDs to the name table; an unseen ID cannot be in the evaluator either.
+  const FNuxieName FeatureName(FeatureId, FNAME_Find);
+  if (FeatureName.IsNone())
+  {
+    return false;
+  }
+
+  const FNuxieName EntityName = FNuxieName::FromOptional(EntityId, FNAME_Find);
+  if (!EntityId.IsEmpty() && EntityName.IsNone())
+  {
+    return false;
+  }
+
+  // Straight to the evaluator: going through the FName overload would lose the ID's case.
+  return EntitlementEvaluator != nullptr && EntitlementEvaluator->Evaluate(FeatureName, RequiredBalance, EntityName, OutAccess);
+}
+
+bool UNuxieSubsystem::SubmitUseFeature(const FString& FeatureId, float Amount, const FString& EntityId, const TMap<FString, FString>& Metadata)
+{
+  return SubmitUseFeature(FeatureId, Amount, EntityId, FNuxiePropertyBag::FromStringMap(Metadata));
+}
+
+bool UNuxieSubsystem::SubmitUseFeature(const FString& FeatureId, float Amount, const FString& EntityId, FNuxiePropertyBag&& Metadata)
+{
+  if (!SubmissionQueue.IsValid())
+  {
+    return false;
+  }
+
+  // Journaled by the queue's consumer once the bridge accepts it.
+  FNuxieSubmissionQueue::FUseFeature Submission;
+  Submission.FeatureId = FeatureId;
+  Submission.Amount = Amount;
+  Submission.EntityId = EntityId;
+  Submission.Metadata = MoveTemp(Metadata);
+  return SubmissionQueue->Push(FNuxieSubmissionQueue::FSubmission(TInPlaceType<FNuxieSubmissionQueue::FUseFeature>(), MoveTemp(Submission)));
+}
+
+FString UNuxieSubsystem::SubmitStartTrigger(const FString& EventName, const FNuxieTriggerOptions& Options)
+{
+  FNuxieTriggerOptions Copy = Options;
+  FNuxiePropertyBag Properties = FNuxiePropertyBag::FromStringMap(Copy.Properties);
+  Copy.Properties.Empty();
+  return SubmitStartTrigger(EventName, MoveTemp(Properties), MoveTemp(Copy));
+}
+
+FString UNuxieSubsystem::SubmitStartTrigger(const FString& EventName, FNuxiePropertyBag&& Properties, FNuxieTriggerOptions&& Options)
+{
+  if (!SubmissionQueue.IsValid())
+  {
+    return FString();
+  }
+
+  FNuxieSubmissionQueue::FStartTrigger Submission;
+  RequestIds->Next(Submission.RequestId);
+  Submission.EventName = EventName;
+  Submission.Properties = MoveTemp(Properties);
+  Submission.Options = MoveTemp(Options);
+
+  FString RequestId = Submission.RequestId;
+  if (!SubmissionQueue->Push(FNuxieSubmissionQueue::FSubmission(TInPlaceType<FNuxieSubmissionQueue::FStartTrigger>(), MoveTemp(Submission))))
+  {
+    return FString();
+  }
+
+  NuxieRunOnGameThread([WeakThis = TWeakObjectPtr<UNuxieSubsystem>(this), RequestId, EventKey = FName(*EventName), NowSeconds = FPlatformTime::Seconds()]()
+  {
+    UNuxieSubsystem* This = WeakThis.Get();
+    if (This != nullptr && This->TriggerRegistry != nullptr)
+    {
+      This->TriggerRegistry->Add(RequestId, EventKey, NowSeconds);
+    }
+  });
+  return RequestId;
+}
+
+bool UNuxieSubsystem::SubmitIdentify(
+  const FString& DistinctId,
+  const TMap<FString, FString>& UserProperties,
+  const TMap<FString, FString>& UserPropertiesSetOnce)
+{
+  return SubmitIdentify(DistinctId, FNuxiePropertyBag::FromStringMap(UserProperties), FNuxiePropertyBag::FromStringMap(UserPropertiesSetOnce));
+}
+
+bool UNuxieSubsystem::SubmitIdentify(
+  const FString& DistinctId,
+  FNuxiePropertyBag&& UserProperties,
+  FNuxiePropertyBag&& UserPropertiesSetOnce)
+{
+  if (!SubmissionQueue.IsValid())
+  {
+    return false;
+  }
+
+  // The differ cannot tell which values this call sends, so its next Identify sends them all.
+  NuxieRunOnGameThread([WeakThis = TWeakObjectPtr<UNuxieSubsystem>(this), DistinctId]()
+  {
+    UNuxieSubsystem* This = WeakThis.Get();
+    if (This != nullptr && This->IdentifyDiffer != nullptr)
+    {
+      This->IdentifyDiffer->Forget(DistinctId);
+    }
+  });
+
+  FNuxieSubmissionQueue::FIdentify Submission;
+  Submission.DistinctId = DistinctId;
+  Submission.UserProperties = MoveTemp(UserProperties);
+  Submission.UserPropertiesSetOnce = MoveTemp(UserPropertiesSetOnce);
+  return SubmissionQueue->Push(FNuxieSubmissionQueue::FSubmission(TInPlaceType<FNuxieSubmissionQueue::FIdentify>(), MoveTemp(Submission)));
+}
+
+int32 UNuxieSubsystem::GetPendingSubmissionCount() const
+{
+  return SubmissionQueue.IsValid() ? SubmissionQueue->GetPendingCount() : 0;
+}
+
+bool UNuxieSubsystem::CompletePurchase(const FString& RequestId, const FNuxiePurchaseResult& Result, FNuxieError& OutError)
+{
+  if (!EnsureBridge(OutError))
+  {
+    return false;
+  }
+
+  // Claims the request so that a completion handle for it returns false. Ids the tracker never saw
+  // are still forwarded, as before.
+  if (PurchaseTracker.IsValid())
+  {
+    PurchaseTracker->Claim(RequestId, FNuxiePurchaseTracker::EKind::Purchase);
+  }
+
+  return Bridge->CompletePurchase(RequestId, Result, OutError);
+}
+
+bool UNuxieSubsystem::CompleteRestore(const FString& RequestId, const FNuxieRestoreResult& Result, FNuxieError& OutError)
+{
+  if (!EnsureBridge(OutError))
+  {
+    return false;
+  }
+
+  if (PurchaseTracker.IsValid())
+  {
+    PurchaseTracker->Claim(RequestId, FNuxiePurchaseTracker::EKind::Restore);
+  }
+
+  return Bridge->CompleteRestore(RequestId, Result, OutError);
+}
+
+void UNuxieSubsystem::SetPurchaseController(const TScriptInterface<INuxiePurchaseController>& Controller)
+{
+  PurchaseController = Controller;
+}
+
+void UNuxieSubsystem::SetAsyncPurchaseController(const TScriptInterface<INuxieAsyncPurchaseController>& Controller)
+{
+  AsyncPurchaseController = Controller;
+}
+
+FNuxiePurchaseLatencyStats UNuxieSubsystem::GetPurchaseLatency() const
+{
+  return PurchaseTracker.IsValid() ? PurchaseTracker->GetStats(FNuxiePurchaseTracker::EKind::Purchase) : FNuxiePurchaseLatencyStats();
+}
+
+FNuxiePurchaseLatencyStats UNuxieSubsystem::GetRestoreLatency() const
+{
+  return PurchaseTracker.IsValid() ? PurchaseTracker->GetStats(FNuxiePurchaseTracker::EKind::Restore) : FNuxiePurchaseLatencyStats();
+}
+
+bool UNuxieSubsystem::GetIsConfigured() const
+{
+  return bIsConfigured;
+}
+
+void UNuxieSubsystem::RefreshProfileAsync(
+  FNuxieProfileSuccessCallback OnSuccess,
+  FNuxieErrorCallback OnError,
+  const FNuxieDeliveryPolicy& Delivery)
+{
+  OnSuccess = NuxieBindDelivery(Delivery, MoveTemp(OnSuccess));
+  OnError = NuxieBindDelivery(Delivery, MoveTemp(OnError));
+
   if (Bridge == nullptr)
   {
     OnError(FNuxieError::Make(TEXT("NATIVE_UNAVAILABLE"), TEXT("Nuxie platform bridge is unavailable.")));
     return;
   }
 
-  Bridge->RefreshProfileAsync(MoveTemp(OnSuccess), MoveTemp(OnError));
+  Bridge->RefreshProfileAsync(
+    [WeakThis = TWeakObjectPtr<UNuxieSubsystem>(this), OnSuccess = MoveTemp(OnSuccess)](const FNuxieProfileResponse& Profile)
+    {
+      NuxieRunOnGameThread([WeakThis, RawJson = Profile.RawJson]()
+      {
+        UNuxieSubsystem* This = WeakThis.Get();
+        if (This != nullptr && This->EntitlementEvaluator != nullptr)
+        {
+          This->EntitlementEvaluator->LoadProfileJson(RawJson);
+          This->CampaignEventIndex->LoadProfileJson(RawJson);
+          This->OnFeatureStateReloadedNative.Broadcast();
+        }
+      });
+      OnSuccess(Profile);
+    },
+    MoveTemp(OnError));
 }
 
 void UNuxieSubsystem::HasFeatureAsync(
@@ -350,15 +1483,28 @@ void UNuxieSubsystem::HasFeatureAsync(
   int32 RequiredBalance,
   const FString& EntityId,
   FNuxieFeatureAccessSuccessCallback OnSuccess,
-  FNuxieErrorCallback OnError)
+  FNuxieErrorCallback OnError,
+  const FNuxieDeliveryPolicy& Delivery)
 {
+  OnSuccess = NuxieBindDelivery(Delivery, MoveTemp(OnSuccess));
+  OnError = NuxieBindDelivery(Delivery, MoveTemp(OnError));
+
   if (Bridge == nullptr)
   {
     OnError(FNuxieError::Make(TEXT("NATIVE_UNAVAILABLE"), TEXT("Nuxie platform bridge is unavailable.")));
     return;
   }
 
-  Bridge->HasFeatureAsync(FeatureId, RequiredBalance, EntityId, MoveTemp(OnSuccess), MoveTemp(OnError));
+  Bridge->HasFeatureAsync(
+    FeatureId,
+    RequiredBalance,
+    EntityId,
+    [WeakThis = TWeakObjectPtr<UNuxieSubsystem>(this), FeatureId, RequiredBalance, EntityId, OnSuccess = MoveTemp(OnSuccess)](const FNuxieFeatureAccess& Access)
+    {
+      RecordFeatureAccess(WeakThis, FeatureId, RequiredBalance, EntityId, Access);
+      OnSuccess(Access);
+    },
+    MoveTemp(OnError));
 }
 
 void UNuxieSubsystem::CheckFeatureAsync(
@@ -367,15 +1513,214 @@ void UNuxieSubsystem::CheckFeatureAsync(
   const FString& EntityId,
   bool bForceRefresh,
   FNuxieFeatureCheckSuccessCallback OnSuccess,
-  FNuxieErrorCallback OnError)
+  FNuxieErrorCallback OnError,
+  const FNuxieDeliveryPolicy& Delivery)
 {
+  OnSuccess = NuxieBindDelivery(Delivery, MoveTemp(OnSuccess));
+  OnError = NuxieBindDelivery(Delivery, MoveTemp(OnError));
+
   if (Bridge == nullptr)
   {
     OnError(FNuxieError::Make(TEXT("NATIVE_UNAVAILABLE"), TEXT("Nuxie platform bridge is unavailable.")));
     return;
   }
 
-  Bridge->CheckFeatureAsync(FeatureId, RequiredBalance, EntityId, bForceRefresh, MoveTemp(OnSuccess), MoveTemp(OnError));
+  TWeakPtr<FNuxieFeatureCheckCache, ESPMode::ThreadSafe> WeakCache = FeatureCheckCache;
+  Bridge->CheckFeatureAsync(
+    FeatureId,
+    RequiredBalance,
+    EntityId,
+    bForceRefresh,
+    [WeakThis = TWeakObjectPtr<UNuxieSubsystem>(this), WeakCache, FeatureId, RequiredBalance, EntityId, OnSuccess = MoveTemp(OnSuccess)](
+      const FNuxieFeatureCheckResult& Result)
+    {
+      if (const TSharedPtr<FNuxieFeatureCheckCache, ESPMode::ThreadSafe> Cache = WeakCache.Pin())
+      {
+        FNuxieFeatureAccess Previous;
+        Cache->Store(FeatureId, RequiredBalance, EntityId, Result, Previous);
+      }
+      RecordFeatureAccess(WeakThis, FeatureId, RequiredBalance, EntityId, Result.Access);
+      OnSuccess(Result);
+    },
+    MoveTemp(OnError));
+}
+
+void UNuxieSubsystem::CheckFeatureAsync(
+  const FString& FeatureId,
+  int32 RequiredBalance,
+  const FString& EntityId,
+  const FNuxieFeatureCachePolicy& CachePolicy,
+  FNuxieFeatureCheckSuccessCallback OnSuccess,
+  FNuxieErrorCallback OnError,
+  const FNuxieDeliveryPolicy& Delivery)
+{
+  FNuxieFeatureCheckResult Cached;
+  const FNuxieFeatureCheckCache::ELookup Lookup = FeatureCheckCache.IsValid()
+    ? FeatureCheckCache->Find(FeatureId, RequiredBalance, EntityId, CachePolicy, Cached)
+    : FNuxieFeatureCheckCache::ELookup::Miss;
+
+  switch (Lookup)
+  {
+  case FNuxieFeatureCheckCache::ELookup::Stale:
+    RevalidateFeature(FeatureId, RequiredBalance, EntityId);
+    [[fallthrough]];
+  case FNuxieFeatureCheckCache::ELookup::Fresh:
+    NuxieBindDelivery(Delivery, MoveTemp(OnSuccess))(Cached);
+    return;
+  case FNuxieFeatureCheckCache::ELookup::Expired:
+    // Our copy is already too old, so the native cache is not good enough either.
+    CheckFeatureAsync(FeatureId, RequiredBalance, EntityId, true, MoveTemp(OnSuccess), MoveTemp(OnError), Delivery);
+    return;
+  case FNuxieFeatureCheckCache::ELookup::Miss:
+  default:
+    CheckFeatureAsync(FeatureId, RequiredBalance, EntityId, false, MoveTemp(OnSuccess), MoveTemp(OnError), Delivery);
+    return;
+  }
+}
+
+bool UNuxieSubsystem::TryGetCachedFeatureCheck(
+  const FString& FeatureId,
+  int32 RequiredBalance,
+  const FString& EntityId,
+  const FNuxieFeatureCachePolicy& CachePolicy,
+  FNuxieFeatureCheckResult& OutResult)
+{
+  if (!FeatureCheckCache.IsValid())
+  {
+    return false;
+  }
+
+  switch (FeatureCheckCache->Find(FeatureId, RequiredBalance, EntityId, CachePolicy, OutResult))
+  {
+  case FNuxieFeatureCheckCache::ELookup::Stale:
+    RevalidateFeature(FeatureId, RequiredBalance, EntityId);
+    return true;
+  case FNuxieFeatureCheckCache::ELookup::Fresh:
+    return true;
+  case FNuxieFeatureCheckCache::ELookup::Expired:
+  case FNuxieFeatureCheckCache::ELookup::Miss:
+  default:
+    return false;
+  }
+}
+
+void UNuxieSubsystem::RequestFeatureAccess(const FString& FeatureId, int32 RequiredBalance, const FString& EntityId)
+{
+  if (Bridge == nullptr || !FeatureCheckCache.IsValid() || !FeatureCheckCache->TryBeginFetch(FeatureId, RequiredBalance, EntityId))
+  {
+    return;
+  }
+
+  // Delivered on the game thread after the answer is recorded, so a request that finds the key
+  // free again also finds the answer in the evaluator.
+  TWeakPtr<FNuxieFeatureCheckCache, ESPMode::ThreadSafe> WeakCache = FeatureCheckCache;
+  const auto EndFetch = [WeakCache, FeatureId, RequiredBalance, EntityId]()
+  {
+    if (const TSharedPtr<FNuxieFeatureCheckCache, ESPMode::ThreadSafe> Cache = WeakCache.Pin())
+    {
+      Cache->EndFetch(FeatureId, RequiredBalance, EntityId);
+    }
+  };
+  CheckFeatureAsync(
+    FeatureId,
+    RequiredBalance,
+    EntityId,
+    false,
+    [EndFetch](const FNuxieFeatureCheckResult&) { EndFetch(); },
+    [EndFetch](const FNuxieError&) { EndFetch(); });
+}
+
+void UNuxieSubsystem::RevalidateFeature(const FString& FeatureId, int32 RequiredBalance, const FString& EntityId)
+{
+  if (Bridge == nullptr || !FeatureCheckCache->TryBeginRevalidate(FeatureId, RequiredBalance, EntityId))
+  {
+    return;
+  }
+
+  TWeakObjectPtr<UNuxieSubsystem> WeakThis(this);
+  TWeakPtr<FNuxieFeatureCheckCache, ESPMode::ThreadSafe> WeakCache = FeatureCheckCache;
+  Bridge->CheckFeatureAsync(
+    FeatureId,
+    RequiredBalance,
+    EntityId,
+    true,
+    [WeakThis, WeakCache, FeatureId, RequiredBalance, EntityId](const FNuxieFeatureCheckResult& Result)
+    {
+      const TSharedPtr<FNuxieFeatureCheckCache, ESPMode::ThreadSafe> Cache = WeakCache.Pin();
+      if (!Cache.IsValid())
+      {
+        return;
+      }
+
+      // Only this entry was refreshed, so the change is announced for its entity alone and never
+      // applied to the feature's other entries.
+      FNuxieFeatureAccessChange Change;
+      Change.FeatureId = FeatureId;
+      Change.Current = Result.Access;
+      const bool bReplaced = Cache->Store(FeatureId, RequiredBalance, EntityId, Result, Change.Previous);
+      Cache->EndRevalidate(FeatureId, RequiredBalance, EntityId);
+      if (!bReplaced || IsSameAccess(Change.Previous, Change.Current))
+      {
+        RecordFeatureAccess(WeakThis, FeatureId, RequiredBalance, EntityId, Result.Access);
+        return;
+      }
+
+      NuxieRunOnGameThread([WeakThis, EntityId, Change = MoveTemp(Change)]()
+      {
+        UNuxieSubsystem* This = WeakThis.Get();
+        if (This == nullptr)
+        {
+          return;
+        }
+
+        SCOPE_CYCLE_COUNTER(STAT_NuxieDispatchFeatureAccess);
+        This->ApplyFeatureAccessChange(Change, EntityId);
+
+        const TArray<FNuxieFeatureAccessChange> Changes = { Change };
+        This->OnFeatureAccessBatchChangedNative.Broadcast(Changes);
+        BroadcastIfBound(This->OnFeatureAccessBatchChanged, Changes);
+      });
+    },
+    [WeakCache, FeatureId, RequiredBalance, EntityId](const FNuxieError&)
+    {
+      if (const TSharedPtr<FNuxieFeatureCheckCache, ESPMode::ThreadSafe> Cache = WeakCache.Pin())
+      {
+        Cache->EndRevalidate(FeatureId, RequiredBalance, EntityId);
+      }
+    });
+}
+
+void UNuxieSubsystem::ApplyFeatureAccessChange(const FNuxieFeatureAccessChange& Change, const FString& EntityId)
+{
+  const auto Apply = [this, &Change, &EntityId]()
+  {
+    if (EntitlementEvaluator != nullptr)
+    {
+      // A pushed change carries no requirement; without a balance its grant answers the default of one.
+      EntitlementEvaluator->Record(FNuxieName(Change.FeatureId), 1, FNuxieName::FromOptional(EntityId), Change.Current);
+    }
+    if (BalanceLedger != nullptr && Change.Current.bHasBalance && !Change.Current.bUnlimited)
+    {
+      BalanceLedger->ApplyAuthoritative(Change.FeatureId, EntityId, Change.Current.Balance);
+    }
+  };
+
+  if (BalanceLedger != nullptr && BalanceLedger->HasPending(Change.FeatureId, EntityId))
+  {
+    ReconcileBalance(Change.FeatureId, EntityId, Apply);
+  }
+  else
+  {
+    Apply();
+  }
+
+  OnFeatureAccessChangedNative.Broadcast(Change.FeatureId, Change.Previous, Change.Current);
+  BroadcastIfBound(OnFeatureAccessChanged, Change.FeatureId, Change.Previous, Change.Current);
+
+  if (FeatureSubscriptions != nullptr)
+  {
+    FeatureSubscriptions->Dispatch(Change.FeatureId, EntityId, Change.Previous, Change.Current);
+  }
 }
 
 void UNuxieSubsystem::UseFeatureAndWaitAsync(
@@ -385,30 +1730,214 @@ void UNuxieSubsystem::UseFeatureAndWaitAsync(
   bool bSetUsage,
   const TMap<FString, FString>& Metadata,
   FNuxieFeatureUsageSuccessCallback OnSuccess,
-  FNuxieErrorCallback OnError)
+  FNuxieErrorCallback OnError,
+  const FNuxieDeliveryPolicy& Delivery)
 {
+  UseFeatureAndWaitAsync(FeatureId, Amount, EntityId, bSetUsage, FNuxiePropertyBag::FromStringMap(Metadata), MoveTemp(OnSuccess), MoveTemp(OnError), Delivery);
+}
+
+void UNuxieSubsystem::UseFeatureAndWaitAsync(
+  const FString& FeatureId,
+  float Amount,
+  const FString& EntityId,
+  bool bSetUsage,
+  FNuxiePropertyBag&& Metadata,
+  FNuxieFeatureUsageSuccessCallback OnSuccess,
+  FNuxieErrorCallback OnError,
+  const FNuxieDeliveryPolicy& Delivery)
+{
+  OnSuccess = NuxieBindDelivery(Delivery, MoveTemp(OnSuccess));
+  OnError = NuxieBindDelivery(Delivery, MoveTemp(OnError));
+
   if (Bridge == nullptr)
   {
     OnError(FNuxieError::Make(TEXT("NATIVE_UNAVAILABLE"), TEXT("Nuxie platform bridge is unavailable.")));
     return;
   }
 
-  Bridge->UseFeatureAndWaitAsync(FeatureId, Amount, EntityId, bSetUsage, Metadata, MoveTemp(OnSuccess), MoveTemp(OnError));
+  Bridge->UseFeatureAndWaitAsync(FeatureId, Amount, EntityId, bSetUsage, MoveTemp(Metadata), MoveTemp(OnSuccess), MoveTemp(OnError));
 }
 
-void UNuxieSubsystem::FlushEventsAsync(FNuxieBoolSuccessCallback OnSuccess, FNuxieErrorCallback OnError)
+FNuxieFeatureUsageResult UNuxieSubsystem::UseFeatureOptimistic(
+  const FString& FeatureId,
+  float Amount,
+  const FString& EntityId,
+  const TMap<FString, FString>& Metadata,
+  FNuxieFeatureUsageSuccessCallback OnSuccess,
+  FNuxieErrorCallback OnError,
+  const FNuxieDeliveryPolicy& Delivery)
 {
+  check(IsInGameThread());
+
+  FNuxieFeatureUsageResult Projected;
+  Projected.FeatureId = FeatureId;
+  Projected.AmountUsed = Amount;
+
+  if (Bridge == nullptr || BalanceLedger == nullptr)
+  {
+    Projected.Message = TEXT("Nuxie platform bridge is unavailable.");
+    NuxieBindDelivery(Delivery, MoveTemp(OnError))(FNuxieError::Make(TEXT("NATIVE_UNAVAILABLE"), Projected.Message));
+    return Projected;
+  }
+
+  FNuxieFeatureAccess Known;
+  if (EvaluateFeatureAccess(FeatureId, 0, EntityId, Known) && Known.bUnlimited)
+  {
+    // Nothing to deduct from.
+    Projected.bSuccess = true;
+    UseFeatureAndWaitAsync(FeatureId, Amount, EntityId, false, Metadata, MoveTemp(OnSuccess), MoveTemp(OnError), Delivery);
+    return Projected;
+  }
+
+  const int32 Delta = FMath::CeilToInt(Amount);
+  const TOptional<int32> KnownBalance = GetKnownBalance(FeatureId, EntityId);
+  int32 Available = 0;
+  if (BalanceLedger->GetProjectedBalance(FeatureId, EntityId, KnownBalance, Available) && Available < Delta)
+  {
+    Projected.Message = TEXT("Insufficient projected balance.");
+    Projected.bHasUsageRemaining = true;
+    Projected.UsageRemaining = Available;
+    NuxieBindDelivery(Delivery, MoveTemp(OnError))(FNuxieError::Make(TEXT("INSUFFICIENT_BALANCE"), Projected.Message));
+    return Projected;
+  }
+
+  TOptional<int32> Remaining;
+  const int64 Sequence = BalanceLedger->Reserve(FeatureId, EntityId, Delta, KnownBalance, Remaining);
+  Projected.bSuccess = true;
+  Projected.bHasUsageRemaining = Remaining.IsSet();
+  Projected.UsageRemaining = Remaining.Get(0);
+
+  OnSuccess = NuxieBindDelivery(Delivery, MoveTemp(OnSuccess));
+  OnError = NuxieBindDelivery(Delivery, MoveTemp(OnError));
+
+  const TWeakObjectPtr<UNuxieSubsystem> WeakThis(this);
+  Bridge->UseFeatureAndWaitAsync(
+    FeatureId,
+    Amount,
+    EntityId,
+    false,
+    Metadata,
+    [WeakThis, FeatureId, EntityId, Sequence, OnSuccess = MoveTemp(OnSuccess)](const FNuxieFeatureUsageResult& Result)
+    {
+      // Reconcile first so the ledger is settled by the time a game-thread OnSuccess runs.
+      NuxieRunOnGameThread([WeakThis, FeatureId, EntityId, Sequence, Result]()
+      {
+        UNuxieSubsystem* This = WeakThis.Get();
+        if (This == nullptr || This->BalanceLedger == nullptr)
+        {
+          return;
+        }
+
+        This->ReconcileBalance(FeatureId, EntityId, [This, &FeatureId, &EntityId, Sequence, &Result]()
+        {
+          FNuxieFeatureAccess Access;
+          if (Result.bHasUsageRemaining && This->EvaluateFeatureAccess(FeatureId, 0, EntityId, Access))
+          {
+            Access.bHasBalance = true;
+            Access.Balance = Result.UsageRemaining;
+            This->EntitlementEvaluator->Record(FNuxieName(FeatureId), 0, FNuxieName::FromOptional(EntityId), Access);
+          }
+
+          // A denied use was not applied, so confirming still removes its delta.
+          This->BalanceLedger->Confirm(Sequence, Result);
+        });
+      });
+      OnSuccess(Result);
+    },
+    [WeakThis, FeatureId, EntityId, Sequence, OnError = MoveTemp(OnError)](const FNuxieError& Error)
+    {
+      NuxieRunOnGameThread([WeakThis, FeatureId, EntityId, Sequence]()
+      {
+        UNuxieSubsystem* This = WeakThis.Get();
+        if (This != nullptr && This->BalanceLedger != nullptr)
+        {
+          This->ReconcileBalance(FeatureId, EntityId, [This, Sequence]()
+          {
+            This->BalanceLedger->Reject(Sequence);
+          });
+        }
+      });
+      OnError(Error);
+    });
+
+  return Projected;
+}
+
+bool UNuxieSubsystem::GetProjectedFeatureBalance(const FString& FeatureId, const FString& EntityId, int32& OutBalance) const
+{
+  check(IsInGameThread());
+  return BalanceLedger != nullptr && BalanceLedger->GetProjectedBalance(FeatureId, EntityId, GetKnownBalance(FeatureId, EntityId), OutBalance);
+}
+
+TOptional<int32> UNuxieSubsystem::GetKnownBalance(const FString& FeatureId, const FString& EntityId) const
+{
+  FNuxieFeatureAccess Access;
+  if (EvaluateFeatureAccess(FeatureId, 0, EntityId, Access) && Access.bHasBalance && !Access.bUnlimited)
+  {
+    return Access.Balance;
+  }
+  return TOptional<int32>();
+}
+
+void UNuxieSubsystem::ReconcileBalance(const FString& FeatureId, const FString& EntityId, TFunctionRef<void()> Apply)
+{
+  int32 Before = 0;
+  const bool bHadProjection = BalanceLedger->GetProjectedBalance(FeatureId, EntityId, GetKnownBalance(FeatureId, EntityId), Before);
+
+  Apply();
+
+  int32 After = 0;
+  if (!bHadProjection
+    || !BalanceLedger->GetProjectedBalance(FeatureId, EntityId, GetKnownBalance(FeatureId, EntityId), After)
+    || After == Before)
+  {
+    return;
+  }
+
+  INC_DWORD_STAT(STAT_NuxieBalanceCorrections);
+  OnFeatureBalanceCorrectedNative.Broadcast(FeatureId, EntityId, Before, After);
+  BroadcastIfBound(OnFeatureBalanceCorrected, FeatureId, EntityId, Before, After);
+}
+
+void UNuxieSubsystem::FlushEventsAsync(
+  FNuxieBoolSuccessCallback OnSuccess,
+  FNuxieErrorCallback OnError,
+  const FNuxieDeliveryPolicy& Delivery)
+{
+  OnSuccess = NuxieBindDelivery(Delivery, MoveTemp(OnSuccess));
+  OnError = NuxieBindDelivery(Delivery, MoveTemp(OnError));
+
   if (Bridge == nullptr)
   {
     OnError(FNuxieError::Make(TEXT("NATIVE_UNAVAILABLE"), TEXT("Nuxie platform bridge is unavailable.")));
     return;
   }
 
+  // Everything journaled before this flush is delivered once it succeeds.
+  if (EventJournal.IsValid() && EventJournal->Num() > 0)
+  {
+    OnSuccess = [WeakJournal = TWeakPtr<FNuxieEventJournal, ESPMode::ThreadSafe>(EventJournal), Mark = EventJournal->Seal(), OnSuccess = MoveTemp(OnSuccess)](bool bSuccess)
+    {
+      const TSharedPtr<FNuxieEventJournal, ESPMode::ThreadSafe> Journal = WeakJournal.Pin();
+      if (bSuccess && Journal.IsValid())
+      {
+        Journal->Acknowledge(Mark);
+      }
+      OnSuccess(bSuccess);
+    };
+  }
+
   Bridge->FlushEventsAsync(MoveTemp(OnSuccess), MoveTemp(OnError));
 }
 
-void UNuxieSubsystem::GetQueuedEventCountAsync(FNuxieIntSuccessCallback OnSuccess, FNuxieErrorCallback OnError)
+void UNuxieSubsystem::GetQueuedEventCountAsync(
+  FNuxieIntSuccessCallback OnSuccess,
+  FNuxieErrorCallback OnError,
+  const FNuxieDeliveryPolicy& Delivery)
 {
+  OnSuccess = NuxieBindDelivery(Delivery, MoveTemp(OnSuccess));
+  OnError = NuxieBindDelivery(Delivery, MoveTemp(OnError));
+
   if (Bridge == nullptr)
   {
     OnError(FNuxieError::Make(TEXT("NATIVE_UNAVAILABLE"), TEXT("Nuxie platform bridge is unavailable.")));
@@ -418,8 +1947,14 @@ void UNuxieSubsystem::GetQueuedEventCountAsync(FNuxieIntSuccessCallback OnSucces
   Bridge->GetQueuedEventCountAsync(MoveTemp(OnSuccess), MoveTemp(OnError));
 }
 
-void UNuxieSubsystem::PauseEventQueueAsync(FSimpleDelegate OnSuccess, FNuxieErrorCallback OnError)
+void UNuxieSubsystem::PauseEventQueueAsync(
+  FSimpleDelegate OnSuccess,
+  FNuxieErrorCallback OnError,
+  const FNuxieDeliveryPolicy& Delivery)
 {
+  OnSuccess = NuxieBindDelivery(Delivery, MoveTemp(OnSuccess));
+  OnError = NuxieBindDelivery(Delivery, MoveTemp(OnError));
+
   if (Bridge == nullptr)
   {
     OnError(FNuxieError::Make(TEXT("NATIVE_UNAVAILABLE"), TEXT("Nuxie platform bridge is unavailable.")));
@@ -429,8 +1964,14 @@ void UNuxieSubsystem::PauseEventQueueAsync(FSimpleDelegate OnSuccess, FNuxieErro
   Bridge->PauseEventQueueAsync(MoveTemp(OnSuccess), MoveTemp(OnError));
 }
 
-void UNuxieSubsystem::ResumeEventQueueAsync(FSimpleDelegate OnSuccess, FNuxieErrorCallback OnError)
+void UNuxieSubsystem::ResumeEventQueueAsync(
+  FSimpleDelegate OnSuccess,
+  FNuxieErrorCallback OnError,
+  const FNuxieDeliveryPolicy& Delivery)
 {
+  OnSuccess = NuxieBindDelivery(Delivery, MoveTemp(OnSuccess));
+  OnError = NuxieBindDelivery(Delivery, MoveTemp(OnError));
+
   if (Bridge == nullptr)
   {
     OnError(FNuxieError::Make(TEXT("NATIVE_UNAVAILABLE"), TEXT("Nuxie platform bridge is unavailable.")));
@@ -439,3 +1980,40 @@ void UNuxieSubsystem::ResumeEventQueueAsync(FSimpleDelegate OnSuccess, FNuxieErr
 
   Bridge->ResumeEventQueueAsync(MoveTemp(OnSuccess), MoveTemp(OnError));
 }
+
+FDelegateHandle UNuxieSubsystem::SubscribeFeature(FName FeatureId, FName EntityId, FNuxieFeatureAccessChangedDelegate Callback)
+{
+  check(IsInGameThread());
+  if (FeatureSubscriptions == nullptr)
+  {
+    return FDelegateHandle();
+  }
+
+  return FeatureSubscriptions->Add(FNuxieName(FeatureId), FNuxieName(EntityId), MoveTemp(Callback));
+}
+
+FDelegateHandle UNuxieSubsystem::SubscribeFeature(const FString& FeatureId, const FString& EntityId, FNuxieFeatureAccessChangedDelegate Callback)
+{
+  check(IsInGameThread());
+  if (FeatureSubscriptions == nullptr)
+  {
+    return FDelegateHandle();
+  }
+
+  return FeatureSubscriptions->Add(FNuxieName(FeatureId), FNuxieName::FromOptional(EntityId), MoveTemp(Callback));
+}
+
+bool UNuxieSubsystem::UnsubscribeFeature(FDelegateHandle Handle)
+{
+  check(IsInGameThread());
+  return FeatureSubscriptions != nullptr && FeatureSubscriptions->Remove(Handle);
+}
+
+void UNuxieSubsystem::UnsubscribeAllFeatures(const void* UserObject)
+{
+  check(IsInGameThread());
+  if (FeatureSubscriptions != nullptr)
+  {
+    FeatureSubscriptions->RemoveAll(UserObject);
+  }
+}
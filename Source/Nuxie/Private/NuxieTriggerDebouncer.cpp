@@ -0,0 +1,79 @@
+#include "NuxieTriggerDebouncer.h"
+
+bool FNuxieTriggerDebouncer::TryAttach(const FNuxieName& EventName, double NowSeconds, FString& OutRequestId)
+{
+  const FWindow* Window = WindowsByEvent.Find(EventName);
+  if (Window == nullptr)
+  {
+    return false;
+  }
+
+  if (NowSeconds > Window->ExpiresAtSeconds)
+  {
+    // Window is over: the next start gets its own request, but this one keeps running.
+    WindowsByEvent.Remove(EventName);
+    return false;
+  }
+
+  ++ReferencesByRequest.FindOrAdd(Window->RequestId);
+  ++CoalescedCount;
+  OutRequestId = Window->RequestId;
+  return true;
+}
+
+void FNuxieTriggerDebouncer::Track(const FNuxieName& EventName, const FString& RequestId, float WindowSeconds, double NowSeconds)
+{
+  // A request this replaces keeps its own references.
+  FWindow& Window = WindowsByEvent.FindOrAdd(EventName);
+  Window.RequestId = RequestId;
+  Window.ExpiresAtSeconds = NowSeconds + WindowSeconds;
+  ReferencesByRequest.Add(RequestId, 1);
+}
+
+bool FNuxieTriggerDebouncer::Release(const FString& RequestId)
+{
+  int32* References = ReferencesByRequest.Find(RequestId);
+  if (References == nullptr)
+  {
+    return true;
+  }
+
+  if (--*References > 0)
+  {
+    return false;
+  }
+
+  ReferencesByRequest.Remove(RequestId);
+  RemoveWindow(RequestId);
+  return true;
+}
+
+void FNuxieTriggerDebouncer::OnTerminal(const FString& RequestId)
+{
+  ReferencesByRequest.Remove(RequestId);
+  RemoveWindow(RequestId);
+}
+
+void FNuxieTriggerDebouncer::Reset()
+{
+  WindowsByEvent.Reset();
+  ReferencesByRequest.Reset();
+}
+
+int64 FNuxieTriggerDebouncer::GetCoalescedCount() const
+{
+  return CoalescedCount;
+}
+
+void FNuxieTriggerDebouncer::RemoveWindow(const FString& RequestId)
+{
+  // Only events inside their window are tracked, so this stays a handful of entries.
+  for (auto It = WindowsByEvent.CreateIterator(); It; ++It)
+  {
+    if (It.Value().RequestId == RequestId)
+    {
+      It.RemoveCurrent();
+      return;
+    }
+  }
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "NuxieName.h"
+
+/**
+ * Coalesces repeated StartTrigger calls for the same event into the request already in flight.
+ *
+ * A request stays attachable for its debounce window, measured from its first start, until it
+ * reaches a terminal update. Attached callers share its request id and so its update stream; each
+ * holds a reference that CancelTrigger releases, and only the last release cancels natively.
+ * References are counted per request until its terminal update, so they outlive the window.
+ * Event names match case-sensitively.
+ * Game thread only.
+ */
+class FNuxieTriggerDebouncer
+{
+public:
+  /** Returns true and sets OutRequestId when a request for EventName is attachable. */
+  bool TryAttach(const FNuxieName& EventName, double NowSeconds, FString& OutRequestId);
+
+  void Track(const FNuxieName& EventName, const FString& RequestId, float WindowSeconds, double NowSeconds);
+
+  /** Returns false while other callers still hold RequestId, in which case it must not be cancelled natively. */
+  bool Release(const FString& RequestId);
+
+  void OnTerminal(const FString& RequestId);
+  void Reset();
+
+  int64 GetCoalescedCount() const;
+
+private:
+  struct FWindow
+  {
+    FString RequestId;
+    double ExpiresAtSeconds = 0.0;
+  };
+
+  void RemoveWindow(const FString& RequestId);
+
+  TMap<FNuxieName, FWindow> WindowsByEvent;
+  TMap<FString, int32> ReferencesByRequest;
+  int64 CoalescedCount = 0;
+};
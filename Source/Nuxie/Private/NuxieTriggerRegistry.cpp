@@ -0,0 +1,92 @@
+#include "NuxieTriggerRegistry.h"
+
+#include "Misc/OutputDevice.h"
+
+void FNuxieTriggerRegistry::Add(const FString& RequestId, FName EventName, double NowSeconds)
+{
+  FEntry& Entry = Entries.FindOrAdd(RequestId);
+  Entry.EventName = EventName;
+  Entry.StartSeconds = NowSeconds;
+  Entry.LastUpdateSeconds = NowSeconds;
+}
+
+void FNuxieTriggerRegistry::OnUpdate(const FString& RequestId, const FNuxieTriggerUpdate& Update, double NowSeconds)
+{
+  if (Update.bIsTerminal || Nuxie::FTriggerContract::IsTerminal(Update))
+  {
+    Entries.Remove(RequestId);
+    return;
+  }
+
+  if (FEntry* Entry = Entries.Find(RequestId))
+  {
+    Entry->LastUpdateSeconds = NowSeconds;
+    Entry->LastKind = Update.Kind;
+    ++Entry->UpdateCount;
+  }
+}
+
+void FNuxieTriggerRegistry::Remove(const FString& RequestId)
+{
+  Entries.Remove(RequestId);
+}
+
+void FNuxieTriggerRegistry::CollectTimedOut(double NowSeconds, double TimeoutSeconds, TArray<FString>& OutRequestIds)
+{
+  for (auto It = Entries.CreateIterator(); It; ++It)
+  {
+    if (NowSeconds - It.Value().LastUpdateSeconds > TimeoutSeconds)
+    {
+      OutRequestIds.Add(It.Key());
+      It.RemoveCurrent();
+    }
+  }
+}
+
+void FNuxieTriggerRegistry::GetRequestIds(TArray<FString>& OutRequestIds) const
+{
+  Entries.GenerateKeyArray(OutRequestIds);
+}
+
+void FNuxieTriggerRegistry::Dump(FOutputDevice& Ar, double NowSeconds) const
+{
+  Ar.Logf(TEXT("Nuxie active triggers: %d (%llu bytes)"), Entries.Num(), static_cast<uint64>(GetAllocatedSize()));
+  for (const TPair<FString, FEntry>& Pair : Entries)
+  {
+    const FEntry& Entry = Pair.Value;
+    Ar.Logf(
+      TEXT("  %s event=%s age=%.1fs idle=%.1fs updates=%d last=%s bytes=%llu"),
+      *Pair.Key,
+      *Entry.EventName.ToString(),
+      NowSeconds - Entry.StartSeconds,
+      NowSeconds - Entry.LastUpdateSeconds,
+      Entry.UpdateCount,
+      Entry.UpdateCount > 0 ? *UEnum::GetValueAsString(Entry.LastKind) : TEXT("none"),
+      static_cast<uint64>(GetEntrySize(Pair.Key, Entry)));
+  }
+}
+
+void FNuxieTriggerRegistry::Reset()
+{
+  Entries.Reset();
+}
+
+int32 FNuxieTriggerRegistry::Num() const
+{
+  return Entries.Num();
+}
+
+SIZE_T FNuxieTriggerRegistry::GetAllocatedSize() const
+{
+  SIZE_T Size = Entries.GetAllocatedSize();
+  for (const TPair<FString, FEntry>& Pair : Entries)
+  {
+    Size += Pair.Key.GetAllocatedSize();
+  }
+  return Size;
+}
+
+SIZE_T FNuxieTriggerRegistry::GetEntrySize(const FString& RequestId, const FEntry& Entry)
+{
+  return sizeof(FString) + sizeof(FEntry) + RequestId.GetAllocatedSize();
+}
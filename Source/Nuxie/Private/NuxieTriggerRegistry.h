@@ -0,0 +1,52 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "NuxieTypes.h"
+
+class FOutputDevice;
+
+/**
+ * In-flight StartTrigger requests, from start until their terminal update.
+ *
+ * Requests whose last activity is older than the configured timeout are handed back by
+ * CollectTimedOut so the subsystem can end them with a synthetic terminal Error; otherwise a lost
+ * terminal update would keep every listener (e.g. UNuxieTriggerAsyncAction) alive forever.
+ * Game thread only.
+ */
+class FNuxieTriggerRegistry
+{
+public:
+  void Add(const FString& RequestId, FName EventName, double NowSeconds);
+
+  /** Records an update; terminal updates remove the request. */
+  void OnUpdate(const FString& RequestId, const FNuxieTriggerUpdate& Update, double NowSeconds);
+
+  void Remove(const FString& RequestId);
+
+  /** Removes and returns every request idle for longer than TimeoutSeconds. */
+  void CollectTimedOut(double NowSeconds, double TimeoutSeconds, TArray<FString>& OutRequestIds);
+
+  void GetRequestIds(TArray<FString>& OutRequestIds) const;
+  void Dump(FOutputDevice& Ar, double NowSeconds) const;
+  void Reset();
+
+  int32 Num() const;
+
+  /** Bytes held by the registry, including each entry's request id. Event names live in the name table. */
+  SIZE_T GetAllocatedSize() const;
+
+private:
+  struct FEntry
+  {
+    FName EventName;
+    double StartSeconds = 0.0;
+    double LastUpdateSeconds = 0.0;
+    int32 UpdateCount = 0;
+    ENuxieTriggerUpdateKind LastKind = ENuxieTriggerUpdateKind::Error;
+  };
+
+  static SIZE_T GetEntrySize(const FString& RequestId, const FEntry& Entry);
+
+  TMap<FString, FEntry> Entries;
+};
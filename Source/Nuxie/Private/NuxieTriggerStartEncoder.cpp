@@ -0,0 +1,187 @@
+#include "NuxieTriggerStartEncoder.h"
+
+namespace
+{
+  bool IsUnreservedByte(uint32 Byte)
+  {
+    return (Byte >= 'a' && Byte <= 'z') || (Byte >= 'A' && Byte <= 'Z') || (Byte >= '0' && Byte <= '9')
+      || Byte == '-' || Byte == '_' || Byte == '.' || Byte == '~';
+  }
+
+  void AppendEncodedByte(TArray<uint8>& Out, uint8 Byte)
+  {
+    if (IsUnreservedByte(Byte))
+    {
+      Out.Add(Byte);
+      return;
+    }
+
+    static constexpr ANSICHAR HexDigits[] = "0123456789ABCDEF";
+    Out.Add('%');
+    Out.Add(HexDigits[Byte >> 4]);
+    Out.Add(HexDigits[Byte & 0xF]);
+  }
+
+  /** Appends Value as UTF-8, percent-encoding every byte when bUrlEncode, as FGenericPlatformHttp::UrlEncode does. */
+  void AppendUtf8(TArray<uint8>& Out, FStringView Value, bool bUrlEncode)
+  {
+    auto Emit = [&Out, bUrlEncode](uint8 Byte)
+    {
+      if (bUrlEncode)
+      {
+        AppendEncodedByte(Out, Byte);
+      }
+      else
+      {
+        Out.Add(Byte);
+      }
+    };
+
+    for (int32 Index = 0; Index < Value.Len(); ++Index)
+    {
+      uint32 CodePoint = static_cast<uint32>(Value[Index]);
+      if (CodePoint >= 0xD800 && CodePoint <= 0xDBFF && Index + 1 < Value.Len())
+      {
+        const uint32 Low = static_cast<uint32>(Value[Index + 1]);
+        if (Low >= 0xDC00 && Low <= 0xDFFF)
+        {
+          CodePoint = 0x10000 + ((CodePoint - 0xD800) << 10) + (Low - 0xDC00);
+          ++Index;
+        }
+      }
+
+      if (CodePoint < 0x80)
+      {
+        Emit(static_cast<uint8>(CodePoint));
+      }
+      else if (CodePoint < 0x800)
+      {
+        Emit(static_cast<uint8>(0xC0 | (CodePoint >> 6)));
+        Emit(static_cast<uint8>(0x80 | (CodePoint & 0x3F)));
+      }
+      else if (CodePoint < 0x10000)
+      {
+        Emit(static_cast<uint8>(0xE0 | (CodePoint >> 12)));
+        Emit(static_cast<uint8>(0x80 | ((CodePoint >> 6) & 0x3F)));
+        Emit(static_cast<uint8>(0x80 | (CodePoint & 0x3F)));
+      }
+      else
+      {
+        Emit(static_cast<uint8>(0xF0 | (CodePoint >> 18)));
+        Emit(static_cast<uint8>(0x80 | ((CodePoint >> 12) & 0x3F)));
+        Emit(static_cast<uint8>(0x80 | ((CodePoint >> 6) & 0x3F)));
+        Emit(static_cast<uint8>(0x80 | (CodePoint & 0x3F)));
+      }
+    }
+  }
+
+  void AppendAscii(TArray<uint8>& Out, const ANSICHAR* Text)
+  {
+    Out.Append(reinterpret_cast<const uint8*>(Text), FCStringAnsi::Strlen(Text));
+  }
+
+  void AppendEncodedAscii(TArray<uint8>& Out, const ANSICHAR* Text)
+  {
+    for (; *Text != '\0'; ++Text)
+    {
+      AppendEncodedByte(Out, static_cast<uint8>(*Text));
+    }
+  }
+
+  void AppendPropertyPrefix(TArray<uint8>& Out, FStringView Key)
+  {
+    if (Out.Num() > 0)
+    {
+      Out.Add('&');
+    }
+    AppendUtf8(Out, Key, true);
+    Out.Add('=');
+  }
+
+  // Same layout as FNuxieAndroidBridge::EncodeProperties, written into Out without temporaries.
+  void AppendProperties(TArray<uint8>& Out, const FNuxiePropertyBag& Properties)
+  {
+    ANSICHAR Number[40];
+    for (const FNuxiePropertyBag::FProperty& Property : Properties)
+    {
+      AppendPropertyPrefix(Out, Property.Key);
+      switch (Property.Type)
+      {
+      case ENuxiePropertyType::Int:
+        FCStringAnsi::Snprintf(Number, UE_ARRAY_COUNT(Number), "i%lld", static_cast<long long>(Property.Int));
+        AppendEncodedAscii(Out, Number);
+        break;
+      case ENuxiePropertyType::Double:
+        FNuxieTriggerStartEncoder::FormatTaggedDouble(Number, Property.Double);
+        AppendEncodedAscii(Out, Number);
+        break;
+      case ENuxiePropertyType::Bool:
+        AppendAscii(Out, Property.bBool ? "b1" : "b0");
+        break;
+      case ENuxiePropertyType::String:
+      default:
+        Out.Add('s');
+        AppendUtf8(Out, Property.String, true);
+        break;
+      }
+    }
+  }
+
+  void AppendProperties(TArray<uint8>& Out, const TMap<FString, FString>& Properties)
+  {
+    for (const TPair<FString, FString>& Pair : Properties)
+    {
+      AppendPropertyPrefix(Out, Pair.Key);
+      Out.Add('s');
+      AppendUtf8(Out, Pair.Value, true);
+    }
+  }
+}
+
+void FNuxieTriggerStartEncoder::Encode(
+  const FString& RequestId,
+  const FString& EventName,
+  const FNuxiePropertyBag& Properties,
+  const FNuxieTriggerOptions& Options)
+{
+  Packed.Reset();
+  AppendUtf8(Packed, RequestId, false);
+  Packed.Add('\0');
+  AppendUtf8(Packed, EventName, false);
+  Packed.Add('\0');
+
+  // Each section is encoded on its own, then encoded again as the value of its field.
+  const int32 PayloadStart = Packed.Num();
+  auto AppendPayloadSection = [this, PayloadStart](const ANSICHAR* Name, auto&& Values)
+  {
+    Section.Reset();
+    AppendProperties(Section, Values);
+    if (Packed.Num() > PayloadStart)
+    {
+      Packed.Add('&');
+    }
+    AppendAscii(Packed, Name);
+    Packed.Add('=');
+    for (const uint8 Byte : Section)
+    {
+      AppendEncodedByte(Packed, Byte);
+    }
+  };
+  AppendPayloadSection("properties", Properties);
+  AppendPayloadSection("user_properties", Options.UserProperties);
+  AppendPayloadSection("user_properties_set_once", Options.UserPropertiesSetOnce);
+}
+
+void FNuxieTriggerStartEncoder::FormatTaggedDouble(ANSICHAR (&Out)[40], double Value)
+{
+  FCStringAnsi::Snprintf(Out, UE_ARRAY_COUNT(Out), "d%.17g", Value);
+  ANSICHAR* Write = Out;
+  for (const ANSICHAR* Read = Out; *Read != '\0'; ++Read)
+  {
+    if (*Read != '+')
+    {
+      *Write++ = *Read;
+    }
+  }
+  *Write = '\0';
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "NuxiePropertyBag.h"
+#include "NuxieTypes.h"
+
+/**
+ * Encodes a trigger start as UTF-8 for NuxieBridge.startTriggerPacked: the request id, a NUL, the
+ * event name, a NUL, then the options payload that NuxieBridge.startTrigger accepts.
+ *
+ * The buffers are reused by every start encoded with one encoder, so once they have grown to fit,
+ * encoding allocates nothing. Not thread-safe; the Android bridge keeps one per thread.
+ */
+class FNuxieTriggerStartEncoder
+{
+public:
+  /** Replaces the packed buffer with the encoding of one start. */
+  void Encode(const FString& RequestId, const FString& EventName, const FNuxiePropertyBag& Properties, const FNuxieTriggerOptions& Options);
+
+  /** Valid until the next Encode. Its capacity may exceed Num. */
+  const TArray<uint8>& GetPacked() const
+  {
+    return Packed;
+  }
+
+  /**
+   * Writes "d" and Value with 17 significant digits, which round-trips every double. A positive
+   * exponent loses its '+' ("1e20"): URLDecoder reads a raw '+' as a space, and
+   * Double.parseDouble accepts the exponent without a sign.
+   */
+  static void FormatTaggedDouble(ANSICHAR (&Out)[40], double Value);
+
+private:
+  TArray<uint8> Section;
+  TArray<uint8> Packed;
+};
@@ -2,6 +2,10 @@
 
 #include "Async/Async.h"
 #include "GenericPlatform/GenericPlatformHttp.h"
+#include "Misc/ScopeRWLock.h"
+#include "NuxieFeatureAccessBatcher.h"
+#include "NuxiePurchaseTracker.h"
+#include "NuxieTriggerStartEncoder.h"
 #include <cstdarg>
 
 #if PLATFORM_ANDROID
@@ -29,6 +33,77 @@ namespace
   }
 
 #if PLATFORM_ANDROID
+  /**
+   * A global reference to the Java NIO view of a thread's packed trigger start, released when the
+   * thread exits. The engine detaches threads from the JVM in a pthread key destructor, which
+   * normally runs after this one; if it already ran, the thread attaches again just long enough to
+   * release the reference.
+   */
+  struct FPackedBufferRef
+  {
+    jobject Buffer = nullptr;
+    const uint8* Data = nullptr;
+    int32 Capacity = 0;
+
+    ~FPackedBufferRef()
+    {
+      if (Buffer == nullptr || GJavaVM == nullptr)
+      {
+        return;
+      }
+
+      JNIEnv* Env = nullptr;
+      if (GJavaVM->GetEnv(reinterpret_cast<void**>(&Env), JNI_CURRENT_VERSION) == JNI_OK)
+      {
+        Env->DeleteGlobalRef(Buffer);
+      }
+      else if (GJavaVM->AttachCurrentThread(&Env, nullptr) == JNI_OK)
+      {
+        Env->DeleteGlobalRef(Buffer);
+        GJavaVM->DetachCurrentThread();
+      }
+    }
+  };
+
+  // Members are destroyed in reverse order, so the Java view is released before the array it
+  // points into is freed.
+  struct FTriggerStartScratch
+  {
+    FNuxieTriggerStartEncoder Encoder;
+    FPackedBufferRef PackedBuffer;
+  };
+
+  thread_local FTriggerStartScratch TriggerStartScratch;
+
+  /** Java NIO view of Scratch's packed buffer, recreated only when the array has moved. */
+  jobject GetPackedBuffer(JNIEnv* Env, FTriggerStartScratch& Scratch)
+  {
+    const TArray<uint8>& Packed = Scratch.Encoder.GetPacked();
+    FPackedBufferRef& Ref = Scratch.PackedBuffer;
+    if (Ref.Buffer != nullptr && Ref.Data == Packed.GetData() && Ref.Capacity == Packed.Max())
+    {
+      return Ref.Buffer;
+    }
+
+    if (Ref.Buffer != nullptr)
+    {
+      Env->DeleteGlobalRef(Ref.Buffer);
+      Ref.Buffer = nullptr;
+    }
+
+    jobject LocalBuffer = Env->NewDirectByteBuffer(const_cast<uint8*>(Packed.GetData()), Packed.Max());
+    if (LocalBuffer == nullptr)
+    {
+      return nullptr;
+    }
+
+    Ref.Buffer = Env->NewGlobalRef(LocalBuffer);
+    Env->DeleteLocalRef(LocalBuffer);
+    Ref.Data = Packed.GetData();
+    Ref.Capacity = Packed.Max();
+    return Ref.Buffer;
+  }
+
   FString JStringToFString(JNIEnv* Env, jstring Value)
   {
     if (Value == nullptr)
@@ -59,6 +134,34 @@ namespace
     return CachedClass;
   }
 
+  /**
+   * GetStaticMethodID is a string lookup in the JVM, so resolved ids are kept. Method ids stay valid
+   * while the class is loaded, and GetBridgeClass holds it. Keys compare the pointers of the name and
+   * signature literals; the same text at another address only costs one more lookup.
+   */
+  jmethodID FindStaticMethod(JNIEnv* Env, jclass BridgeClass, const char* MethodName, const char* Signature)
+  {
+    static FRWLock MethodsLock;
+    static TMap<TPair<const char*, const char*>, jmethodID> Methods;
+
+    const TPair<const char*, const char*> Key(MethodName, Signature);
+    {
+      FReadScopeLock ReadLock(MethodsLock);
+      if (const jmethodID* Cached = Methods.Find(Key))
+      {
+        return *Cached;
+      }
+    }
+
+    jmethodID Method = Env->GetStaticMethodID(BridgeClass, MethodName, Signature);
+    if (Method != nullptr)
+    {
+      FWriteScopeLock WriteLock(MethodsLock);
+      Methods.Add(Key, Method);
+    }
+    return Method;
+  }
+
   jobject MakeJavaInteger(JNIEnv* Env, int32 Value)
   {
     jclass IntegerClass = Env->FindClass("java/lang/Integer");
@@ -81,7 +184,11 @@ namespace
 #endif
 }
 
-FNuxieAndroidBridge::FNuxieAndroidBridge() = default;
+FNuxieAndroidBridge::FNuxieAndroidBridge()
+  : FeatureAccessBatcher(MakeShared<FNuxieFeatureAccessBatcher, ESPMode::ThreadSafe>())
+{
+}
+
 FNuxieAndroidBridge::~FNuxieAndroidBridge()
 {
 #if PLATFORM_ANDROID
@@ -96,6 +203,7 @@ FNuxieAndroidBridge::~FNuxieAndroidBridge()
 void FNuxieAndroidBridge::SetListener(INuxiePlatformBridgeListener* InListener)
 {
   Listener = InListener;
+  FeatureAccessBatcher->SetListener(InListener);
 }
 
 FString FNuxieAndroidBridge::EncodeMap(const TMap<FString, FString>& Values)
@@ -118,6 +226,63 @@ FString FNuxieAndroidBridge::EncodeMap(const TMap<FString, FString>& Values)
   return Out;
 }
 
+FString FNuxieAndroidBridge::EncodeProperties(const FNuxiePropertyBag& Properties)
+{
+  // Same layout as EncodeMap, with a type tag in front of each value (KvCodec.decodeProperties).
+  FString Out;
+  for (const FNuxiePropertyBag::FProperty& Property : Properties)
+  {
+    if (!Out.IsEmpty())
+    {
+      Out += TEXT("&");
+    }
+
+    Out += FGenericPlatformHttp::UrlEncode(FString(Property.Key));
+    Out += TEXT("=");
+    switch (Property.Type)
+    {
+    case ENuxiePropertyType::Int:
+      Out += FString::Printf(TEXT("i%lld"), Property.Int);
+      break;
+    case ENuxiePropertyType::Double:
+    {
+      ANSICHAR Number[40];
+      FNuxieTriggerStartEncoder::FormatTaggedDouble(Number, Property.Double);
+      Out += FString(Number);
+      break;
+    }
+    case ENuxiePropertyType::Bool:
+      Out += Property.bBool ? TEXT("b1") : TEXT("b0");
+      break;
+    case ENuxiePropertyType::String:
+    default:
+      Out += TEXT("s");
+      Out += FGenericPlatformHttp::UrlEncode(FString(Property.String));
+      break;
+    }
+  }
+
+  return Out;
+}
+
+FString FNuxieAndroidBridge::EncodeProperties(const TMap<FString, FString>& Properties)
+{
+  FString Out;
+  for (const TPair<FString, FString>& Pair : Properties)
+  {
+    if (!Out.IsEmpty())
+    {
+      Out += TEXT("&");
+    }
+
+    Out += FGenericPlatformHttp::UrlEncode(Pair.Key);
+    Out += TEXT("=s");
+    Out += FGenericPlatformHttp::UrlEncode(Pair.Value);
+  }
+
+  return Out;
+}
+
 TMap<FString, FString> FNuxieAndroidBridge::DecodeMap(const FString& Encoded)
 {
   TMap<FString, FString> Out;
@@ -144,15 +309,6 @@ TMap<FString, FString> FNuxieAndroidBridge::DecodeMap(const FString& Encoded)
   return Out;
 }
 
-FString FNuxieAndroidBridge::BuildTriggerOptionsPayload(const FNuxieTriggerOptions& Options)
-{
-  TMap<FString, FString> Sections;
-  Sections.Add(TEXT("properties"), EncodeMap(Options.Properties));
-  Sections.Add(TEXT("user_properties"), EncodeMap(Options.UserProperties));
-  Sections.Add(TEXT("user_properties_set_once"), EncodeMap(Options.UserPropertiesSetOnce));
-  return EncodeMap(Sections);
-}
-
 FString FNuxieAndroidBridge::BuildConfigurePayload(const FNuxieConfigureOptions& Options)
 {
   TMap<FString, FString> Fields;
@@ -161,9 +317,21 @@ FString FNuxieAndroidBridge::BuildConfigurePayload(const FNuxieConfigureOptions&
   Fields.Add(TEXT("console_logging"), Options.bEnableConsoleLogging ? TEXT("1") : TEXT("0"));
   Fields.Add(TEXT("file_logging"), Options.bEnableFileLogging ? TEXT("1") : TEXT("0"));
   Fields.Add(TEXT("debug"), Options.bIsDebugMode ? TEXT("1") : TEXT("0"));
+  Fields.Add(TEXT("purchase_timeout_seconds"), FString::FromInt(FNuxiePurchaseTracker::TimeoutSeconds));
+  AddRuntimeOptionFields(FNuxieRuntimeOptions::FromConfigureOptions(Options), Fields);
   return EncodeMap(Fields);
 }
 
+void FNuxieAndroidBridge::AddRuntimeOptionFields(const FNuxieRuntimeOptions& Options, TMap<FString, FString>& OutFields)
+{
+  OutFields.Add(TEXT("event_batch_size"), FString::FromInt(Options.EventBatchSize));
+  OutFields.Add(TEXT("flush_at"), FString::FromInt(Options.FlushAt));
+  OutFields.Add(TEXT("flush_interval_seconds"), FString::FromInt(Options.FlushIntervalSeconds));
+  OutFields.Add(TEXT("max_queue_size"), FString::FromInt(Options.MaxQueueSize));
+  OutFields.Add(TEXT("retry_count"), FString::FromInt(Options.RetryCount));
+  OutFields.Add(TEXT("request_timeout_seconds"), FString::FromInt(Options.RequestTimeoutSeconds));
+}
+
 FString FNuxieAndroidBridge::BuildPurchaseResultPayload(const FNuxiePurchaseResult& Result)
 {
   TMap<FString, FString> Fields;
@@ -491,7 +659,7 @@ bool FNuxieAndroidBridge::CallVoidMethod(FNuxieError& OutError, const char* Meth
     return false;
   }
 
-  jmethodID Method = Env->GetStaticMethodID(BridgeClass, MethodName, Signature);
+  jmethodID Method = FindStaticMethod(Env, BridgeClass, MethodName, Signature);
   if (Method == nullptr)
   {
     OutError = FNuxieError::Make(BridgeErrorCode, FString::Printf(TEXT("Missing Java method %s"), ANSI_TO_TCHAR(MethodName)));
@@ -526,7 +694,7 @@ bool FNuxieAndroidBridge::CallBoolMethod(FNuxieError& OutError, const char* Meth
     return false;
   }
 
-  jmethodID Method = Env->GetStaticMethodID(BridgeClass, MethodName, Signature);
+  jmethodID Method = FindStaticMethod(Env, BridgeClass, MethodName, Signature);
   if (Method == nullptr)
   {
     OutError = FNuxieError::Make(BridgeErrorCode, FString::Printf(TEXT("Missing Java method %s"), ANSI_TO_TCHAR(MethodName)));
@@ -563,7 +731,7 @@ bool FNuxieAndroidBridge::CallIntMethod(FNuxieError& OutError, const char* Metho
     return false;
   }
 
-  jmethodID Method = Env->GetStaticMethodID(BridgeClass, MethodName, Signature);
+  jmethodID Method = FindStaticMethod(Env, BridgeClass, MethodName, Signature);
   if (Method == nullptr)
   {
     OutError = FNuxieError::Make(BridgeErrorCode, FString::Printf(TEXT("Missing Java method %s"), ANSI_TO_TCHAR(MethodName)));
@@ -600,7 +768,7 @@ bool FNuxieAndroidBridge::CallStringMethod(FNuxieError& OutError, const char* Me
     return false;
   }
 
-  jmethodID Method = Env->GetStaticMethodID(BridgeClass, MethodName, Signature);
+  jmethodID Method = FindStaticMethod(Env, BridgeClass, MethodName, Signature);
   if (Method == nullptr)
   {
     OutError = FNuxieError::Make(BridgeErrorCode, FString::Printf(TEXT("Missing Java method %s"), ANSI_TO_TCHAR(MethodName)));
@@ -691,17 +859,43 @@ bool FNuxieAndroidBridge::Shutdown(FNuxieError& OutError)
   return bSuccess;
 }
 
+bool FNuxieAndroidBridge::UpdateRuntimeOptions(const FNuxieRuntimeOptions& Options, FNuxieError& OutError)
+{
+#if PLATFORM_ANDROID
+  TMap<FString, FString> Fields;
+  AddRuntimeOptionFields(Options, Fields);
+
+  JNIEnv* Env = FAndroidApplication::GetJavaEnv();
+  jstring Payload = Env->NewStringUTF(TCHAR_TO_UTF8(*EncodeMap(Fields)));
+  const bool bSuccess = CallVoidMethod(OutError, "updateRuntimeOptions", "(Ljava/lang/String;)V", Payload);
+  Env->DeleteLocalRef(Payload);
+  return bSuccess;
+#else
+  OutError = FNuxieError::Make(TEXT("NATIVE_UNAVAILABLE"), TEXT("Android bridge JNI wiring is not linked in this build."));
+  return false;
+#endif
+}
+
 bool FNuxieAndroidBridge::Identify(
   const FString& DistinctId,
   const TMap<FString, FString>& UserProperties,
   const TMap<FString, FString>& UserPropertiesSetOnce,
   FNuxieError& OutError)
+{
+  return Identify(DistinctId, FNuxiePropertyBag::FromStringMap(UserProperties), FNuxiePropertyBag::FromStringMap(UserPropertiesSetOnce), OutError);
+}
+
+bool FNuxieAndroidBridge::Identify(
+  const FString& DistinctId,
+  FNuxiePropertyBag&& UserProperties,
+  FNuxiePropertyBag&& UserPropertiesSetOnce,
+  FNuxieError& OutError)
 {
 #if PLATFORM_ANDROID
   JNIEnv* Env = FAndroidApplication::GetJavaEnv();
   jstring Distinct = Env->NewStringUTF(TCHAR_TO_UTF8(*DistinctId));
-  jstring Props = Env->NewStringUTF(TCHAR_TO_UTF8(*EncodeMap(UserProperties)));
-  jstring PropsOnce = Env->NewStringUTF(TCHAR_TO_UTF8(*EncodeMap(UserPropertiesSetOnce)));
+  jstring Props = Env->NewStringUTF(TCHAR_TO_UTF8(*EncodeProperties(UserProperties)));
+  jstring PropsOnce = Env->NewStringUTF(TCHAR_TO_UTF8(*EncodeProperties(UserPropertiesSetOnce)));
 
   const bool bSuccess = CallVoidMethod(
     OutError,
@@ -756,26 +950,37 @@ bool FNuxieAndroidBridge::StartTrigger(
   const FString& EventName,
   const FNuxieTriggerOptions& Options,
   FNuxieError& OutError)
+{
+  return StartTrigger(RequestId, EventName, FNuxiePropertyBag::FromStringMap(Options.Properties), Options, OutError);
+}
+
+bool FNuxieAndroidBridge::StartTrigger(
+  const FString& RequestId,
+  const FString& EventName,
+  FNuxiePropertyBag&& Properties,
+  const FNuxieTriggerOptions& Options,
+  FNuxieError& OutError)
 {
 #if PLATFORM_ANDROID
+  // Hot path: one reusable direct buffer instead of three Java strings built from temporary UTF-8
+  // copies. Java decodes it in NuxieBridge.startTriggerPacked.
+  FTriggerStartScratch& Scratch = TriggerStartScratch;
+  Scratch.Encoder.Encode(RequestId, EventName, Properties, Options);
+
   JNIEnv* Env = FAndroidApplication::GetJavaEnv();
-  jstring Request = Env->NewStringUTF(TCHAR_TO_UTF8(*RequestId));
-  jstring Event = Env->NewStringUTF(TCHAR_TO_UTF8(*EventName));
-  jstring Payload = Env->NewStringUTF(TCHAR_TO_UTF8(*BuildTriggerOptionsPayload(Options)));
+  jobject Buffer = GetPackedBuffer(Env, Scratch);
+  if (Buffer == nullptr)
+  {
+    OutError = FNuxieError::Make(BridgeErrorCode, TEXT("Failed to create the trigger start buffer."));
+    return false;
+  }
 
-  const bool bSuccess = CallVoidMethod(
+  return CallVoidMethod(
     OutError,
-    "startTrigger",
-    "(Ljava/lang/String;Ljava/lang/String;Ljava/lang/String;)V",
-    Request,
-    Event,
-    Payload);
-
-  Env->DeleteLocalRef(Request);
-  Env->DeleteLocalRef(Event);
-  Env->DeleteLocalRef(Payload);
-
-  return bSuccess;
+    "startTriggerPacked",
+    "(Ljava/nio/ByteBuffer;I)V",
+    Buffer,
+    static_cast<jint>(Scratch.Encoder.GetPacked().Num()));
 #else
   OutError = FNuxieError::Make(TEXT("NATIVE_UNAVAILABLE"), TEXT("Android bridge JNI wiring is not linked in this build."));
   return false;
@@ -818,17 +1023,14 @@ void FNuxieAndroidBridge::RunAsyncBool(FNuxieBoolSuccessCallback OnSuccess, FNux
     bool bValue = false;
     bValue = Work(Error);
 
-    AsyncTask(ENamedThreads::GameThread, [OnSuccess = MoveTemp(OnSuccess), OnError = MoveTemp(OnError), Error, bValue]() mutable
+    if (!Error.Code.IsEmpty())
     {
-      if (!Error.Code.IsEmpty())
-      {
-        OnError(Error);
-      }
-      else
-      {
-        OnSuccess(bValue);
-      }
-    });
+      OnError(Error);
+    }
+    else
+    {
+      OnSuccess(bValue);
+    }
   });
 }
 
@@ -840,17 +1042,14 @@ void FNuxieAndroidBridge::RunAsyncInt(FNuxieIntSuccessCallback OnSuccess, FNuxie
     int32 Value = 0;
     Work(Value, Error);
 
-    AsyncTask(ENamedThreads::GameThread, [OnSuccess = MoveTemp(OnSuccess), OnError = MoveTemp(OnError), Error, Value]() mutable
+    if (!Error.Code.IsEmpty())
     {
-      if (!Error.Code.IsEmpty())
-      {
-        OnError(Error);
-      }
-      else
-      {
-        OnSuccess(Value);
-      }
-    });
+      OnError(Error);
+    }
+    else
+    {
+      OnSuccess(Value);
+    }
   });
 }
 
@@ -861,17 +1060,14 @@ void FNuxieAndroidBridge::RunAsyncVoid(FSimpleDelegate OnSuccess, FNuxieErrorCal
     FNuxieError Error;
     Work(Error);
 
-    AsyncTask(ENamedThreads::GameThread, [OnSuccess = MoveTemp(OnSuccess), OnError = MoveTemp(OnError), Error]() mutable
+    if (!Error.Code.IsEmpty())
     {
-      if (!Error.Code.IsEmpty())
-      {
-        OnError(Error);
-      }
-      else
-      {
-        OnSuccess.ExecuteIfBound();
-      }
-    });
+      OnError(Error);
+    }
+    else
+    {
+      OnSuccess.ExecuteIfBound();
+    }
   });
 }
 
@@ -885,17 +1081,11 @@ void FNuxieAndroidBridge::RunAsyncProfile(FNuxieProfileSuccessCallback OnSuccess
 
     if (!CallStringMethod(Error, "refreshProfile", Payload, "()Ljava/lang/String;") || !ParseProfilePayload(Payload, Profile))
     {
-      AsyncTask(ENamedThreads::GameThread, [OnError = MoveTemp(OnError), Error]() mutable
-      {
-        OnError(Error.Code.IsEmpty() ? FNuxieError::Make(BridgeErrorCode, TEXT("Failed to refresh profile.")) : Error);
-      });
+      OnError(Error.Code.IsEmpty() ? FNuxieError::Make(BridgeErrorCode, TEXT("Failed to refresh profile.")) : Error);
       return;
     }
 
-    AsyncTask(ENamedThreads::GameThread, [OnSuccess = MoveTemp(OnSuccess), Profile]() mutable
-    {
-      OnSuccess(Profile);
-    });
+    OnSuccess(Profile);
   });
 }
 
@@ -934,22 +1124,13 @@ void FNuxieAndroidBridge::RunAsyncHasFeature(
     FNuxieFeatureAccess Access;
     if (!bSuccess || !ParseFeatureAccessPayload(Payload, Access))
     {
-      AsyncTask(ENamedThreads::GameThread, [OnError = MoveTemp(OnError), Error]() mutable
-      {
-        OnError(Error.Code.IsEmpty() ? FNuxieError::Make(BridgeErrorCode, TEXT("Failed to fetch feature access.")) : Error);
-      });
+      OnError(Error.Code.IsEmpty() ? FNuxieError::Make(BridgeErrorCode, TEXT("Failed to fetch feature access.")) : Error);
       return;
     }
 
-    AsyncTask(ENamedThreads::GameThread, [OnSuccess = MoveTemp(OnSuccess), Access]() mutable
-    {
-      OnSuccess(Access);
-    });
+    OnSuccess(Access);
 #else
-    AsyncTask(ENamedThreads::GameThread, [OnError = MoveTemp(OnError)]() mutable
-    {
-      OnError(FNuxieError::Make(TEXT("NATIVE_UNAVAILABLE"), TEXT("Android bridge JNI wiring is not linked in this build.")));
-    });
+    OnError(FNuxieError::Make(TEXT("NATIVE_UNAVAILABLE"), TEXT("Android bridge JNI wiring is not linked in this build.")));
 #endif
   });
 }
@@ -993,22 +1174,13 @@ void FNuxieAndroidBridge::RunAsyncCheckFeature(
     FNuxieFeatureCheckResult Result;
     if (!bSuccess || !ParseFeatureCheckPayload(Payload, Result))
     {
-      AsyncTask(ENamedThreads::GameThread, [OnError = MoveTemp(OnError), Error]() mutable
-      {
-        OnError(Error.Code.IsEmpty() ? FNuxieError::Make(BridgeErrorCode, TEXT("Failed to check feature.")) : Error);
-      });
+      OnError(Error.Code.IsEmpty() ? FNuxieError::Make(BridgeErrorCode, TEXT("Failed to check feature.")) : Error);
       return;
     }
 
-    AsyncTask(ENamedThreads::GameThread, [OnSuccess = MoveTemp(OnSuccess), Result]() mutable
-    {
-      OnSuccess(Result);
-    });
+    OnSuccess(Result);
 #else
-    AsyncTask(ENamedThreads::GameThread, [OnError = MoveTemp(OnError)]() mutable
-    {
-      OnError(FNuxieError::Make(TEXT("NATIVE_UNAVAILABLE"), TEXT("Android bridge JNI wiring is not linked in this build.")));
-    });
+    OnError(FNuxieError::Make(TEXT("NATIVE_UNAVAILABLE"), TEXT("Android bridge JNI wiring is not linked in this build.")));
 #endif
   });
 }
@@ -1018,11 +1190,11 @@ void FNuxieAndroidBridge::RunAsyncUseFeatureAndWait(
   float Amount,
   const FString& EntityId,
   bool bSetUsage,
-  const TMap<FString, FString>& Metadata,
+  FString&& MetadataPayload,
   FNuxieFeatureUsageSuccessCallback OnSuccess,
   FNuxieErrorCallback OnError)
 {
-  Async(EAsyncExecution::ThreadPool, [this, FeatureId, Amount, EntityId, bSetUsage, Metadata, OnSuccess = MoveTemp(OnSuccess), OnError = MoveTemp(OnError)]() mutable
+  Async(EAsyncExecution::ThreadPool, [this, FeatureId, Amount, EntityId, bSetUsage, MetadataPayload = MoveTemp(MetadataPayload), OnSuccess = MoveTemp(OnSuccess), OnError = MoveTemp(OnError)]() mutable
   {
     FNuxieError Error;
     FString Payload;
@@ -1031,7 +1203,7 @@ void FNuxieAndroidBridge::RunAsyncUseFeatureAndWait(
     JNIEnv* Env = FAndroidApplication::GetJavaEnv();
     jstring Feature = Env->NewStringUTF(TCHAR_TO_UTF8(*FeatureId));
     jstring Entity = Env->NewStringUTF(TCHAR_TO_UTF8(*EntityId));
-    jstring MetadataPayload = Env->NewStringUTF(TCHAR_TO_UTF8(*EncodeMap(Metadata)));
+    jstring Metadata = Env->NewStringUTF(TCHAR_TO_UTF8(*MetadataPayload));
 
     const bool bSuccess = CallStringMethod(
       Error,
@@ -1042,31 +1214,22 @@ void FNuxieAndroidBridge::RunAsyncUseFeatureAndWait(
       static_cast<jdouble>(Amount),
       Entity,
       static_cast<jboolean>(bSetUsage ? JNI_TRUE : JNI_FALSE),
-      MetadataPayload);
+      Metadata);
 
     Env->DeleteLocalRef(Feature);
     Env->DeleteLocalRef(Entity);
-    Env->DeleteLocalRef(MetadataPayload);
+    Env->DeleteLocalRef(Metadata);
 
     FNuxieFeatureUsageResult Result;
     if (!bSuccess || !ParseFeatureUsagePayload(Payload, Result))
     {
-      AsyncTask(ENamedThreads::GameThread, [OnError = MoveTemp(OnError), Error]() mutable
-      {
-        OnError(Error.Code.IsEmpty() ? FNuxieError::Make(BridgeErrorCode, TEXT("Failed to use feature.")) : Error);
-      });
+      OnError(Error.Code.IsEmpty() ? FNuxieError::Make(BridgeErrorCode, TEXT("Failed to use feature.")) : Error);
       return;
     }
 
-    AsyncTask(ENamedThreads::GameThread, [OnSuccess = MoveTemp(OnSuccess), Result]() mutable
-    {
-      OnSuccess(Result);
-    });
+    OnSuccess(Result);
 #else
-    AsyncTask(ENamedThreads::GameThread, [OnError = MoveTemp(OnError)]() mutable
-    {
-      OnError(FNuxieError::Make(TEXT("NATIVE_UNAVAILABLE"), TEXT("Android bridge JNI wiring is not linked in this build.")));
-    });
+    OnError(FNuxieError::Make(TEXT("NATIVE_UNAVAILABLE"), TEXT("Android bridge JNI wiring is not linked in this build.")));
 #endif
   });
 }
@@ -1103,12 +1266,22 @@ bool FNuxieAndroidBridge::UseFeature(
   const FString& EntityId,
   const TMap<FString, FString>& Metadata,
   FNuxieError& OutError)
+{
+  return UseFeature(FeatureId, Amount, EntityId, FNuxiePropertyBag::FromStringMap(Metadata), OutError);
+}
+
+bool FNuxieAndroidBridge::UseFeature(
+  const FString& FeatureId,
+  float Amount,
+  const FString& EntityId,
+  FNuxiePropertyBag&& Metadata,
+  FNuxieError& OutError)
 {
 #if PLATFORM_ANDROID
   JNIEnv* Env = FAndroidApplication::GetJavaEnv();
   jstring Feature = Env->NewStringUTF(TCHAR_TO_UTF8(*FeatureId));
   jstring Entity = Env->NewStringUTF(TCHAR_TO_UTF8(*EntityId));
-  jstring MetadataPayload = Env->NewStringUTF(TCHAR_TO_UTF8(*EncodeMap(Metadata)));
+  jstring MetadataPayload = Env->NewStringUTF(TCHAR_TO_UTF8(*EncodeProperties(Metadata)));
 
   const bool bSuccess = CallVoidMethod(
     OutError,
@@ -1138,7 +1311,19 @@ void FNuxieAndroidBridge::UseFeatureAndWaitAsync(
   FNuxieFeatureUsageSuccessCallback OnSuccess,
   FNuxieErrorCallback OnError)
 {
-  RunAsyncUseFeatureAndWait(FeatureId, Amount, EntityId, bSetUsage, Metadata, MoveTemp(OnSuccess), MoveTemp(OnError));
+  RunAsyncUseFeatureAndWait(FeatureId, Amount, EntityId, bSetUsage, EncodeProperties(Metadata), MoveTemp(OnSuccess), MoveTemp(OnError));
+}
+
+void FNuxieAndroidBridge::UseFeatureAndWaitAsync(
+  const FString& FeatureId,
+  float Amount,
+  const FString& EntityId,
+  bool bSetUsage,
+  FNuxiePropertyBag&& Metadata,
+  FNuxieFeatureUsageSuccessCallback OnSuccess,
+  FNuxieErrorCallback OnError)
+{
+  RunAsyncUseFeatureAndWait(FeatureId, Amount, EntityId, bSetUsage, EncodeProperties(Metadata), MoveTemp(OnSuccess), MoveTemp(OnError));
 }
 
 void FNuxieAndroidBridge::FlushEventsAsync(FNuxieBoolSuccessCallback OnSuccess, FNuxieErrorCallback OnError)
@@ -1253,7 +1438,8 @@ void FNuxieAndroidBridge::HandleFeatureAccessChanged(const FString& FeatureId, c
   FNuxieFeatureAccess To;
   ParseFeatureAccessPayload(FromPayload, From);
   ParseFeatureAccessPayload(ToPayload, To);
-  Listener->OnFeatureAccessChanged(FeatureId, From, To);
+  // A profile sync reports each flipped entitlement separately; hand them over as one batch.
+  FeatureAccessBatcher->Enqueue(FeatureId, From, To);
 }
 
 void FNuxieAndroidBridge::HandlePurchaseRequest(const FString& Payload)
@@ -2,6 +2,8 @@
 
 #include "NuxiePlatformBridge.h"
 
+class FNuxieFeatureAccessBatcher;
+
 class FNuxieAndroidBridge final : public INuxiePlatformBridge
 {
 public:
@@ -12,11 +14,17 @@ public:
 
   virtual bool Configure(const FNuxieConfigureOptions& Options, FNuxieError& OutError) override;
   virtual bool Shutdown(FNuxieError& OutError) override;
+  virtual bool UpdateRuntimeOptions(const FNuxieRuntimeOptions& Options, FNuxieError& OutError) override;
   virtual bool Identify(
     const FString& DistinctId,
     const TMap<FString, FString>& UserProperties,
     const TMap<FString, FString>& UserPropertiesSetOnce,
     FNuxieError& OutError) override;
+  virtual bool Identify(
+    const FString& DistinctId,
+    FNuxiePropertyBag&& UserProperties,
+    FNuxiePropertyBag&& UserPropertiesSetOnce,
+    FNuxieError& OutError) override;
   virtual bool Reset(bool bKeepAnonymousId, FNuxieError& OutError) override;
   virtual FString GetDistinctId() const override;
   virtual FString GetAnonymousId() const override;
@@ -26,6 +34,12 @@ public:
     const FString& EventName,
     const FNuxieTriggerOptions& Options,
     FNuxieError& OutError) override;
+  virtual bool StartTrigger(
+    const FString& RequestId,
+    const FString& EventName,
+    FNuxiePropertyBag&& Properties,
+    const FNuxieTriggerOptions& Options,
+    FNuxieError& OutError) override;
   virtual bool CancelTrigger(const FString& RequestId, FNuxieError& OutError) override;
   virtual bool ShowFlow(const FString& FlowId, FNuxieError& OutError) override;
   virtual void RefreshProfileAsync(FNuxieProfileSuccessCallback OnSuccess, FNuxieErrorCallback OnError) override;
@@ -48,6 +62,12 @@ public:
     const FString& EntityId,
     const TMap<FString, FString>& Metadata,
     FNuxieError& OutError) override;
+  virtual bool UseFeature(
+    const FString& FeatureId,
+    float Amount,
+    const FString& EntityId,
+    FNuxiePropertyBag&& Metadata,
+    FNuxieError& OutError) override;
   virtual void UseFeatureAndWaitAsync(
     const FString& FeatureId,
     float Amount,
@@ -56,6 +76,14 @@ public:
     const TMap<FString, FString>& Metadata,
     FNuxieFeatureUsageSuccessCallback OnSuccess,
     FNuxieErrorCallback OnError) override;
+  virtual void UseFeatureAndWaitAsync(
+    const FString& FeatureId,
+    float Amount,
+    const FString& EntityId,
+    bool bSetUsage,
+    FNuxiePropertyBag&& Metadata,
+    FNuxieFeatureUsageSuccessCallback OnSuccess,
+    FNuxieErrorCallback OnError) override;
   virtual void FlushEventsAsync(FNuxieBoolSuccessCallback OnSuccess, FNuxieErrorCallback OnError) override;
   virtual void GetQueuedEventCountAsync(FNuxieIntSuccessCallback OnSuccess, FNuxieErrorCallback OnError) override;
   virtual void PauseEventQueueAsync(FSimpleDelegate OnSuccess, FNuxieErrorCallback OnError) override;
@@ -72,9 +100,11 @@ public:
 
 private:
   static FString EncodeMap(const TMap<FString, FString>& Values);
+  static FString EncodeProperties(const FNuxiePropertyBag& Properties);
+  static FString EncodeProperties(const TMap<FString, FString>& Properties);
   static TMap<FString, FString> DecodeMap(const FString& Encoded);
-  static FString BuildTriggerOptionsPayload(const FNuxieTriggerOptions& Options);
   static FString BuildConfigurePayload(const FNuxieConfigureOptions& Options);
+  static void AddRuntimeOptionFields(const FNuxieRuntimeOptions& Options, TMap<FString, FString>& OutFields);
   static FString BuildPurchaseResultPayload(const FNuxiePurchaseResult& Result);
   static FString BuildRestoreResultPayload(const FNuxieRestoreResult& Result);
 
@@ -108,15 +138,17 @@ private:
     bool bForceRefresh,
     FNuxieFeatureCheckSuccessCallback OnSuccess,
     FNuxieErrorCallback OnError);
+  /** MetadataPayload is encoded by the caller and moved into the pool task. */
   void RunAsyncUseFeatureAndWait(
     const FString& FeatureId,
     float Amount,
     const FString& EntityId,
     bool bSetUsage,
-    const TMap<FString, FString>& Metadata,
+    FString&& MetadataPayload,
     FNuxieFeatureUsageSuccessCallback OnSuccess,
     FNuxieErrorCallback OnError);
 
   INuxiePlatformBridgeListener* Listener = nullptr;
+  TSharedRef<FNuxieFeatureAccessBatcher, ESPMode::ThreadSafe> FeatureAccessBatcher;
   bool bConfigured = false;
 };
@@ -0,0 +1,1044 @@
+#include "Platform/Http/NuxieHttpBridge.h"
+
+#include "Async/Async.h"
+#include "Containers/Ticker.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "HAL/CriticalSection.h"
+#include "HttpManager.h"
+#include "HttpModule.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Guid.h"
+#include "Misc/Paths.h"
+#include "NuxieCampaignEventIndex.h"
+#include "Platform/Http/NuxieHttpTransport.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+namespace
+{
+  static constexpr const TCHAR* BridgeErrorCode = TEXT("NATIVE_ERROR");
+  static constexpr const TCHAR* DefaultApiEndpoint = TEXT("https://i.nuxie.io");
+  static constexpr const TCHAR* WrapperVersion = TEXT("0.1.0");
+
+  static constexpr const TCHAR* BatchPath = TEXT("/v1/batch");
+  static constexpr const TCHAR* ProfilePath = TEXT("/v1/profile");
+  static constexpr const TCHAR* EntitledPath = TEXT("/v1/entitled");
+  static constexpr const TCHAR* UsagePath = TEXT("/v1/usage");
+
+  // How long Shutdown waits for the last batches. Deinitialize blocks on it, so keep it short.
+  constexpr int32 ShutdownFlushSeconds = 3;
+
+  FNuxieError NotConfiguredError()
+  {
+    return FNuxieError::Make(TEXT("NATIVE_UNAVAILABLE"), TEXT("Nuxie HTTP bridge is not configured."));
+  }
+
+  FNuxieError UnsupportedError(const TCHAR* Message)
+  {
+    return FNuxieError::Make(TEXT("NATIVE_UNAVAILABLE"), Message);
+  }
+
+  FNuxieError HttpError(int32 Status, const TCHAR* What)
+  {
+    return Status == 0
+      ? FNuxieError::Make(BridgeErrorCode, FString::Printf(TEXT("%s: no response from the Nuxie API."), What))
+      : FNuxieError::Make(BridgeErrorCode, FString::Printf(TEXT("%s: Nuxie API returned HTTP %d."), What, Status));
+  }
+
+  FString NewAnonymousId()
+  {
+    return FString::Printf(TEXT("anon_%s"), *FGuid::NewGuid().ToString(EGuidFormats::Digits));
+  }
+
+  FString ToJsonString(const TSharedRef<FJsonObject>& Object)
+  {
+    FString Out;
+    const TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer =
+      TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Out);
+    FJsonSerializer::Serialize(Object, Writer);
+    return Out;
+  }
+
+  TSharedPtr<FJsonObject> ParseJsonObject(const FString& Json)
+  {
+    TSharedPtr<FJsonObject> Object;
+    const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Json);
+    if (!FJsonSerializer::Deserialize(Reader, Object))
+    {
+      return nullptr;
+    }
+    return Object;
+  }
+
+  TSharedRef<FJsonObject> ToJsonObject(const TMap<FString, FString>& Values)
+  {
+    const TSharedRef<FJsonObject> Object = MakeShared<FJsonObject>();
+    for (const TPair<FString, FString>& Pair : Values)
+    {
+      Object->SetStringField(Pair.Key, Pair.Value);
+    }
+    return Object;
+  }
+
+  TSharedRef<FJsonObject> ToJsonObject(const FNuxiePropertyBag& Values)
+  {
+    const TSharedRef<FJsonObject> Object = MakeShared<FJsonObject>();
+    for (const FNuxiePropertyBag::FProperty& Property : Values)
+    {
+      const FString Key(Property.Key);
+      switch (Property.Type)
+      {
+      case ENuxiePropertyType::Int:
+        // Written as digits so values beyond 2^53 are not rounded through a double.
+        Object->SetField(Key, MakeShared<FJsonValueNumberString>(FString::Printf(TEXT("%lld"), Property.Int)));
+        break;
+      case ENuxiePropertyType::Double:
+        Object->SetNumberField(Key, Property.Double);
+        break;
+      case ENuxiePropertyType::Bool:
+        Object->SetBoolField(Key, Property.bBool);
+        break;
+      case ENuxiePropertyType::String:
+      default:
+        Object->SetStringField(Key, FString(Property.String));
+        break;
+      }
+    }
+    return Object;
+  }
+
+  ENuxieFeatureType ParseFeatureType(const FString& Type)
+  {
+    if (Type == TEXT("metered"))
+    {
+      return ENuxieFeatureType::Metered;
+    }
+    if (Type == TEXT("creditSystem") || Type == TEXT("credit_system"))
+    {
+      return ENuxieFeatureType::CreditSystem;
+    }
+    return ENuxieFeatureType::Boolean;
+  }
+
+  void ParseFeatureCheck(const FJsonObject& Object, FNuxieFeatureCheckResult& OutResult)
+  {
+    Object.TryGetStringField(TEXT("customer_id"), OutResult.CustomerId);
+    Object.TryGetStringField(TEXT("feature_id"), OutResult.FeatureId);
+    Object.TryGetNumberField(TEXT("required_balance"), OutResult.RequiredBalance);
+    Object.TryGetStringField(TEXT("code"), OutResult.Code);
+
+    FNuxieFeatureAccess& Access = OutResult.Access;
+    Object.TryGetBoolField(TEXT("allowed"), Access.bAllowed);
+    Object.TryGetBoolField(TEXT("unlimited"), Access.bUnlimited);
+    Access.bHasBalance = Object.TryGetNumberField(TEXT("balance"), Access.Balance);
+
+    FString Type;
+    Object.TryGetStringField(TEXT("type"), Type);
+    Access.Type = ParseFeatureType(Type);
+
+    const TSharedPtr<FJsonObject>* Preview = nullptr;
+    if (Object.TryGetObjectField(TEXT("preview"), Preview))
+    {
+      OutResult.PreviewJson = ToJsonString(Preview->ToSharedRef());
+    }
+  }
+
+  void ParseFeatureUsage(const FJsonObject& Object, FNuxieFeatureUsageResult& OutResult)
+  {
+    Object.TryGetBoolField(TEXT("success"), OutResult.bSuccess);
+    Object.TryGetStringField(TEXT("feature_id"), OutResult.FeatureId);
+    Object.TryGetNumberField(TEXT("amount_used"), OutResult.AmountUsed);
+    Object.TryGetStringField(TEXT("message"), OutResult.Message);
+
+    const TSharedPtr<FJsonObject>* Usage = nullptr;
+    if (Object.TryGetObjectField(TEXT("usage"), Usage))
+    {
+      OutResult.bHasUsage = true;
+      (*Usage)->TryGetNumberField(TEXT("current"), OutResult.UsageCurrent);
+      OutResult.bHasUsageLimit = (*Usage)->TryGetNumberField(TEXT("limit"), OutResult.UsageLimit);
+      OutResult.bHasUsageRemaining = (*Usage)->TryGetNumberField(TEXT("remaining"), OutResult.UsageRemaining);
+    }
+  }
+}
+
+/**
+ * State behind FNuxieHttpBridge: identity, the event queue and the campaign index used to decide
+ * triggers. Events are serialized when tracked and sent in batches of EventBatchSize, once FlushAt
+ * events are queued or FlushIntervalSeconds have passed. A batch leaves the queue only when the API
+ * acknowledges it; one batch is in flight at a time so events arrive in order. Thread-safe.
+ */
+class FNuxieHttpSession final : public TSharedFromThis<FNuxieHttpSession, ESPMode::ThreadSafe>
+{
+public:
+  FNuxieHttpSession()
+    : Transport(MakeShared<FNuxieHttpTransport, ESPMode::ThreadSafe>())
+  {
+  }
+
+  ~FNuxieHttpSession()
+  {
+    FTSTicker::GetCoreTicker().RemoveTicker(FlushTicker);
+  }
+
+  void SetListener(INuxiePlatformBridgeListener* InListener)
+  {
+    FScopeLock Lock(&ListenerMutex);
+    Listener = InListener;
+  }
+
+  bool Configure(const FNuxieConfigureOptions& Options, FNuxieError& OutError)
+  {
+    if (Options.ApiKey.IsEmpty())
+    {
+      OutError = FNuxieError::Make(BridgeErrorCode, TEXT("An API key is required."));
+      return false;
+    }
+
+    FNuxieHttpTransportSettings Settings;
+    Settings.BaseUrl = Options.ApiEndpoint.IsEmpty() ? FString(DefaultApiEndpoint) : Options.ApiEndpoint;
+    Settings.ApiKey = Options.ApiKey;
+    Settings.UserAgent = FString::Printf(TEXT("nuxie-ue/%s (%s)"), WrapperVersion, ANSI_TO_TCHAR(FPlatformProperties::IniPlatformName()));
+    Settings.RetryCount = Options.RetryCount;
+    Settings.RetryDelaySeconds = Options.RetryDelaySeconds;
+    Settings.TimeoutSeconds = Options.RequestTimeoutSeconds;
+    Settings.bCompress = Options.bEnableCompression;
+    Transport->SetSettings(Settings);
+
+    {
+      FScopeLock Lock(&Mutex);
+      RuntimeOptions = FNuxieRuntimeOptions::FromConfigureOptions(Options);
+      AnonymousId = LoadAnonymousId();
+      DistinctId = AnonymousId;
+      bIdentified = false;
+      bConfigured = true;
+      LastFlushSeconds = FPlatformTime::Seconds();
+    }
+
+    if (!FlushTicker.IsValid())
+    {
+      const TWeakPtr<FNuxieHttpSession, ESPMode::ThreadSafe> WeakThis = AsShared();
+      FlushTicker = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([WeakThis](float)
+      {
+        if (const TSharedPtr<FNuxieHttpSession, ESPMode::ThreadSafe> This = WeakThis.Pin())
+        {
+          This->TickFlushInterval();
+        }
+        return true;
+      }), 1.0f);
+    }
+
+    // Campaigns for trigger decisions; a trigger started before this returns waits for it.
+    FetchProfile([](const FNuxieProfileResponse&) {}, [](const FNuxieError&) {});
+    return true;
+  }
+
+  /**
+   * Gives whatever is queued one last attempt and waits for it, pumping the HTTP module, for at
+   * most ShutdownFlushSeconds. The session dies with the bridge, so nothing is retried later.
+   * Returns false when events are still queued, so the caller knows they were not sent.
+   */
+  bool Shutdown()
+  {
+    FTSTicker::GetCoreTicker().RemoveTicker(FlushTicker);
+    FlushTicker.Reset();
+
+    // Retries are scheduled on the core ticker, which does not run during the wait.
+    Transport->SetLimits(0, ShutdownFlushSeconds);
+    Flush(nullptr);
+
+    const double Deadline = FPlatformTime::Seconds() + ShutdownFlushSeconds;
+    while (HasBatchInFlight() && FPlatformTime::Seconds() < Deadline)
+    {
+      FHttpModule::Get().GetHttpManager().Tick(0.0f);
+      FPlatformProcess::SleepNoStats(0.005f);
+    }
+
+    FScopeLock Lock(&Mutex);
+    bConfigured = false;
+    return PendingEvents.Num() == 0;
+  }
+
+  bool IsConfigured() const
+  {
+    FScopeLock Lock(&Mutex);
+    return bConfigured;
+  }
+
+  void SetRuntimeOptions(const FNuxieRuntimeOptions& Options)
+  {
+    Transport->SetLimits(Options.RetryCount, Options.RequestTimeoutSeconds);
+
+    bool bShouldFlush = false;
+    {
+      FScopeLock Lock(&Mutex);
+      RuntimeOptions = Options;
+      TrimQueue();
+      bShouldFlush = !bPaused && PendingEvents.Num() >= RuntimeOptions.FlushAt;
+    }
+
+    if (bShouldFlush)
+    {
+      Flush(nullptr);
+    }
+  }
+
+  void Identify(const FString& InDistinctId, const FNuxiePropertyBag& UserProperties, const FNuxiePropertyBag& UserPropertiesSetOnce)
+  {
+    FString PreviousId;
+    {
+      FScopeLock Lock(&Mutex);
+      PreviousId = DistinctId;
+      DistinctId = InDistinctId;
+      bIdentified = true;
+      CampaignEventIndex.Reset();
+      bHasProfile = false;
+    }
+
+    const TSharedRef<FJsonObject> Properties = MakeShared<FJsonObject>();
+    Properties->SetStringField(TEXT("$anon_distinct_id"), PreviousId);
+    Properties->SetObjectField(TEXT("$set"), ToJsonObject(UserProperties));
+    Properties->SetObjectField(TEXT("$set_once"), ToJsonObject(UserPropertiesSetOnce));
+    Track(TEXT("$identify"), Properties);
+
+    FetchProfile([](const FNuxieProfileResponse&) {}, [](const FNuxieError&) {});
+  }
+
+  void Reset(bool bKeepAnonymousId)
+  {
+    {
+      FScopeLock Lock(&Mutex);
+      if (!bKeepAnonymousId)
+      {
+        AnonymousId = NewAnonymousId();
+        SaveAnonymousId(AnonymousId);
+      }
+      DistinctId = AnonymousId;
+      bIdentified = false;
+      CampaignEventIndex.Reset();
+      bHasProfile = false;
+    }
+
+    FetchProfile([](const FNuxieProfileResponse&) {}, [](const FNuxieError&) {});
+  }
+
+  FString GetDistinctId() const
+  {
+    FScopeLock Lock(&Mutex);
+    return DistinctId;
+  }
+
+  FString GetAnonymousId() const
+  {
+    FScopeLock Lock(&Mutex);
+    return AnonymousId;
+  }
+
+  bool IsIdentified() const
+  {
+    FScopeLock Lock(&Mutex);
+    return bIdentified;
+  }
+
+  void Track(const FString& EventName, const TSharedRef<FJsonObject>& Properties)
+  {
+    const TSharedRef<FJsonObject> Event = MakeShared<FJsonObject>();
+    Event->SetStringField(TEXT("uuid"), FGuid::NewGuid().ToString(EGuidFormats::DigitsWithHyphensLower));
+    Event->SetStringField(TEXT("event"), EventName);
+    Event->SetStringField(TEXT("timestamp"), FDateTime::UtcNow().ToIso8601());
+    Event->SetObjectField(TEXT("properties"), Properties);
+
+    bool bShouldFlush = false;
+    {
+      FScopeLock Lock(&Mutex);
+      Event->SetStringField(TEXT("distinct_id"), DistinctId);
+      PendingEvents.Add(ToJsonString(Event));
+      TrimQueue();
+      bShouldFlush = !bPaused && PendingEvents.Num() >= RuntimeOptions.FlushAt;
+    }
+
+    if (bShouldFlush)
+    {
+      Flush(nullptr);
+    }
+  }
+
+  /** Sends every queued event. OnComplete (optional) reports whether they were all acknowledged. */
+  void Flush(FNuxieBoolSuccessCallback OnComplete)
+  {
+    {
+      FScopeLock Lock(&Mutex);
+      if (OnComplete)
+      {
+        FlushWaiters.Add(MoveTemp(OnComplete));
+      }
+      bDrainRequested = true;
+      if (InFlightCount > 0)
+      {
+        return;
+      }
+    }
+    SendNextBatch();
+  }
+
+  bool HasBatchInFlight() const
+  {
+    FScopeLock Lock(&Mutex);
+    return InFlightCount > 0;
+  }
+
+  int32 NumQueued() const
+  {
+    FScopeLock Lock(&Mutex);
+    return PendingEvents.Num();
+  }
+
+  void SetPaused(bool bInPaused)
+  {
+    FScopeLock Lock(&Mutex);
+    bPaused = bInPaused;
+  }
+
+  void Post(const TCHAR* Path, const TSharedRef<FJsonObject>& Body, FNuxieHttpResponseCallback OnComplete)
+  {
+    Body->SetStringField(TEXT("distinct_id"), GetDistinctId());
+    Transport->Post(Path, ToJsonString(Body), MoveTemp(OnComplete));
+  }
+
+  void FetchProfile(FNuxieProfileSuccessCallback OnSuccess, FNuxieErrorCallback OnError)
+  {
+    const TWeakPtr<FNuxieHttpSession, ESPMode::ThreadSafe> WeakThis = AsShared();
+    Post(ProfilePath, MakeShared<FJsonObject>(), [WeakThis, OnSuccess = MoveTemp(OnSuccess), OnError = MoveTemp(OnError)](int32 Status, const FString& Body)
+    {
+      const TSharedPtr<FNuxieHttpSession, ESPMode::ThreadSafe> This = WeakThis.Pin();
+      const TSharedPtr<FJsonObject> Object = FNuxieHttpTransport::IsSuccess(Status) ? ParseJsonObject(Body) : nullptr;
+      if (!Object.IsValid())
+      {
+        const FNuxieError Error = Status != 0 && FNuxieHttpTransport::IsSuccess(Status)
+          ? FNuxieError::Make(BridgeErrorCode, TEXT("Failed to refresh profile."))
+          : HttpError(Status, TEXT("Failed to refresh profile"));
+        if (This.IsValid())
+        {
+          This->ResolvePendingTriggers(&Error);
+        }
+        OnError(Error);
+        return;
+      }
+
+      FNuxieProfileResponse Profile;
+      Profile.RawJson = Body;
+      Object->TryGetStringField(TEXT("customer_id"), Profile.CustomerId);
+
+      if (This.IsValid())
+      {
+        {
+          FScopeLock Lock(&This->Mutex);
+          This->CampaignEventIndex.LoadProfileJson(Body);
+          This->bHasProfile = true;
+        }
+        This->ResolvePendingTriggers(nullptr);
+      }
+      OnSuccess(Profile);
+    });
+  }
+
+  /**
+   * Flows cannot be presented here. A trigger that matches no campaign gets a NoMatch decision;
+   * one a campaign listens for ends with a FLOWS_UNSUPPORTED error, since the bridge cannot tell
+   * what the campaign would have decided. Both are terminal.
+   */
+  void DecideTrigger(const FString& RequestId, const FString& EventName)
+  {
+    {
+      FScopeLock Lock(&Mutex);
+      if (!bHasProfile)
+      {
+        PendingTriggers.Add({ RequestId, EventName });
+        return;
+      }
+    }
+
+    // Never inline: the caller has not seen the request id yet.
+    const TSharedRef<FNuxieHttpSession, ESPMode::ThreadSafe> This = AsShared();
+    Async(EAsyncExecution::ThreadPool, [This, RequestId, EventName]()
+    {
+      This->EmitDecision(RequestId, EventName);
+    });
+  }
+
+  void CancelTrigger(const FString& RequestId)
+  {
+    FScopeLock Lock(&Mutex);
+    PendingTriggers.RemoveAll([&RequestId](const FPendingTrigger& Pending) { return Pending.RequestId == RequestId; });
+  }
+
+private:
+  struct FPendingTrigger
+  {
+    FString RequestId;
+    FString EventName;
+  };
+
+  static FString GetAnonymousIdPath()
+  {
+    return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Nuxie"), TEXT("AnonymousId.txt"));
+  }
+
+  static FString LoadAnonymousId()
+  {
+    FString Id;
+    if (FFileHelper::LoadFileToString(Id, *GetAnonymousIdPath()) && !Id.TrimStartAndEnd().IsEmpty())
+    {
+      return Id.TrimStartAndEnd();
+    }
+
+    Id = NewAnonymousId();
+    SaveAnonymousId(Id);
+    return Id;
+  }
+
+  static void SaveAnonymousId(const FString& Id)
+  {
+    FFileHelper::SaveStringToFile(Id, *GetAnonymousIdPath());
+  }
+
+  /** Drops the oldest events beyond MaxQueueSize, never the batch in flight. Mutex held. */
+  void TrimQueue()
+  {
+    const int32 Excess = PendingEvents.Num() - FMath::Max(RuntimeOptions.MaxQueueSize, InFlightCount);
+    if (Excess > 0)
+    {
+      PendingEvents.RemoveAt(InFlightCount, Excess);
+    }
+  }
+
+  void TickFlushInterval()
+  {
+    {
+      FScopeLock Lock(&Mutex);
+      const double Now = FPlatformTime::Seconds();
+      if (bPaused || InFlightCount > 0 || PendingEvents.Num() == 0 || Now - LastFlushSeconds < RuntimeOptions.FlushIntervalSeconds)
+      {
+        return;
+      }
+    }
+    Flush(nullptr);
+  }
+
+  void SendNextBatch()
+  {
+    FString Body;
+    TArray<FNuxieBoolSuccessCallback> Waiters;
+    {
+      FScopeLock Lock(&Mutex);
+      LastFlushSeconds = FPlatformTime::Seconds();
+      if (PendingEvents.Num() == 0)
+      {
+        bDrainRequested = false;
+        Waiters = MoveTemp(FlushWaiters);
+      }
+      else
+      {
+        // Events are already JSON; splice them into the envelope instead of re-serializing.
+        InFlightCount = FMath::Min(PendingEvents.Num(), FMath::Max(RuntimeOptions.EventBatchSize, 1));
+        Body = TEXT("{\"batch\":[");
+        for (int32 Index = 0; Index < InFlightCount; ++Index)
+        {
+          Body += Index > 0 ? TEXT(",") : TEXT("");
+          Body += PendingEvents[Index];
+        }
+        Body += FString::Printf(TEXT("],\"sent_at\":\"%s\"}"), *FDateTime::UtcNow().ToIso8601());
+      }
+    }
+
+    if (Body.IsEmpty())
+    {
+      for (FNuxieBoolSuccessCallback& Waiter : Waiters)
+      {
+        Waiter(true);
+      }
+      return;
+    }
+
+    const TWeakPtr<FNuxieHttpSession, ESPMode::ThreadSafe> WeakThis = AsShared();
+    Transport->Post(BatchPath, Body, [WeakThis](int32 Status, const FString&)
+    {
+      if (const TSharedPtr<FNuxieHttpSession, ESPMode::ThreadSafe> This = WeakThis.Pin())
+      {
+        This->OnBatchComplete(Status);
+      }
+    });
+  }
+
+  void OnBatchComplete(int32 Status)
+  {
+    bool bContinue = false;
+    TArray<FNuxieBoolSuccessCallback> Waiters;
+    {
+      FScopeLock Lock(&Mutex);
+
+      // A 4xx other than 408/429 will never succeed; keeping the batch would block the queue.
+      const bool bDrop = FNuxieHttpTransport::IsSuccess(Status) || !FNuxieHttpTransport::IsRetryable(Status);
+      if (bDrop)
+      {
+        PendingEvents.RemoveAt(0, InFlightCount);
+      }
+      InFlightCount = 0;
+
+      if (FNuxieHttpTransport::IsSuccess(Status) && PendingEvents.Num() > 0 && (bDrainRequested || PendingEvents.Num() >= RuntimeOptions.FlushAt))
+      {
+        bContinue = true;
+      }
+      else
+      {
+        // Failed batches stay queued for the next flush; the transport has already retried.
+        bDrainRequested = false;
+        Waiters = MoveTemp(FlushWaiters);
+        TrimQueue();
+      }
+    }
+
+    if (bContinue)
+    {
+      SendNextBatch();
+      return;
+    }
+
+    const bool bSuccess = FNuxieHttpTransport::IsSuccess(Status);
+    for (FNuxieBoolSuccessCallback& Waiter : Waiters)
+    {
+      Waiter(bSuccess);
+    }
+  }
+
+  void ResolvePendingTriggers(const FNuxieError* Error)
+  {
+    TArray<FPendingTrigger> Triggers;
+    {
+      FScopeLock Lock(&Mutex);
+      Triggers = MoveTemp(PendingTriggers);
+    }
+
+    for (const FPendingTrigger& Trigger : Triggers)
+    {
+      if (Error != nullptr)
+      {
+        FNuxieTriggerUpdate Update;
+        Update.Kind = ENuxieTriggerUpdateKind::Error;
+        Update.Error = *Error;
+        Update.bIsTerminal = true;
+        Update.TimestampMs = FDateTime::UtcNow().ToUnixTimestamp() * 1000;
+        EmitTriggerUpdate(Trigger.RequestId, Update);
+      }
+      else
+      {
+        EmitDecision(Trigger.RequestId, Trigger.EventName);
+      }
+    }
+  }
+
+  void EmitDecision(const FString& RequestId, const FString& EventName)
+  {
+    bool bCanMatch = false;
+    {
+      FScopeLock Lock(&Mutex);
+      bCanMatch = CampaignEventIndex.CanMatch(EventName);
+    }
+
+    FNuxieTriggerUpdate Update;
+    if (bCanMatch)
+    {
+      Update.Kind = ENuxieTriggerUpdateKind::Error;
+      Update.Error = FNuxieError::Make(
+        TEXT("FLOWS_UNSUPPORTED"),
+        FString::Printf(TEXT("A campaign listens for '%s', but the Nuxie HTTP bridge cannot present flows."), *EventName));
+    }
+    else
+    {
+      Update.Kind = ENuxieTriggerUpdateKind::Decision;
+      Update.DecisionKind = ENuxieTriggerDecisionKind::NoMatch;
+    }
+    Update.bIsTerminal = true;
+    Update.TimestampMs = FDateTime::UtcNow().ToUnixTimestamp() * 1000;
+    EmitTriggerUpdate(RequestId, Update);
+  }
+
+  void EmitTriggerUpdate(const FString& RequestId, const FNuxieTriggerUpdate& Update)
+  {
+    FScopeLock Lock(&ListenerMutex);
+    if (Listener != nullptr)
+    {
+      Listener->OnTriggerUpdate(RequestId, Update);
+    }
+  }
+
+  TSharedRef<FNuxieHttpTransport, ESPMode::ThreadSafe> Transport;
+  FTSTicker::FDelegateHandle FlushTicker;
+
+  FCriticalSection ListenerMutex;
+  INuxiePlatformBridgeListener* Listener = nullptr;
+
+  mutable FCriticalSection Mutex;
+  bool bConfigured = false;
+  FNuxieRuntimeOptions RuntimeOptions;
+  FString DistinctId;
+  FString AnonymousId;
+  bool bIdentified = false;
+
+  TArray<FString> PendingEvents;
+  int32 InFlightCount = 0;
+  bool bPaused = false;
+  bool bDrainRequested = false;
+  double LastFlushSeconds = 0.0;
+  TArray<FNuxieBoolSuccessCallback> FlushWaiters;
+
+  FNuxieCampaignEventIndex CampaignEventIndex;
+  bool bHasProfile = false;
+  TArray<FPendingTrigger> PendingTriggers;
+};
+
+FNuxieHttpBridge::FNuxieHttpBridge()
+  : Session(MakeShared<FNuxieHttpSession, ESPMode::ThreadSafe>())
+{
+}
+
+FNuxieHttpBridge::~FNuxieHttpBridge()
+{
+  Session->SetListener(nullptr);
+}
+
+void FNuxieHttpBridge::SetListener(INuxiePlatformBridgeListener* InListener)
+{
+  Session->SetListener(InListener);
+}
+
+bool FNuxieHttpBridge::Configure(const FNuxieConfigureOptions& Options, FNuxieError& OutError)
+{
+  return Session->Configure(Options, OutError);
+}
+
+bool FNuxieHttpBridge::Shutdown(FNuxieError& OutError)
+{
+  if (!Session->IsConfigured())
+  {
+    OutError = NotConfiguredError();
+    return false;
+  }
+
+  if (!Session->Shutdown())
+  {
+    // Not a clean shutdown: the subsystem keeps the journaled uses for the next session to replay.
+    OutError = FNuxieError::Make(BridgeErrorCode, TEXT("Queued events could not be sent before shutdown."));
+    return false;
+  }
+  return true;
+}
+
+bool FNuxieHttpBridge::UpdateRuntimeOptions(const FNuxieRuntimeOptions& Options, FNuxieError& OutError)
+{
+  if (!Session->IsConfigured())
+  {
+    OutError = NotConfiguredError();
+    return false;
+  }
+
+  Session->SetRuntimeOptions(Options);
+  return true;
+}
+
+bool FNuxieHttpBridge::Identify(
+  const FString& DistinctId,
+  const TMap<FString, FString>& UserProperties,
+  const TMap<FString, FString>& UserPropertiesSetOnce,
+  FNuxieError& OutError)
+{
+  return Identify(DistinctId, FNuxiePropertyBag::FromStringMap(UserProperties), FNuxiePropertyBag::FromStringMap(UserPropertiesSetOnce), OutError);
+}
+
+bool FNuxieHttpBridge::Identify(
+  const FString& DistinctId,
+  FNuxiePropertyBag&& UserProperties,
+  FNuxiePropertyBag&& UserPropertiesSetOnce,
+  FNuxieError& OutError)
+{
+  if (!Session->IsConfigured())
+  {
+    OutError = NotConfiguredError();
+    return false;
+  }
+
+  Session->Identify(DistinctId, UserProperties, UserPropertiesSetOnce);
+  return true;
+}
+
+bool FNuxieHttpBridge::Reset(bool bKeepAnonymousId, FNuxieError& OutError)
+{
+  if (!Session->IsConfigured())
+  {
+    OutError = NotConfiguredError();
+    return false;
+  }
+
+  Session->Reset(bKeepAnonymousId);
+  return true;
+}
+
+FString FNuxieHttpBridge::GetDistinctId() const
+{
+  return Session->GetDistinctId();
+}
+
+FString FNuxieHttpBridge::GetAnonymousId() const
+{
+  return Session->GetAnonymousId();
+}
+
+bool FNuxieHttpBridge::IsIdentified() const
+{
+  return Session->IsIdentified();
+}
+
+bool FNuxieHttpBridge::StartTrigger(
+  const FString& RequestId,
+  const FString& EventName,
+  const FNuxieTriggerOptions& Options,
+  FNuxieError& OutError)
+{
+  return StartTrigger(RequestId, EventName, FNuxiePropertyBag::FromStringMap(Options.Properties), Options, OutError);
+}
+
+bool FNuxieHttpBridge::StartTrigger(
+  const FString& RequestId,
+  const FString& EventName,
+  FNuxiePropertyBag&& EventProperties,
+  const FNuxieTriggerOptions& Options,
+  FNuxieError& OutError)
+{
+  if (!Session->IsConfigured())
+  {
+    OutError = NotConfiguredError();
+    return false;
+  }
+
+  const TSharedRef<FJsonObject> Properties = ToJsonObject(EventProperties);
+  if (Options.UserProperties.Num() > 0)
+  {
+    Properties->SetObjectField(TEXT("$set"), ToJsonObject(Options.UserProperties));
+  }
+  if (Options.UserPropertiesSetOnce.Num() > 0)
+  {
+    Properties->SetObjectField(TEXT("$set_once"), ToJsonObject(Options.UserPropertiesSetOnce));
+  }
+
+  Session->Track(EventName, Properties);
+  Session->DecideTrigger(RequestId, EventName);
+  return true;
+}
+
+bool FNuxieHttpBridge::CancelTrigger(const FString& RequestId, FNuxieError& OutError)
+{
+  Session->CancelTrigger(RequestId);
+  return true;
+}
+
+bool FNuxieHttpBridge::ShowFlow(const FString& FlowId, FNuxieError& OutError)
+{
+  OutError = UnsupportedError(TEXT("Flows cannot be presented by the Nuxie HTTP bridge."));
+  return false;
+}
+
+void FNuxieHttpBridge::RefreshProfileAsync(FNuxieProfileSuccessCallback OnSuccess, FNuxieErrorCallback OnError)
+{
+  if (!Session->IsConfigured())
+  {
+    OnError(NotConfiguredError());
+    return;
+  }
+
+  Session->FetchProfile(MoveTemp(OnSuccess), MoveTemp(OnError));
+}
+
+void FNuxieHttpBridge::HasFeatureAsync(
+  const FString& FeatureId,
+  int32 RequiredBalance,
+  const FString& EntityId,
+  FNuxieFeatureAccessSuccessCallback OnSuccess,
+  FNuxieErrorCallback OnError)
+{
+  CheckFeatureAsync(
+    FeatureId,
+    RequiredBalance,
+    EntityId,
+    false,
+    [OnSuccess = MoveTemp(OnSuccess)](const FNuxieFeatureCheckResult& Result)
+    {
+      OnSuccess(Result.Access);
+    },
+    MoveTemp(OnError));
+}
+
+void FNuxieHttpBridge::CheckFeatureAsync(
+  const FString& FeatureId,
+  int32 RequiredBalance,
+  const FString& EntityId,
+  bool bForceRefresh,
+  FNuxieFeatureCheckSuccessCallback OnSuccess,
+  FNuxieErrorCallback OnError)
+{
+  if (!Session->IsConfigured())
+  {
+    OnError(NotConfiguredError());
+    return;
+  }
+
+  // Every check goes to the API, so bForceRefresh needs no handling here.
+  const TSharedRef<FJsonObject> Body = MakeShared<FJsonObject>();
+  Body->SetStringField(TEXT("feature_id"), FeatureId);
+  Body->SetNumberField(TEXT("required_balance"), RequiredBalance);
+  if (!EntityId.IsEmpty())
+  {
+    Body->SetStringField(TEXT("entity_id"), EntityId);
+  }
+
+  Session->Post(EntitledPath, Body, [OnSuccess = MoveTemp(OnSuccess), OnError = MoveTemp(OnError)](int32 Status, const FString& Response)
+  {
+    const TSharedPtr<FJsonObject> Object = FNuxieHttpTransport::IsSuccess(Status) ? ParseJsonObject(Response) : nullptr;
+    if (!Object.IsValid())
+    {
+      OnError(HttpError(Status, TEXT("Failed to check feature")));
+      return;
+    }
+
+    FNuxieFeatureCheckResult Result;
+    ParseFeatureCheck(*Object, Result);
+    OnSuccess(Result);
+  });
+}
+
+bool FNuxieHttpBridge::UseFeature(
+  const FString& FeatureId,
+  float Amount,
+  const FString& EntityId,
+  const TMap<FString, FString>& Metadata,
+  FNuxieError& OutError)
+{
+  return UseFeature(FeatureId, Amount, EntityId, FNuxiePropertyBag::FromStringMap(Metadata), OutError);
+}
+
+bool FNuxieHttpBridge::UseFeature(
+  const FString& FeatureId,
+  float Amount,
+  const FString& EntityId,
+  FNuxiePropertyBag&& Metadata,
+  FNuxieError& OutError)
+{
+  if (!Session->IsConfigured())
+  {
+    OutError = NotConfiguredError();
+    return false;
+  }
+
+  const TSharedRef<FJsonObject> Properties = MakeShared<FJsonObject>();
+  Properties->SetStringField(TEXT("feature_extId"), FeatureId);
+  Properties->SetNumberField(TEXT("amount"), Amount);
+  if (!EntityId.IsEmpty())
+  {
+    Properties->SetStringField(TEXT("entity_id"), EntityId);
+  }
+  Properties->SetObjectField(TEXT("metadata"), ToJsonObject(Metadata));
+  Session->Track(TEXT("$feature_used"), Properties);
+  return true;
+}
+
+void FNuxieHttpBridge::UseFeatureAndWaitAsync(
+  const FString& FeatureId,
+  float Amount,
+  const FString& EntityId,
+  bool bSetUsage,
+  const TMap<FString, FString>& Metadata,
+  FNuxieFeatureUsageSuccessCallback OnSuccess,
+  FNuxieErrorCallback OnError)
+{
+  UseFeatureAndWaitAsync(FeatureId, Amount, EntityId, bSetUsage, FNuxiePropertyBag::FromStringMap(Metadata), MoveTemp(OnSuccess), MoveTemp(OnError));
+}
+
+void FNuxieHttpBridge::UseFeatureAndWaitAsync(
+  const FString& FeatureId,
+  float Amount,
+  const FString& EntityId,
+  bool bSetUsage,
+  FNuxiePropertyBag&& Metadata,
+  FNuxieFeatureUsageSuccessCallback OnSuccess,
+  FNuxieErrorCallback OnError)
+{
+  if (!Session->IsConfigured())
+  {
+    OnError(NotConfiguredError());
+    return;
+  }
+
+  const TSharedRef<FJsonObject> Body = MakeShared<FJsonObject>();
+  Body->SetStringField(TEXT("feature_id"), FeatureId);
+  Body->SetNumberField(TEXT("amount"), Amount);
+  if (!EntityId.IsEmpty())
+  {
+    Body->SetStringField(TEXT("entity_id"), EntityId);
+  }
+  Body->SetBoolField(TEXT("set_usage"), bSetUsage);
+  Body->SetObjectField(TEXT("metadata"), ToJsonObject(Metadata));
+
+  Session->Post(UsagePath, Body, [OnSuccess = MoveTemp(OnSuccess), OnError = MoveTemp(OnError)](int32 Status, const FString& Response)
+  {
+    const TSharedPtr<FJsonObject> Object = FNuxieHttpTransport::IsSuccess(Status) ? ParseJsonObject(Response) : nullptr;
+    if (!Object.IsValid())
+    {
+      OnError(HttpError(Status, TEXT("Failed to use feature")));
+      return;
+    }
+
+    FNuxieFeatureUsageResult Result;
+    ParseFeatureUsage(*Object, Result);
+    OnSuccess(Result);
+  });
+}
+
+void FNuxieHttpBridge::FlushEventsAsync(FNuxieBoolSuccessCallback OnSuccess, FNuxieErrorCallback OnError)
+{
+  if (!Session->IsConfigured())
+  {
+    OnError(NotConfiguredError());
+    return;
+  }
+
+  Session->Flush(MoveTemp(OnSuccess));
+}
+
+void FNuxieHttpBridge::GetQueuedEventCountAsync(FNuxieIntSuccessCallback OnSuccess, FNuxieErrorCallback OnError)
+{
+  OnSuccess(Session->NumQueued());
+}
+
+void FNuxieHttpBridge::PauseEventQueueAsync(FSimpleDelegate OnSuccess, FNuxieErrorCallback OnError)
+{
+  Session->SetPaused(true);
+  OnSuccess.ExecuteIfBound();
+}
+
+void FNuxieHttpBridge::ResumeEventQueueAsync(FSimpleDelegate OnSuccess, FNuxieErrorCallback OnError)
+{
+  Session->SetPaused(false);
+  OnSuccess.ExecuteIfBound();
+}
+
+bool FNuxieHttpBridge::CompletePurchase(const FString& RequestId, const FNuxiePurchaseResult& Result, FNuxieError& OutError)
+{
+  OutError = UnsupportedError(TEXT("Purchases are not requested by the Nuxie HTTP bridge."));
+  return false;
+}
+
+bool FNuxieHttpBridge::CompleteRestore(const FString& RequestId, const FNuxieRestoreResult& Result, FNuxieError& OutError)
+{
+  OutError = UnsupportedError(TEXT("Restores are not requested by the Nuxie HTTP bridge."));
+  return false;
+}
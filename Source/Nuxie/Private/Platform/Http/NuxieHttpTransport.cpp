@@ -0,0 +1,133 @@
+#include "Platform/Http/NuxieHttpTransport.h"
+
+#include "Containers/Ticker.h"
+#include "HttpModule.h"
+#include "Interfaces/IHttpRequest.h"
+#include "Interfaces/IHttpResponse.h"
+#include "Misc/Compression.h"
+
+namespace
+{
+  constexpr float MaxRetryDelaySeconds = 60.0f;
+
+  bool GzipInPlace(TArray<uint8>& InOutData)
+  {
+    int32 CompressedSize = FCompression::CompressMemoryBound(NAME_Gzip, InOutData.Num());
+    TArray<uint8> Compressed;
+    Compressed.SetNumUninitialized(CompressedSize);
+    if (!FCompression::CompressMemory(NAME_Gzip, Compressed.GetData(), CompressedSize, InOutData.GetData(), InOutData.Num()))
+    {
+      return false;
+    }
+
+    Compressed.SetNum(CompressedSize);
+    InOutData = MoveTemp(Compressed);
+    return true;
+  }
+}
+
+void FNuxieHttpTransport::SetSettings(const FNuxieHttpTransportSettings& InSettings)
+{
+  FScopeLock Lock(&Mutex);
+  Settings = InSettings;
+  Settings.BaseUrl.RemoveFromEnd(TEXT("/"));
+}
+
+void FNuxieHttpTransport::SetLimits(int32 RetryCount, int32 TimeoutSeconds)
+{
+  FScopeLock Lock(&Mutex);
+  Settings.RetryCount = RetryCount;
+  Settings.TimeoutSeconds = TimeoutSeconds;
+}
+
+void FNuxieHttpTransport::Post(const FString& Path, const FString& JsonBody, FNuxieHttpResponseCallback OnComplete)
+{
+  const FNuxieHttpTransportSettings Current = GetSettings();
+
+  FRequestRef Request = MakeShared<FRequest, ESPMode::ThreadSafe>();
+  Request->Url = Current.BaseUrl + Path;
+  Request->OnComplete = MoveTemp(OnComplete);
+
+  const FTCHARToUTF8 Utf8(*JsonBody);
+  Request->Body.Append(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+  if (Current.bCompress && Request->Body.Num() >= MinCompressBytes)
+  {
+    Request->bGzip = GzipInPlace(Request->Body);
+  }
+
+  Send(Request);
+}
+
+bool FNuxieHttpTransport::IsSuccess(int32 Status)
+{
+  return Status >= 200 && Status < 300;
+}
+
+bool FNuxieHttpTransport::IsRetryable(int32 Status)
+{
+  return Status == 0 || Status == 408 || Status == 429 || Status >= 500;
+}
+
+FNuxieHttpTransportSettings FNuxieHttpTransport::GetSettings() const
+{
+  FScopeLock Lock(&Mutex);
+  return Settings;
+}
+
+void FNuxieHttpTransport::Send(const FRequestRef& Request)
+{
+  const FNuxieHttpTransportSettings Current = GetSettings();
+
+  TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = FHttpModule::Get().CreateRequest();
+  HttpRequest->SetVerb(TEXT("POST"));
+  HttpRequest->SetURL(Request->Url);
+  HttpRequest->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
+  HttpRequest->SetHeader(TEXT("Authorization"), FString::Printf(TEXT("Bearer %s"), *Current.ApiKey));
+  HttpRequest->SetHeader(TEXT("User-Agent"), Current.UserAgent);
+  HttpRequest->SetHeader(TEXT("Connection"), TEXT("keep-alive"));
+  if (Request->bGzip)
+  {
+    HttpRequest->SetHeader(TEXT("Content-Encoding"), TEXT("gzip"));
+  }
+  HttpRequest->SetContent(Request->Body);
+  HttpRequest->SetTimeout(static_cast<float>(Current.TimeoutSeconds));
+
+  const TWeakPtr<FNuxieHttpTransport, ESPMode::ThreadSafe> WeakThis = AsShared();
+  HttpRequest->OnProcessRequestComplete().BindLambda(
+    [WeakThis, Request](FHttpRequestPtr, FHttpResponsePtr Response, bool bConnected)
+    {
+      const int32 Status = bConnected && Response.IsValid() ? Response->GetResponseCode() : 0;
+
+      const TSharedPtr<FNuxieHttpTransport, ESPMode::ThreadSafe> This = WeakThis.Pin();
+      if (This.IsValid() && IsRetryable(Status) && Request->Attempt < This->GetSettings().RetryCount)
+      {
+        const float RetryAfterSeconds = Response.IsValid() ? FCString::Atof(*Response->GetHeader(TEXT("Retry-After"))) : 0.0f;
+        This->ScheduleRetry(Request, RetryAfterSeconds);
+        return;
+      }
+
+      Request->OnComplete(Status, Status != 0 ? Response->GetContentAsString() : FString());
+    });
+  HttpRequest->ProcessRequest();
+}
+
+void FNuxieHttpTransport::ScheduleRetry(const FRequestRef& Request, float RetryAfterSeconds)
+{
+  const float Backoff = static_cast<float>(GetSettings().RetryDelaySeconds) * FMath::Pow(2.0f, static_cast<float>(Request->Attempt));
+  const float Delay = FMath::Min(FMath::Max(Backoff * FMath::FRandRange(0.8f, 1.2f), RetryAfterSeconds), MaxRetryDelaySeconds);
+  ++Request->Attempt;
+
+  const TWeakPtr<FNuxieHttpTransport, ESPMode::ThreadSafe> WeakThis = AsShared();
+  FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([WeakThis, Request](float)
+  {
+    if (const TSharedPtr<FNuxieHttpTransport, ESPMode::ThreadSafe> This = WeakThis.Pin())
+    {
+      This->Send(Request);
+    }
+    else
+    {
+      Request->OnComplete(0, FString());
+    }
+    return false;
+  }), Delay);
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "HAL/CriticalSection.h"
+#include "Templates/SharedPointer.h"
+
+struct FNuxieHttpTransportSettings
+{
+  /** Scheme and host, e.g. https://i.nuxie.io. Request paths are appended as given. */
+  FString BaseUrl;
+  FString ApiKey;
+  FString UserAgent;
+  int32 RetryCount = 3;
+  int32 RetryDelaySeconds = 2;
+  int32 TimeoutSeconds = 30;
+  bool bCompress = true;
+};
+
+/** Status 0 means no response arrived: the connection failed or the request timed out. */
+using FNuxieHttpResponseCallback = TFunction<void(int32 Status, const FString& Body)>;
+
+/**
+ * JSON POSTs to the Nuxie HTTP API for FNuxieHttpBridge.
+ *
+ * Bodies of MinCompressBytes or more are gzipped when compression is enabled. Requests share the
+ * HTTP module's connection pool and ask for keep-alive, so back-to-back batches reuse one
+ * connection. Connection failures, 429 and 5xx responses are retried RetryCount times with
+ * exponential backoff and jitter, honouring Retry-After. Callbacks run on the thread the HTTP
+ * module completes requests on (the game thread by default). Thread-safe.
+ */
+class FNuxieHttpTransport final : public TSharedFromThis<FNuxieHttpTransport, ESPMode::ThreadSafe>
+{
+public:
+  static constexpr int32 MinCompressBytes = 1024;
+
+  void SetSettings(const FNuxieHttpTransportSettings& InSettings);
+  void SetLimits(int32 RetryCount, int32 TimeoutSeconds);
+
+  void Post(const FString& Path, const FString& JsonBody, FNuxieHttpResponseCallback OnComplete);
+
+  static bool IsSuccess(int32 Status);
+  static bool IsRetryable(int32 Status);
+
+private:
+  struct FRequest
+  {
+    FString Url;
+    TArray<uint8> Body;
+    bool bGzip = false;
+    int32 Attempt = 0;
+    FNuxieHttpResponseCallback OnComplete;
+  };
+
+  using FRequestRef = TSharedRef<FRequest, ESPMode::ThreadSafe>;
+
+  FNuxieHttpTransportSettings GetSettings() const;
+  void Send(const FRequestRef& Request);
+  void ScheduleRetry(const FRequestRef& Request, float RetryAfterSeconds);
+
+  mutable FCriticalSection Mutex;
+  FNuxieHttpTransportSettings Settings;
+};
@@ -9,11 +9,17 @@ public:
 
   virtual bool Configure(const FNuxieConfigureOptions& Options, FNuxieError& OutError) override;
   virtual bool Shutdown(FNuxieError& OutError) override;
+  virtual bool UpdateRuntimeOptions(const FNuxieRuntimeOptions& Options, FNuxieError& OutError) override;
   virtual bool Identify(
     const FString& DistinctId,
     const TMap<FString, FString>& UserProperties,
     const TMap<FString, FString>& UserPropertiesSetOnce,
     FNuxieError& OutError) override;
+  virtual bool Identify(
+    const FString& DistinctId,
+    FNuxiePropertyBag&& UserProperties,
+    FNuxiePropertyBag&& UserPropertiesSetOnce,
+    FNuxieError& OutError) override;
   virtual bool Reset(bool bKeepAnonymousId, FNuxieError& OutError) override;
   virtual FString GetDistinctId() const override;
   virtual FString GetAnonymousId() const override;
@@ -23,6 +29,12 @@ public:
     const FString& EventName,
     const FNuxieTriggerOptions& Options,
     FNuxieError& OutError) override;
+  virtual bool StartTrigger(
+    const FString& RequestId,
+    const FString& EventName,
+    FNuxiePropertyBag&& Properties,
+    const FNuxieTriggerOptions& Options,
+    FNuxieError& OutError) override;
   virtual bool CancelTrigger(const FString& RequestId, FNuxieError& OutError) override;
   virtual bool ShowFlow(const FString& FlowId, FNuxieError& OutError) override;
   virtual void RefreshProfileAsync(FNuxieProfileSuccessCallback OnSuccess, FNuxieErrorCallback OnError) override;
@@ -45,6 +57,12 @@ public:
     const FString& EntityId,
     const TMap<FString, FString>& Metadata,
     FNuxieError& OutError) override;
+  virtual bool UseFeature(
+    const FString& FeatureId,
+    float Amount,
+    const FString& EntityId,
+    FNuxiePropertyBag&& Metadata,
+    FNuxieError& OutError) override;
   virtual void UseFeatureAndWaitAsync(
     const FString& FeatureId,
     float Amount,
@@ -53,6 +71,14 @@ public:
     const TMap<FString, FString>& Metadata,
     FNuxieFeatureUsageSuccessCallback OnSuccess,
     FNuxieErrorCallback OnError) override;
+  virtual void UseFeatureAndWaitAsync(
+    const FString& FeatureId,
+    float Amount,
+    const FString& EntityId,
+    bool bSetUsage,
+    FNuxiePropertyBag&& Metadata,
+    FNuxieFeatureUsageSuccessCallback OnSuccess,
+    FNuxieErrorCallback OnError) override;
   virtual void FlushEventsAsync(FNuxieBoolSuccessCallback OnSuccess, FNuxieErrorCallback OnError) override;
   virtual void GetQueuedEventCountAsync(FNuxieIntSuccessCallback OnSuccess, FNuxieErrorCallback OnError) override;
   virtual void PauseEventQueueAsync(FSimpleDelegate OnSuccess, FNuxieErrorCallback OnError) override;
@@ -81,6 +81,32 @@ namespace
     return Dict;
   }
 
+  NSDictionary* ToNSDictionary(const FNuxiePropertyBag& Values)
+  {
+    NSMutableDictionary* Dict = [NSMutableDictionary dictionaryWithCapacity:Values.Num()];
+    for (const FNuxiePropertyBag::FProperty& Property : Values)
+    {
+      NSString* Key = ToNSString(FString(Property.Key));
+      switch (Property.Type)
+      {
+      case ENuxiePropertyType::Int:
+        Dict[Key] = [NSNumber numberWithLongLong:Property.Int];
+        break;
+      case ENuxiePropertyType::Double:
+        Dict[Key] = [NSNumber numberWithDouble:Property.Double];
+        break;
+      case ENuxiePropertyType::Bool:
+        Dict[Key] = [NSNumber numberWithBool:Property.bBool ? YES : NO];
+        break;
+      case ENuxiePropertyType::String:
+      default:
+        Dict[Key] = ToNSString(FString(Property.String));
+        break;
+      }
+    }
+    return Dict;
+  }
+
   id GetValueForGetter(id Object, const char* Getter)
   {
     if (Object == nil)
@@ -97,6 +123,84 @@ namespace
     return ((id(*)(id, SEL))objc_msgSend)(Object, Sel);
   }
 
+  // The subsystem indexes campaign triggers from this JSON. The `campaigns` array is only written
+  // when the whole list could be read, so a partial list never looks complete.
+  FString ProfileToJson(const FString& CustomerId, id Campaigns)
+  {
+    NSMutableDictionary* Root = [NSMutableDictionary dictionary];
+    Root[@"customer_id"] = ToNSString(CustomerId);
+
+    if ([Campaigns isKindOfClass:[NSArray class]])
+    {
+      NSMutableArray* Entries = [NSMutableArray array];
+      for (id Campaign in static_cast<NSArray*>(Campaigns))
+      {
+        id Trigger = GetValueForGetter(Campaign, "trigger");
+        id Type = GetValueForGetter(Trigger, "type");
+        if (Trigger == nil || ![Type isKindOfClass:[NSString class]])
+        {
+          Entries = nil;
+          break;
+        }
+
+        NSMutableDictionary* TriggerJson = [NSMutableDictionary dictionary];
+        TriggerJson[@"type"] = [static_cast<NSString*>(Type) lowercaseString];
+        id EventName = GetValueForGetter(Trigger, "eventName");
+        if ([EventName isKindOfClass:[NSString class]])
+        {
+          TriggerJson[@"event_name"] = EventName;
+        }
+
+        id CampaignId = GetValueForGetter(Campaign, "id");
+        [Entries addObject:@{
+          @"id": [CampaignId isKindOfClass:[NSString class]] ? CampaignId : @"",
+          @"trigger": TriggerJson
+        }];
+      }
+
+      if (Entries != nil)
+      {
+        Root[@"campaigns"] = Entries;
+      }
+    }
+
+    NSData* Data = [NSJSONSerialization dataWithJSONObject:Root options:0 error:nil];
+    if (Data == nil)
+    {
+      return FString();
+    }
+    const FUTF8ToTCHAR Json(static_cast<const ANSICHAR*>(Data.bytes), static_cast<int32>(Data.length));
+    return FString(Json.Length(), Json.Get());
+  }
+
+  void SetNumberIfSupported(id Target, NSString* SelectorName, int32 Value)
+  {
+    SEL Setter = NSSelectorFromString(SelectorName);
+    if (Target == nil || ![Target respondsToSelector:Setter])
+    {
+      return;
+    }
+
+    // Swift exposes counts as NSInteger and durations as TimeInterval.
+    NSMethodSignature* Signature = [Target methodSignatureForSelector:Setter];
+    if (Signature.numberOfArguments == 3 && strcmp([Signature getArgumentTypeAtIndex:2], @encode(double)) == 0)
+    {
+      ((void(*)(id, SEL, double))objc_msgSend)(Target, Setter, static_cast<double>(Value));
+      return;
+    }
+    ((void(*)(id, SEL, NSInteger))objc_msgSend)(Target, Setter, static_cast<NSInteger>(Value));
+  }
+
+  void ApplyRuntimeOptions(id Config, const FNuxieRuntimeOptions& Options)
+  {
+    SetNumberIfSupported(Config, @"setEventBatchSize:", Options.EventBatchSize);
+    SetNumberIfSupported(Config, @"setFlushAt:", Options.FlushAt);
+    SetNumberIfSupported(Config, @"setFlushInterval:", Options.FlushIntervalSeconds);
+    SetNumberIfSupported(Config, @"setMaxQueueSize:", Options.MaxQueueSize);
+    SetNumberIfSupported(Config, @"setRetryCount:", Options.RetryCount);
+    SetNumberIfSupported(Config, @"setRequestTimeout:", Options.RequestTimeoutSeconds);
+  }
+
   bool CallAsyncStringResult(id Target, SEL Selector, NSString* Arg, FString& OutValue, FString& OutError)
   {
     if (Target == nil || ![Target respondsToSelector:Selector])
@@ -245,6 +349,7 @@ bool FNuxieIOSBridge::Configure(const FNuxieConfigureOptions& Options, FNuxieErr
   SetBoolIfSupported(@"setEnableFileLogging:", Options.bEnableFileLogging);
   SetBoolIfSupported(@"setRedactSensitiveData:", Options.bRedactSensitiveData);
   SetBoolIfSupported(@"setIsDebugMode:", Options.bIsDebugMode);
+  ApplyRuntimeOptions(Config, FNuxieRuntimeOptions::FromConfigureOptions(Options));
 
   SEL SetupWithErrorSel = NSSelectorFromString(@"setupWith:error:");
   if ([SDK respondsToSelector:SetupWithErrorSel])
@@ -320,11 +425,39 @@ bool FNuxieIOSBridge::Shutdown(FNuxieError& OutError)
 #endif
 }
 
+bool FNuxieIOSBridge::UpdateRuntimeOptions(const FNuxieRuntimeOptions& Options, FNuxieError& OutError)
+{
+#if PLATFORM_IOS
+  // The SDK reads queue and network settings from its live configuration on each use.
+  id Config = GetValueForGetter(GetSDKInstance(), "configuration");
+  if (Config == nil)
+  {
+    OutError = FNuxieError::Make(TEXT("NATIVE_UNAVAILABLE"), TEXT("NuxieSDK configuration unavailable."));
+    return false;
+  }
+
+  ApplyRuntimeOptions(Config, Options);
+  return true;
+#else
+  OutError = FNuxieError::Make(TEXT("NATIVE_UNAVAILABLE"), TEXT("iOS bridge unavailable on this platform."));
+  return false;
+#endif
+}
+
 bool FNuxieIOSBridge::Identify(
   const FString& DistinctId,
   const TMap<FString, FString>& UserProperties,
   const TMap<FString, FString>& UserPropertiesSetOnce,
   FNuxieError& OutError)
+{
+  return Identify(DistinctId, FNuxiePropertyBag::FromStringMap(UserProperties), FNuxiePropertyBag::FromStringMap(UserPropertiesSetOnce), OutError);
+}
+
+bool FNuxieIOSBridge::Identify(
+  const FString& DistinctId,
+  FNuxiePropertyBag&& UserProperties,
+  FNuxiePropertyBag&& UserPropertiesSetOnce,
+  FNuxieError& OutError)
 {
 #if PLATFORM_IOS
   id SDK = GetSDKInstance();
@@ -457,6 +590,16 @@ bool FNuxieIOSBridge::StartTrigger(
   const FString& EventName,
   const FNuxieTriggerOptions& Options,
   FNuxieError& OutError)
+{
+  return StartTrigger(RequestId, EventName, FNuxiePropertyBag::FromStringMap(Options.Properties), Options, OutError);
+}
+
+bool FNuxieIOSBridge::StartTrigger(
+  const FString& RequestId,
+  const FString& EventName,
+  FNuxiePropertyBag&& Properties,
+  const FNuxieTriggerOptions& Options,
+  FNuxieError& OutError)
 {
 #if PLATFORM_IOS
   id SDK = GetSDKInstance();
@@ -506,13 +649,8 @@ bool FNuxieIOSBridge::StartTrigger(
     Update.TimestampMs = FDateTime::UtcNow().ToUnixTimestamp() * 1000;
     Update.bIsTerminal = Nuxie::FTriggerContract::IsTerminal(Update);
 
-    AsyncTask(ENamedThreads::GameThread, [ListenerRef, RequestId, Update]()
-    {
-      if (ListenerRef != nullptr)
-      {
-        ListenerRef->OnTriggerUpdate(RequestId, Update);
-      }
-    });
+    // The subsystem's listener moves the update to the game thread itself.
+    ListenerRef->OnTriggerUpdate(RequestId, Update);
   };
 
   typedef id (*TriggerFn)(id, SEL, id, id, id, id, id);
@@ -520,7 +658,7 @@ bool FNuxieIOSBridge::StartTrigger(
     SDK,
     Selector,
     ToNSString(EventName),
-    ToNSDictionary(Options.Properties),
+    ToNSDictionary(Properties),
     ToNSDictionary(Options.UserProperties),
     ToNSDictionary(Options.UserPropertiesSetOnce),
     Handler);
@@ -633,20 +771,14 @@ void FNuxieIOSBridge::RefreshProfileAsync(FNuxieProfileSuccessCallback OnSuccess
     id SDK = GetSDKInstance();
     if (SDK == nil)
     {
-      AsyncTask(ENamedThreads::GameThread, [OnError = MoveTemp(OnError)]() mutable
-      {
-        OnError(FNuxieError::Make(TEXT("NATIVE_UNAVAILABLE"), TEXT("NuxieSDK unavailable.")));
-      });
+      OnError(FNuxieError::Make(TEXT("NATIVE_UNAVAILABLE"), TEXT("NuxieSDK unavailable.")));
       return;
     }
 
     SEL Selector = NSSelectorFromString(@"refreshProfileWithCompletionHandler:");
     if (![SDK respondsToSelector:Selector])
     {
-      AsyncTask(ENamedThreads::GameThread, [OnError = MoveTemp(OnError)]() mutable
-      {
-        OnError(FNuxieError::Make(TEXT("NATIVE_UNAVAILABLE"), TEXT("refreshProfile selector unavailable.")));
-      });
+      OnError(FNuxieError::Make(TEXT("NATIVE_UNAVAILABLE"), TEXT("refreshProfile selector unavailable.")));
       return;
     }
 
@@ -666,22 +798,15 @@ void FNuxieIOSBridge::RefreshProfileAsync(FNuxieProfileSuccessCallback OnSuccess
 
     if (ResultError != nil)
     {
-      const FNuxieError Error = FNuxieError::Make(TEXT("NATIVE_ERROR"), ToFString([ResultError localizedDescription]));
-      AsyncTask(ENamedThreads::GameThread, [OnError = MoveTemp(OnError), Error]() mutable
-      {
-        OnError(Error);
-      });
+      OnError(FNuxieError::Make(TEXT("NATIVE_ERROR"), ToFString([ResultError localizedDescription])));
       return;
     }
 
     FNuxieProfileResponse Profile;
     Profile.CustomerId = ToFString(static_cast<NSString*>(GetValueForGetter(Result, "customerId")));
-    Profile.RawJson = ToFString([Result description]);
+    Profile.RawJson = ProfileToJson(Profile.CustomerId, GetValueForGetter(Result, "campaigns"));
 
-    AsyncTask(ENamedThreads::GameThread, [OnSuccess = MoveTemp(OnSuccess), Profile]() mutable
-    {
-      OnSuccess(Profile);
-    });
+    OnSuccess(Profile);
   });
 #else
   OnError(FNuxieError::Make(TEXT("NATIVE_UNAVAILABLE"), TEXT("iOS bridge unavailable on this platform.")));
@@ -695,10 +820,7 @@ void FNuxieIOSBridge::HasFeatureAsync(
   FNuxieFeatureAccessSuccessCallback OnSuccess,
   FNuxieErrorCallback OnError)
 {
-  AsyncTask(ENamedThreads::GameThread, [OnError = MoveTemp(OnError)]() mutable
-  {
-    OnError(FNuxieError::Make(TEXT("NATIVE_UNAVAILABLE"), TEXT("hasFeature async bridge not yet available on iOS dynamic runtime.")));
-  });
+  OnError(FNuxieError::Make(TEXT("NATIVE_UNAVAILABLE"), TEXT("hasFeature async bridge not yet available on iOS dynamic runtime.")));
 }
 
 void FNuxieIOSBridge::CheckFeatureAsync(
@@ -709,10 +831,7 @@ void FNuxieIOSBridge::CheckFeatureAsync(
   FNuxieFeatureCheckSuccessCallback OnSuccess,
   FNuxieErrorCallback OnError)
 {
-  AsyncTask(ENamedThreads::GameThread, [OnError = MoveTemp(OnError)]() mutable
-  {
-    OnError(FNuxieError::Make(TEXT("NATIVE_UNAVAILABLE"), TEXT("checkFeature async bridge not yet available on iOS dynamic runtime.")));
-  });
+  OnError(FNuxieError::Make(TEXT("NATIVE_UNAVAILABLE"), TEXT("checkFeature async bridge not yet available on iOS dynamic runtime.")));
 }
 
 bool FNuxieIOSBridge::UseFeature(
@@ -721,6 +840,16 @@ bool FNuxieIOSBridge::UseFeature(
   const FString& EntityId,
   const TMap<FString, FString>& Metadata,
   FNuxieError& OutError)
+{
+  return UseFeature(FeatureId, Amount, EntityId, FNuxiePropertyBag::FromStringMap(Metadata), OutError);
+}
+
+bool FNuxieIOSBridge::UseFeature(
+  const FString& FeatureId,
+  float Amount,
+  const FString& EntityId,
+  FNuxiePropertyBag&& Metadata,
+  FNuxieError& OutError)
 {
 #if PLATFORM_IOS
   id SDK = GetSDKInstance();
@@ -761,42 +890,39 @@ void FNuxieIOSBridge::UseFeatureAndWaitAsync(
   FNuxieFeatureUsageSuccessCallback OnSuccess,
   FNuxieErrorCallback OnError)
 {
-  AsyncTask(ENamedThreads::GameThread, [OnError = MoveTemp(OnError)]() mutable
-  {
-    OnError(FNuxieError::Make(TEXT("NATIVE_UNAVAILABLE"), TEXT("useFeatureAndWait async bridge not yet available on iOS dynamic runtime.")));
-  });
+  UseFeatureAndWaitAsync(FeatureId, Amount, EntityId, bSetUsage, FNuxiePropertyBag::FromStringMap(Metadata), MoveTemp(OnSuccess), MoveTemp(OnError));
+}
+
+void FNuxieIOSBridge::UseFeatureAndWaitAsync(
+  const FString& FeatureId,
+  float Amount,
+  const FString& EntityId,
+  bool bSetUsage,
+  FNuxiePropertyBag&& Metadata,
+  FNuxieFeatureUsageSuccessCallback OnSuccess,
+  FNuxieErrorCallback OnError)
+{
+  OnError(FNuxieError::Make(TEXT("NATIVE_UNAVAILABLE"), TEXT("useFeatureAndWait async bridge not yet available on iOS dynamic runtime.")));
 }
 
 void FNuxieIOSBridge::FlushEventsAsync(FNuxieBoolSuccessCallback OnSuccess, FNuxieErrorCallback OnError)
 {
-  AsyncTask(ENamedThreads::GameThread, [OnError = MoveTemp(OnError)]() mutable
-  {
-    OnError(FNuxieError::Make(TEXT("NATIVE_UNAVAILABLE"), TEXT("flushEvents async bridge not yet available on iOS dynamic runtime.")));
-  });
+  OnError(FNuxieError::Make(TEXT("NATIVE_UNAVAILABLE"), TEXT("flushEvents async bridge not yet available on iOS dynamic runtime.")));
 }
 
 void FNuxieIOSBridge::GetQueuedEventCountAsync(FNuxieIntSuccessCallback OnSuccess, FNuxieErrorCallback OnError)
 {
-  AsyncTask(ENamedThreads::GameThread, [OnError = MoveTemp(OnError)]() mutable
-  {
-    OnError(FNuxieError::Make(TEXT("NATIVE_UNAVAILABLE"), TEXT("getQueuedEventCount async bridge not yet available on iOS dynamic runtime.")));
-  });
+  OnError(FNuxieError::Make(TEXT("NATIVE_UNAVAILABLE"), TEXT("getQueuedEventCount async bridge not yet available on iOS dynamic runtime.")));
 }
 
 void FNuxieIOSBridge::PauseEventQueueAsync(FSimpleDelegate OnSuccess, FNuxieErrorCallback OnError)
 {
-  AsyncTask(ENamedThreads::GameThread, [OnError = MoveTemp(OnError)]() mutable
-  {
-    OnError(FNuxieError::Make(TEXT("NATIVE_UNAVAILABLE"), TEXT("pauseEventQueue async bridge not yet available on iOS dynamic runtime.")));
-  });
+  OnError(FNuxieError::Make(TEXT("NATIVE_UNAVAILABLE"), TEXT("pauseEventQueue async bridge not yet available on iOS dynamic runtime.")));
 }
 
 void FNuxieIOSBridge::ResumeEventQueueAsync(FSimpleDelegate OnSuccess, FNuxieErrorCallback OnError)
 {
-  AsyncTask(ENamedThreads::GameThread, [OnError = MoveTemp(OnError)]() mutable
-  {
-    OnError(FNuxieError::Make(TEXT("NATIVE_UNAVAILABLE"), TEXT("resumeEventQueue async bridge not yet available on iOS dynamic runtime.")));
-  });
+  OnError(FNuxieError::Make(TEXT("NATIVE_UNAVAILABLE"), TEXT("resumeEventQueue async bridge not yet available on iOS dynamic runtime.")));
 }
 
 bool FNuxieIOSBridge::CompletePurchase(const FString& RequestId, const FNuxiePurchaseResult& Result, FNuxieError& OutError)
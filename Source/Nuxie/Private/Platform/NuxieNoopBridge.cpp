@@ -1,24 +1,19 @@
 #include "Platform/NuxieNoopBridge.h"
 
-#include "Async/Async.h"
 #include "Misc/Guid.h"
 
 namespace
 {
   FNuxieError UnsupportedError()
   {
-    return FNuxieError::Make(TEXT("NATIVE_UNAVAILABLE"), TEXT("Nuxie is only supported on iOS/Android targets in this build."));
+    return FNuxieError::Make(
+      TEXT("NATIVE_UNAVAILABLE"),
+      TEXT("Nuxie is disabled in editor and commandlet sessions. Set bUseHttpBridgeInEditor to use the HTTP bridge."));
   }
 }
 
-FNuxieError FNuxieNoopBridge::UnsupportedError()
-{
-  return ::UnsupportedError();
-}
-
 void FNuxieNoopBridge::SetListener(INuxiePlatformBridgeListener* InListener)
 {
-  Listener = InListener;
 }
 
 bool FNuxieNoopBridge::Configure(const FNuxieConfigureOptions& Options, FNuxieError& OutError)
@@ -35,6 +30,12 @@ bool FNuxieNoopBridge::Shutdown(FNuxieError& OutError)
   return false;
 }
 
+bool FNuxieNoopBridge::UpdateRuntimeOptions(const FNuxieRuntimeOptions& Options, FNuxieError& OutError)
+{
+  OutError = UnsupportedError();
+  return false;
+}
+
 bool FNuxieNoopBridge::Identify(
   const FString& DistinctIdIn,
   const TMap<FString, FString>& UserProperties,
@@ -78,19 +79,7 @@ bool FNuxieNoopBridge::StartTrigger(
   const FNuxieTriggerOptions& Options,
   FNuxieError& OutError)
 {
-  if (Listener != nullptr)
-  {
-    FNuxieTriggerUpdate Update;
-    Update.Kind = ENuxieTriggerUpdateKind::Error;
-    Update.Error = FNuxieError::Make(TEXT("NATIVE_UNAVAILABLE"), TEXT("No mobile bridge is available."));
-    Update.TimestampMs = FDateTime::UtcNow().ToUnixTimestamp() * 1000;
-    Update.bIsTerminal = true;
-    AsyncTask(ENamedThreads::GameThread, [Listener = Listener, RequestId, Update]()
-    {
-      Listener->OnTriggerUpdate(RequestId, Update);
-    });
-  }
-
+  // The failed start is reported to the caller, so no update stream is opened for it.
   OutError = UnsupportedError();
   return false;
 }
@@ -109,10 +98,7 @@ bool FNuxieNoopBridge::ShowFlow(const FString& FlowId, FNuxieError& OutError)
 
 void FNuxieNoopBridge::RefreshProfileAsync(FNuxieProfileSuccessCallback OnSuccess, FNuxieErrorCallback OnError)
 {
-  AsyncTask(ENamedThreads::GameThread, [OnError]()
-  {
-    OnError(UnsupportedError());
-  });
+  OnError(UnsupportedError());
 }
 
 void FNuxieNoopBridge::HasFeatureAsync(
@@ -122,10 +108,7 @@ void FNuxieNoopBridge::HasFeatureAsync(
   FNuxieFeatureAccessSuccessCallback OnSuccess,
   FNuxieErrorCallback OnError)
 {
-  AsyncTask(ENamedThreads::GameThread, [OnError]()
-  {
-    OnError(UnsupportedError());
-  });
+  OnError(UnsupportedError());
 }
 
 void FNuxieNoopBridge::CheckFeatureAsync(
@@ -136,10 +119,7 @@ void FNuxieNoopBridge::CheckFeatureAsync(
   FNuxieFeatureCheckSuccessCallback OnSuccess,
   FNuxieErrorCallback OnError)
 {
-  AsyncTask(ENamedThreads::GameThread, [OnError]()
-  {
-    OnError(UnsupportedError());
-  });
+  OnError(UnsupportedError());
 }
 
 bool FNuxieNoopBridge::UseFeature(
@@ -162,42 +142,27 @@ void FNuxieNoopBridge::UseFeatureAndWaitAsync(
   FNuxieFeatureUsageSuccessCallback OnSuccess,
   FNuxieErrorCallback OnError)
 {
-  AsyncTask(ENamedThreads::GameThread, [OnError]()
-  {
-    OnError(UnsupportedError());
-  });
+  OnError(UnsupportedError());
 }
 
 void FNuxieNoopBridge::FlushEventsAsync(FNuxieBoolSuccessCallback OnSuccess, FNuxieErrorCallback OnError)
 {
-  AsyncTask(ENamedThreads::GameThread, [OnError]()
-  {
-    OnError(UnsupportedError());
-  });
+  OnError(UnsupportedError());
 }
 
 void FNuxieNoopBridge::GetQueuedEventCountAsync(FNuxieIntSuccessCallback OnSuccess, FNuxieErrorCallback OnError)
 {
-  AsyncTask(ENamedThreads::GameThread, [OnError]()
-  {
-    OnError(UnsupportedError());
-  });
+  OnError(UnsupportedError());
 }
 
 void FNuxieNoopBridge::PauseEventQueueAsync(FSimpleDelegate OnSuccess, FNuxieErrorCallback OnError)
 {
-  AsyncTask(ENamedThreads::GameThread, [OnError]()
-  {
-    OnError(UnsupportedError());
-  });
+  OnError(UnsupportedError());
 }
 
 void FNuxieNoopBridge::ResumeEventQueueAsync(FSimpleDelegate OnSuccess, FNuxieErrorCallback OnError)
 {
-  AsyncTask(ENamedThreads::GameThread, [OnError]()
-  {
-    OnError(UnsupportedError());
-  });
+  OnError(UnsupportedError());
 }
 
 bool FNuxieNoopBridge::CompletePurchase(const FString& RequestId, const FNuxiePurchaseResult& Result, FNuxieError& OutError)
@@ -2,6 +2,12 @@
 
 #include "NuxiePlatformBridge.h"
 
+/**
+ * Default bridge for editor, PIE and commandlet sessions on targets without a native SDK, so
+ * development runs do not talk to the live API. Every call fails with NATIVE_UNAVAILABLE, and
+ * callbacks run inline on the calling thread. bUseHttpBridgeInEditor opts those sessions into
+ * FNuxieHttpBridge instead.
+ */
 class FNuxieNoopBridge final : public INuxiePlatformBridge
 {
 public:
@@ -9,6 +15,7 @@ public:
 
   virtual bool Configure(const FNuxieConfigureOptions& Options, FNuxieError& OutError) override;
   virtual bool Shutdown(FNuxieError& OutError) override;
+  virtual bool UpdateRuntimeOptions(const FNuxieRuntimeOptions& Options, FNuxieError& OutError) override;
   virtual bool Identify(
     const FString& DistinctId,
     const TMap<FString, FString>& UserProperties,
@@ -61,9 +68,6 @@ public:
   virtual bool CompleteRestore(const FString& RequestId, const FNuxieRestoreResult& Result, FNuxieError& OutError) override;
 
 private:
-  static FNuxieError UnsupportedError();
-
-  INuxiePlatformBridgeListener* Listener = nullptr;
   FString DistinctId;
   FString AnonymousId;
 };
@@ -0,0 +1,122 @@
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "NuxieAllocationCounter.h"
+#include "NuxieSubmissionQueue.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+  FNuxieBagHandOffAllocationsTest,
+  "Nuxie.Arguments.BagHandOffAllocations",
+  EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FNuxieBagHandOffAllocationsTest::RunTest(const FString& Parameters)
+{
+  if (!TestTrue(TEXT("Runs on the game thread"), IsInGameThread()))
+  {
+    return false;
+  }
+
+  // UseFeature arguments used to be copied from the caller's TMap into each queued call. This
+  // counts the allocations of that hand-off against the map and bag overloads that move instead.
+  constexpr int32 Count = 10000;
+
+  struct FCopiedUseFeature
+  {
+    FString FeatureId;
+    float Amount = 1.0f;
+    FString EntityId;
+    TMap<FString, FString> Metadata;
+  };
+
+  TMap<FString, FString> Metadata;
+  Metadata.Add(TEXT("source"), TEXT("arena"));
+  Metadata.Add(TEXT("level"), TEXT("12"));
+  Metadata.Add(TEXT("score"), TEXT("4210"));
+  Metadata.Add(TEXT("ranked"), TEXT("true"));
+
+  const FString FeatureId(TEXT("coins"));
+  int64 Queued = 0;
+
+  const double CopiedMap = FNuxieAllocationCounter::CountPerCall(Count, [&]()
+  {
+    FCopiedUseFeature Submission;
+    Submission.FeatureId = FeatureId;
+    Submission.Metadata = Metadata;
+    Queued += Submission.Metadata.Num();
+  });
+
+  const double MapOverload = FNuxieAllocationCounter::CountPerCall(Count, [&]()
+  {
+    FNuxieSubmissionQueue::FUseFeature Submission;
+    Submission.FeatureId = FeatureId;
+    Submission.Metadata = FNuxiePropertyBag::FromStringMap(Metadata);
+    FNuxieSubmissionQueue::FSubmission Pending(TInPlaceType<FNuxieSubmissionQueue::FUseFeature>(), MoveTemp(Submission));
+    Queued += Pending.Get<FNuxieSubmissionQueue::FUseFeature>().Metadata.Num();
+  });
+
+  const double BagOverload = FNuxieAllocationCounter::CountPerCall(Count, [&]()
+  {
+    FNuxiePropertyBag Bag;
+    Bag.SetString(TEXT("source"), TEXT("arena")).SetInt(TEXT("level"), 12).SetInt(TEXT("score"), 4210).SetBool(TEXT("ranked"), true);
+    FNuxieSubmissionQueue::FUseFeature Submission;
+    Submission.FeatureId = FeatureId;
+    Submission.Metadata = MoveTemp(Bag);
+    FNuxieSubmissionQueue::FSubmission Pending(TInPlaceType<FNuxieSubmissionQueue::FUseFeature>(), MoveTemp(Submission));
+    Queued += Pending.Get<FNuxieSubmissionQueue::FUseFeature>().Metadata.Num();
+  });
+
+  AddInfo(FString::Printf(
+    TEXT("%d calls with %d metadata entries, allocations per call: TMap copied %.2f, TMap overload %.2f, FNuxiePropertyBag&& %.2f."),
+    Count,
+    Metadata.Num(),
+    CopiedMap,
+    MapOverload,
+    BagOverload));
+
+  TestEqual(TEXT("Every hand-off kept its metadata"), Queued, int64(3) * Count * Metadata.Num());
+  // The feature id copy is the only allocation the bag hand-off is allowed.
+  TestTrue(FString::Printf(TEXT("The FNuxiePropertyBag&& hand-off allocates at most once per call (%.2f)"), BagOverload), BagOverload <= 1.0);
+  TestTrue(TEXT("The bag hand-off allocates less than copying the map"), BagOverload < CopiedMap);
+  return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+  FNuxieMovedFromBagTest,
+  "Nuxie.Arguments.MovedFromBagIsEmpty",
+  EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FNuxieMovedFromBagTest::RunTest(const FString& Parameters)
+{
+  FNuxiePropertyBag Inline;
+  Inline.SetInt(TEXT("level"), 12).SetString(TEXT("source"), TEXT("arena"));
+
+  FNuxiePropertyBag Constructed(MoveTemp(Inline));
+  TestEqual(TEXT("The new bag has the entries"), Constructed.Num(), 2);
+  TestEqual(TEXT("The moved-from bag counts none"), Inline.Num(), 0);
+  TestTrue(TEXT("And is empty"), Inline.IsEmpty());
+  TestTrue(TEXT("And iterates nothing"), !(Inline.begin() != Inline.end()));
+  TestTrue(TEXT("And converts to an empty map"), Inline.ToStringMap().IsEmpty());
+
+  // Enough entries to spill past the inline words onto the heap.
+  FNuxiePropertyBag Heap;
+  for (int32 Index = 0; Index < 32; ++Index)
+  {
+    Heap.SetString(FString::Printf(TEXT("key_%d"), Index), TEXT("a value long enough to need several words"));
+  }
+
+  FNuxiePropertyBag Assigned;
+  Assigned.SetBool(TEXT("stale"), true);
+  Assigned = MoveTemp(Heap);
+  TestEqual(TEXT("Assignment takes the heap entries"), Assigned.Num(), 32);
+  TestFalse(TEXT("And drops its own"), Assigned.Contains(TEXT("stale")));
+  TestEqual(TEXT("The moved-from heap bag counts none"), Heap.Num(), 0);
+  TestFalse(TEXT("And finds nothing"), Heap.Contains(TEXT("key_0")));
+
+  Heap.SetInt(TEXT("reused"), 1);
+  TestEqual(TEXT("A moved-from bag can be filled again"), Heap.Num(), 1);
+  return true;
+}
+
+#endif
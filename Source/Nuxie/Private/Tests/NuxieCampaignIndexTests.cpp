@@ -0,0 +1,44 @@
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "NuxieCampaignEventIndex.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+  FNuxieCampaignIndexBridgePayloadTest,
+  "Nuxie.CampaignIndex.LoadsBridgePayload",
+  EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FNuxieCampaignIndexBridgePayloadTest::RunTest(const FString& Parameters)
+{
+  FNuxieCampaignEventIndex Index;
+
+  // As written by ProfilePayload.toJson on Android and ProfileToJson on iOS.
+  const FString BridgeJson =
+    TEXT("{\"customer_id\":\"customer_1\",\"campaigns\":[")
+    TEXT("{\"id\":\"c1\",\"trigger\":{\"type\":\"event\",\"event_name\":\"level_complete\"}},")
+    TEXT("{\"id\":\"c2\",\"trigger\":{\"type\":\"event\",\"event_name\":\"shop_opened\"}}]}");
+  TestTrue(TEXT("A bridge payload loads"), Index.LoadProfileJson(BridgeJson));
+  TestTrue(TEXT("The index is complete"), Index.IsComplete());
+  TestEqual(TEXT("With one name per campaign"), Index.Num(), 2);
+  TestTrue(TEXT("A campaign event can match"), Index.CanMatch(FString(TEXT("level_complete"))));
+  TestFalse(TEXT("Any other event cannot"), Index.CanMatch(FString(TEXT("enemy_killed"))));
+
+  const FString SegmentJson =
+    TEXT("{\"customer_id\":\"customer_1\",\"campaigns\":[")
+    TEXT("{\"id\":\"c1\",\"trigger\":{\"type\":\"event\",\"event_name\":\"level_complete\"}},")
+    TEXT("{\"id\":\"c2\",\"trigger\":{\"type\":\"segment\"}}]}");
+  TestFalse(TEXT("A segment trigger is not indexable"), Index.LoadProfileJson(SegmentJson));
+  TestTrue(TEXT("So every event passes"), Index.CanMatch(FString(TEXT("enemy_killed"))));
+
+  TestFalse(TEXT("A profile whose campaigns could not be read"), Index.LoadProfileJson(TEXT("{\"customer_id\":\"customer_1\"}")));
+  TestFalse(TEXT("Leaves the index inactive"), Index.IsComplete());
+
+  // What the bridges sent before: the profile's toString()/description.
+  TestFalse(TEXT("A description string is not JSON"), Index.LoadProfileJson(TEXT("Profile(customerId=customer_1, campaigns=[Campaign(id=c1)])")));
+  TestTrue(TEXT("And passes every event"), Index.CanMatch(FString(TEXT("enemy_killed"))));
+  return true;
+}
+
+#endif
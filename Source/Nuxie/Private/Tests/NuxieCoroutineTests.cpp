@@ -0,0 +1,113 @@
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Async/Async.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "Misc/AutomationTest.h"
+#include "NuxieCoroutines.h"
+#include "NuxieTestBridge.h"
+
+namespace
+{
+  struct FNuxieCoroutineProbe
+  {
+    bool bResumed = false;
+    bool bResumedOnGameThread = false;
+    TNuxieAsyncResult<FNuxieFeatureCheckResult> Result;
+  };
+
+  FNuxieCoroutine AwaitCheck(UNuxieSubsystem* Subsystem, FNuxieCoroutineProbe& Probe)
+  {
+    Probe.Result = co_await FNuxieCheckFeatureAwaitable(Subsystem, TEXT("pro"), 1, FString(), true);
+    Probe.bResumedOnGameThread = IsInGameThread();
+    Probe.bResumed = true;
+  }
+
+  FNuxieCoroutine AwaitBothChecks(UNuxieSubsystem* Subsystem, FNuxieCoroutineProbe& First, FNuxieCoroutineProbe& Second)
+  {
+    auto [FirstResult, SecondResult] = co_await NuxieWhenAll(
+      FNuxieCheckFeatureAwaitable(Subsystem, TEXT("pro"), 1, FString(), true),
+      FNuxieCheckFeatureAwaitable(Subsystem, TEXT("hints"), 1, FString(), true));
+    First.Result = MoveTemp(FirstResult);
+    Second.Result = MoveTemp(SecondResult);
+    First.bResumed = Second.bResumed = true;
+  }
+
+  FNuxieFeatureCheckResult MakeGrantedCheck()
+  {
+    FNuxieFeatureCheckResult Result;
+    Result.Access.bAllowed = true;
+    return Result;
+  }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+  FNuxieCoroutineResumesOnGameThreadTest,
+  "Nuxie.Coroutines.ResumesOnGameThread",
+  EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FNuxieCoroutineResumesOnGameThreadTest::RunTest(const FString& Parameters)
+{
+  FNuxieTestBridge* Bridge = nullptr;
+  UNuxieSubsystem* Subsystem = FNuxieSubsystemTestAccess::Create(FNuxieSubsystemTestAccess::MakeStateDirectory(TEXT("Coroutines")), Bridge);
+  Bridge->CheckResult = MakeGrantedCheck();
+  Bridge->bHoldChecks = true;
+
+  FNuxieCoroutineProbe Probe;
+  AwaitCheck(Subsystem, Probe);
+  TestFalse(TEXT("The coroutine waits for the bridge"), Probe.bResumed);
+
+  // The native SDK answers on one of its own threads.
+  Async(EAsyncExecution::ThreadPool, [Bridge]()
+  {
+    Bridge->ReleaseChecks();
+  }).Wait();
+  TestFalse(TEXT("An answer off the game thread does not resume the coroutine there"), Probe.bResumed);
+
+  FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+  TestTrue(TEXT("The coroutine resumes once the game thread runs"), Probe.bResumed);
+  TestTrue(TEXT("On the game thread"), Probe.bResumedOnGameThread);
+  TestTrue(TEXT("With the bridge's answer"), Probe.Result.IsOk() && Probe.Result.GetValue().Access.bAllowed);
+
+  FNuxieSubsystemTestAccess::Destroy(Subsystem);
+  return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+  FNuxieCoroutineTeardownTest,
+  "Nuxie.Coroutines.TeardownResumesWithError",
+  EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FNuxieCoroutineTeardownTest::RunTest(const FString& Parameters)
+{
+  FNuxieTestBridge* Bridge = nullptr;
+  UNuxieSubsystem* Subsystem = FNuxieSubsystemTestAccess::Create(FNuxieSubsystemTestAccess::MakeStateDirectory(TEXT("Coroutines")), Bridge);
+  Bridge->CheckResult = MakeGrantedCheck();
+  Bridge->bHoldChecks = true;
+
+  FNuxieCoroutineProbe Single;
+  FNuxieCoroutineProbe First;
+  FNuxieCoroutineProbe Second;
+  AwaitCheck(Subsystem, Single);
+  AwaitBothChecks(Subsystem, First, Second);
+  TestEqual(TEXT("Every check reaches the bridge"), Bridge->CheckFeatureCalls, 3);
+
+  // Deinitialize drops the bridge and the callbacks it was holding.
+  FNuxieSubsystemTestAccess::Destroy(Subsystem);
+  FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+
+  TestTrue(TEXT("A dropped call still resumes its coroutine"), Single.bResumed);
+  TestFalse(TEXT("Without a value"), Single.Result.IsOk());
+  TestEqual(TEXT("And with an error"), Single.Result.Error.Code, FString(TEXT("NATIVE_UNAVAILABLE")));
+  TestTrue(TEXT("NuxieWhenAll resumes after every operation is dropped"), First.bResumed && Second.bResumed);
+  TestFalse(TEXT("Reporting each as failed"), First.Result.IsOk() || Second.Result.IsOk());
+
+  FNuxieCoroutineProbe Unavailable;
+  AwaitCheck(nullptr, Unavailable);
+  TestTrue(TEXT("Without a subsystem the coroutine continues inline"), Unavailable.bResumed);
+  TestEqual(TEXT("With the unavailable error"), Unavailable.Result.Error.Code, FString(TEXT("NATIVE_UNAVAILABLE")));
+  return true;
+}
+
+#endif
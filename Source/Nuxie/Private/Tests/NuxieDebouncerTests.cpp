@@ -0,0 +1,97 @@
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "NuxieTriggerDebouncer.h"
+#include "Tests/NuxieTestBridge.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+  FNuxieDebouncerReferencesTest,
+  "Nuxie.Debouncer.ReferencesOutliveTheWindow",
+  EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FNuxieDebouncerReferencesTest::RunTest(const FString& Parameters)
+{
+  const FNuxieName EventName(TEXT("level_complete"));
+  FNuxieTriggerDebouncer Debouncer;
+  FString RequestId;
+
+  // Two callers share r1, then its window expires.
+  Debouncer.Track(EventName, TEXT("r1"), 1.0f, 0.0);
+  TestTrue(TEXT("A start inside the window attaches"), Debouncer.TryAttach(EventName, 0.5, RequestId) && RequestId == TEXT("r1"));
+  TestFalse(TEXT("A start after the window does not attach"), Debouncer.TryAttach(EventName, 2.0, RequestId));
+  TestFalse(TEXT("The first release leaves r1 to the other caller"), Debouncer.Release(TEXT("r1")));
+  TestTrue(TEXT("The last release cancels r1"), Debouncer.Release(TEXT("r1")));
+
+  // A new request for the same event must not take over r2's references.
+  Debouncer.Track(EventName, TEXT("r2"), 1.0f, 10.0);
+  TestTrue(TEXT("A start inside r2's window attaches"), Debouncer.TryAttach(EventName, 10.5, RequestId) && RequestId == TEXT("r2"));
+  Debouncer.Track(EventName, TEXT("r3"), 1.0f, 12.0);
+  TestFalse(TEXT("r2 keeps its references after r3 is tracked"), Debouncer.Release(TEXT("r2")));
+  TestTrue(TEXT("The last release of r2 cancels it"), Debouncer.Release(TEXT("r2")));
+  TestTrue(TEXT("r3 has a single holder"), Debouncer.Release(TEXT("r3")));
+
+  // A terminal update ends every reference.
+  Debouncer.Track(EventName, TEXT("r4"), 1.0f, 20.0);
+  Debouncer.TryAttach(EventName, 20.5, RequestId);
+  Debouncer.OnTerminal(TEXT("r4"));
+  TestTrue(TEXT("A finished request has nothing left to hold"), Debouncer.Release(TEXT("r4")));
+  return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+  FNuxieDebouncerCancelTest,
+  "Nuxie.Debouncer.CancelsNativelyAfterLastCaller",
+  EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FNuxieDebouncerCancelTest::RunTest(const FString& Parameters)
+{
+  FNuxieTestBridge* Bridge = nullptr;
+  UNuxieSubsystem* Subsystem = FNuxieSubsystemTestAccess::Create(FNuxieSubsystemTestAccess::MakeStateDirectory(TEXT("Debouncer")), Bridge);
+
+  FNuxieTriggerOptions Options;
+  Options.DebounceWindowSeconds = 60.0f;
+  FString FirstId;
+  FString SecondId;
+  FNuxieError Error;
+  Subsystem->StartTrigger(TEXT("level_complete"), Options, FirstId, Error);
+  Subsystem->StartTrigger(TEXT("level_complete"), Options, SecondId, Error);
+  TestEqual(TEXT("The second start is coalesced"), SecondId, FirstId);
+  TestEqual(TEXT("Only one start reaches the bridge"), Bridge->StartTriggerCalls, 1);
+
+  Subsystem->CancelTrigger(FirstId, Error);
+  TestEqual(TEXT("The first cancel stays local"), Bridge->CancelTriggerCalls, 0);
+  Subsystem->CancelTrigger(SecondId, Error);
+  TestEqual(TEXT("The last cancel reaches the bridge"), Bridge->CancelTriggerCalls, 1);
+
+  FNuxieSubsystemTestAccess::Destroy(Subsystem);
+  return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+  FNuxieDebouncerCaseTest,
+  "Nuxie.Debouncer.EventNamesAreCaseSensitive",
+  EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FNuxieDebouncerCaseTest::RunTest(const FString& Parameters)
+{
+  FNuxieTestBridge* Bridge = nullptr;
+  UNuxieSubsystem* Subsystem = FNuxieSubsystemTestAccess::Create(FNuxieSubsystemTestAccess::MakeStateDirectory(TEXT("DebouncerCase")), Bridge);
+
+  // FName folds these two together; they are still different events.
+  FNuxieTriggerOptions Options;
+  Options.DebounceWindowSeconds = 60.0f;
+  FString LowerId;
+  FString UpperId;
+  FNuxieError Error;
+  Subsystem->StartTrigger(TEXT("level_complete"), Options, LowerId, Error);
+  Subsystem->StartTrigger(TEXT("Level_Complete"), Options, UpperId, Error);
+  TestNotEqual(TEXT("An event differing only in case gets its own request"), UpperId, LowerId);
+  TestEqual(TEXT("Both starts reach the bridge"), Bridge->StartTriggerCalls, 2);
+
+  FNuxieSubsystemTestAccess::Destroy(Subsystem);
+  return true;
+}
+
+#endif
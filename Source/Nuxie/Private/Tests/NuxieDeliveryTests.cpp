@@ -0,0 +1,125 @@
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Async/Async.h"
+#include "HAL/Event.h"
+#include "HAL/PlatformTLS.h"
+#include "Misc/AutomationTest.h"
+#include "NuxieAsyncQueue.h"
+
+namespace
+{
+  constexpr int32 DeliveryRounds = 200;
+
+  struct FDeliverySample
+  {
+    double ProducedSeconds = 0.0;
+    double DeliveredSeconds = 0.0;
+    uint32 ProducerThreadId = 0;
+    uint32 CallbackThreadId = 0;
+    bool bDelivered = false;
+  };
+
+  // Produces a result on a pool thread, as a bridge does, and records when and where the callback
+  // bound with Delivery runs. Game-thread callbacks run when this thread next pumps its queue,
+  // which is right after the producer returns.
+  FDeliverySample Deliver(const FNuxieDeliveryPolicy& Delivery)
+  {
+    TSharedRef<FDeliverySample, ESPMode::ThreadSafe> Sample = MakeShared<FDeliverySample, ESPMode::ThreadSafe>();
+    FEvent* Produced = FPlatformProcess::GetSynchEventFromPool();
+    FEvent* Delivered = FPlatformProcess::GetSynchEventFromPool();
+
+    TFunction<void(int32)> Callback = NuxieBindDelivery(Delivery, TFunction<void(int32)>([Sample, Delivered](int32)
+    {
+      Sample->DeliveredSeconds = FPlatformTime::Seconds();
+      Sample->CallbackThreadId = FPlatformTLS::GetCurrentThreadId();
+      Delivered->Trigger();
+    }));
+
+    AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [Sample, Produced, Callback = MoveTemp(Callback)]() mutable
+    {
+      Sample->ProducerThreadId = FPlatformTLS::GetCurrentThreadId();
+      Sample->ProducedSeconds = FPlatformTime::Seconds();
+      Callback(0);
+      Produced->Trigger();
+    });
+
+    Produced->Wait();
+    if (Delivery.Mode == ENuxieDeliveryMode::GameThread)
+    {
+      FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+    }
+    Sample->bDelivered = Delivered->Wait(FTimespan::FromSeconds(5.0));
+
+    FPlatformProcess::ReturnSynchEventToPool(Produced);
+    FPlatformProcess::ReturnSynchEventToPool(Delivered);
+    return *Sample;
+  }
+
+  struct FDeliveryStats
+  {
+    double AverageMicroseconds = 0.0;
+    int32 Delivered = 0;
+    int32 OnProducerThread = 0;
+    int32 OnGameThread = 0;
+  };
+
+  FDeliveryStats Measure(const FNuxieDeliveryPolicy& Delivery)
+  {
+    const uint32 GameThreadId = FPlatformTLS::GetCurrentThreadId();
+    FDeliveryStats Stats;
+    double TotalMicroseconds = 0.0;
+    for (int32 Round = 0; Round < DeliveryRounds; ++Round)
+    {
+      const FDeliverySample Sample = Deliver(Delivery);
+      if (!Sample.bDelivered)
+      {
+        continue;
+      }
+
+      ++Stats.Delivered;
+      TotalMicroseconds += (Sample.DeliveredSeconds - Sample.ProducedSeconds) * 1.0e6;
+      Stats.OnProducerThread += Sample.CallbackThreadId == Sample.ProducerThreadId ? 1 : 0;
+      Stats.OnGameThread += Sample.CallbackThreadId == GameThreadId ? 1 : 0;
+    }
+    Stats.AverageMicroseconds = Stats.Delivered > 0 ? TotalMicroseconds / Stats.Delivered : 0.0;
+    return Stats;
+  }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+  FNuxieDeliveryLatencyTest,
+  "Nuxie.Delivery.Latency",
+  EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FNuxieDeliveryLatencyTest::RunTest(const FString& Parameters)
+{
+  if (!TestTrue(TEXT("Runs on the game thread"), IsInGameThread()))
+  {
+    return false;
+  }
+
+  const FDeliveryStats AnyThreadStats = Measure(FNuxieDeliveryPolicy::AnyThread());
+  const FDeliveryStats NamedThreadStats = Measure(FNuxieDeliveryPolicy::OnNamedThread(ENamedThreads::AnyBackgroundThreadNormalTask));
+  const FDeliveryStats GameThreadStats = Measure(FNuxieDeliveryPolicy::GameThread());
+
+  AddInfo(FString::Printf(
+    TEXT("Callback latency from the producing thread, average over %d results: AnyThread %.1f us, NamedThread %.1f us, GameThread %.1f us."),
+    DeliveryRounds,
+    AnyThreadStats.AverageMicroseconds,
+    NamedThreadStats.AverageMicroseconds,
+    GameThreadStats.AverageMicroseconds));
+
+  TestEqual(TEXT("AnyThread delivers every result"), AnyThreadStats.Delivered, DeliveryRounds);
+  TestEqual(TEXT("AnyThread runs callbacks inline on the producing thread"), AnyThreadStats.OnProducerThread, DeliveryRounds);
+
+  TestEqual(TEXT("NamedThread delivers every result"), NamedThreadStats.Delivered, DeliveryRounds);
+  TestEqual(TEXT("NamedThread never runs callbacks on the game thread"), NamedThreadStats.OnGameThread, 0);
+
+  TestEqual(TEXT("GameThread delivers every result"), GameThreadStats.Delivered, DeliveryRounds);
+  TestEqual(TEXT("GameThread runs callbacks on the game thread"), GameThreadStats.OnGameThread, DeliveryRounds);
+  return true;
+}
+
+#endif
@@ -0,0 +1,90 @@
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "Tests/NuxieTestBridge.h"
+
+namespace
+{
+  // Timing is reported, not asserted: the no-listener path takes around a microsecond, but shared
+  // CI machines are too noisy for a bound that means anything.
+  constexpr int32 DispatchCount = 10000;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+  FNuxieNativeTriggerDispatchTest,
+  "Nuxie.Dispatch.TriggerUpdateWithoutBlueprintListeners",
+  EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FNuxieNativeTriggerDispatchTest::RunTest(const FString& Parameters)
+{
+  FNuxieTestBridge* Bridge = nullptr;
+  UNuxieSubsystem* Subsystem = FNuxieSubsystemTestAccess::Create(FNuxieSubsystemTestAccess::MakeStateDirectory(TEXT("Dispatch")), Bridge);
+
+  int32 Received = 0;
+  const FDelegateHandle Handle = Subsystem->OnTriggerUpdateNative.AddLambda([&Received](const FString&, const FNuxieTriggerUpdate&)
+  {
+    ++Received;
+  });
+
+  FNuxieTriggerUpdate Update;
+  Update.Kind = ENuxieTriggerUpdateKind::Entitlement;
+  Update.EntitlementKind = ENuxieEntitlementUpdateKind::Pending;
+  const FString RequestId(TEXT("dispatch-test"));
+
+  // On the game thread the listener dispatches inline, so this times the whole per-event path.
+  const double StartSeconds = FPlatformTime::Seconds();
+  for (int32 Index = 0; Index < DispatchCount; ++Index)
+  {
+    Bridge->Listener->OnTriggerUpdate(RequestId, Update);
+  }
+  const double MicrosecondsPerEvent = (FPlatformTime::Seconds() - StartSeconds) * 1.0e6 / DispatchCount;
+
+  AddInfo(FString::Printf(TEXT("Trigger update dispatch without Blueprint listeners: %.3f us per event."), MicrosecondsPerEvent));
+  TestFalse(TEXT("No Blueprint listener is bound"), Subsystem->OnTriggerUpdate.IsBound());
+  TestEqual(TEXT("Every update reaches the native event"), Received, DispatchCount);
+
+  Subsystem->OnTriggerUpdateNative.Remove(Handle);
+  FNuxieSubsystemTestAccess::Destroy(Subsystem);
+  return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+  FNuxieNativeFeatureDispatchTest,
+  "Nuxie.Dispatch.FeatureAccessChangeWithoutBlueprintListeners",
+  EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FNuxieNativeFeatureDispatchTest::RunTest(const FString& Parameters)
+{
+  FNuxieTestBridge* Bridge = nullptr;
+  UNuxieSubsystem* Subsystem = FNuxieSubsystemTestAccess::Create(FNuxieSubsystemTestAccess::MakeStateDirectory(TEXT("Dispatch")), Bridge);
+
+  int32 Received = 0;
+  const FDelegateHandle Handle = Subsystem->OnFeatureAccessChangedNative.AddLambda([&Received](const FString&, const FNuxieFeatureAccess&, const FNuxieFeatureAccess&)
+  {
+    ++Received;
+  });
+
+  FNuxieFeatureAccess Previous;
+  FNuxieFeatureAccess Current;
+  Current.bAllowed = true;
+  const FString FeatureId(TEXT("dispatch_test"));
+
+  const double StartSeconds = FPlatformTime::Seconds();
+  for (int32 Index = 0; Index < DispatchCount; ++Index)
+  {
+    Bridge->Listener->OnFeatureAccessChanged(FeatureId, Previous, Current);
+  }
+  const double MicrosecondsPerEvent = (FPlatformTime::Seconds() - StartSeconds) * 1.0e6 / DispatchCount;
+
+  AddInfo(FString::Printf(TEXT("Feature access dispatch without Blueprint listeners: %.3f us per event."), MicrosecondsPerEvent));
+  TestFalse(TEXT("No Blueprint listener is bound"), Subsystem->OnFeatureAccessChanged.IsBound());
+  TestEqual(TEXT("Every change reaches the native event"), Received, DispatchCount);
+
+  Subsystem->OnFeatureAccessChangedNative.Remove(Handle);
+  FNuxieSubsystemTestAccess::Destroy(Subsystem);
+  return true;
+}
+
+#endif
@@ -0,0 +1,166 @@
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Dom/JsonObject.h"
+#include "Interfaces/IPluginManager.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "NuxieEntitlementEvaluator.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+namespace
+{
+  const TCHAR* FeatureTypeName(ENuxieFeatureType Type)
+  {
+    switch (Type)
+    {
+    case ENuxieFeatureType::Metered:
+      return TEXT("metered");
+    case ENuxieFeatureType::CreditSystem:
+      return TEXT("creditSystem");
+    default:
+      return TEXT("boolean");
+    }
+  }
+
+  // The fixtures key features by id; the profile snapshot lists them with an `id` field.
+  FString MakeProfileJson(const FJsonObject& Features)
+  {
+    TArray<TSharedPtr<FJsonValue>> FeatureArray;
+    for (const TPair<FString, TSharedPtr<FJsonValue>>& Feature : Features.Values)
+    {
+      const TSharedPtr<FJsonObject>* Object = nullptr;
+      if (Feature.Value.IsValid() && Feature.Value->TryGetObject(Object))
+      {
+        TSharedRef<FJsonObject> Row = MakeShared<FJsonObject>(**Object);
+        Row->SetStringField(TEXT("id"), Feature.Key);
+        FeatureArray.Add(MakeShared<FJsonValueObject>(Row));
+      }
+    }
+
+    TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+    Root->SetArrayField(TEXT("features"), FeatureArray);
+    FString Json;
+    const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Json);
+    FJsonSerializer::Serialize(Root, Writer);
+    return Json;
+  }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+  FNuxieEvaluatorFixtureTest,
+  "Nuxie.Evaluator.FixtureCases",
+  EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FNuxieEvaluatorFixtureTest::RunTest(const FString& Parameters)
+{
+  const TSharedPtr<IPlugin> Plugin = IPluginManager::Get().FindPlugin(TEXT("Nuxie"));
+  if (!TestTrue(TEXT("The Nuxie plugin is loaded"), Plugin.IsValid()))
+  {
+    return false;
+  }
+
+  const FString FixturePath = Plugin->GetBaseDir() / TEXT("tests/fixtures/feature_access_cases.json");
+  FString FixtureJson;
+  TArray<TSharedPtr<FJsonValue>> Cases;
+  if (!TestTrue(TEXT("The fixture file is readable"), FFileHelper::LoadFileToString(FixtureJson, *FixturePath))
+    || !TestTrue(TEXT("The fixture file is a JSON array"), FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(FixtureJson), Cases)))
+  {
+    return false;
+  }
+
+  for (const TSharedPtr<FJsonValue>& Value : Cases)
+  {
+    const TSharedPtr<FJsonObject> Case = Value.IsValid() ? Value->AsObject() : nullptr;
+    const TSharedPtr<FJsonObject>* Features = nullptr;
+    const TSharedPtr<FJsonObject>* Expected = nullptr;
+    if (!Case.IsValid() || !Case->TryGetObjectField(TEXT("features"), Features) || !Case->TryGetObjectField(TEXT("expected"), Expected))
+    {
+      AddError(TEXT("A fixture case is missing `features` or `expected`."));
+      continue;
+    }
+
+    const FString Name = Case->GetStringField(TEXT("name"));
+    FNuxieEntitlementEvaluator Evaluator;
+    Evaluator.LoadProfileJson(MakeProfileJson(**Features));
+
+    const FString EntityId = Case->GetStringField(TEXT("entityId"));
+    FNuxieFeatureAccess Access;
+    const bool bKnown = Evaluator.Evaluate(
+      FNuxieName(Case->GetStringField(TEXT("featureId"))),
+      static_cast<int32>(Case->GetNumberField(TEXT("requiredBalance"))),
+      FNuxieName::FromOptional(EntityId),
+      Access);
+
+    bool bExpectedBool = false;
+    int32 ExpectedInt = 0;
+    FString ExpectedString;
+    if ((*Expected)->TryGetBoolField(TEXT("known"), bExpectedBool))
+    {
+      TestEqual(Name + TEXT(": known"), bKnown, bExpectedBool);
+    }
+    if (!bKnown)
+    {
+      continue;
+    }
+    if ((*Expected)->TryGetBoolField(TEXT("allowed"), bExpectedBool))
+    {
+      TestEqual(Name + TEXT(": allowed"), Access.bAllowed, bExpectedBool);
+    }
+    if ((*Expected)->TryGetBoolField(TEXT("unlimited"), bExpectedBool))
+    {
+      TestEqual(Name + TEXT(": unlimited"), Access.bUnlimited, bExpectedBool);
+    }
+    if ((*Expected)->TryGetBoolField(TEXT("hasBalance"), bExpectedBool))
+    {
+      TestEqual(Name + TEXT(": hasBalance"), Access.bHasBalance, bExpectedBool);
+    }
+    if ((*Expected)->TryGetNumberField(TEXT("balance"), ExpectedInt))
+    {
+      TestEqual(Name + TEXT(": balance"), Access.Balance, ExpectedInt);
+    }
+    if ((*Expected)->TryGetStringField(TEXT("type"), ExpectedString))
+    {
+      TestEqual(Name + TEXT(": type"), FString(FeatureTypeName(Access.Type)), ExpectedString);
+    }
+  }
+  return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+  FNuxieEvaluatorGrantWithoutBalanceTest,
+  "Nuxie.Evaluator.MeteredGrantWithoutBalance",
+  EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FNuxieEvaluatorGrantWithoutBalanceTest::RunTest(const FString& Parameters)
+{
+  // A bridge answer that allows a metered feature without reporting its balance.
+  FNuxieFeatureAccess Answer;
+  Answer.Type = ENuxieFeatureType::Metered;
+  Answer.bAllowed = true;
+
+  FNuxieEntitlementEvaluator Evaluator;
+  Evaluator.Record(FNuxieName(TEXT("exports")), 5, FNuxieName(), Answer);
+
+  FNuxieFeatureAccess Access;
+  TestTrue(TEXT("The recorded answer is known locally"), Evaluator.Evaluate(FNuxieName(TEXT("exports")), 5, FNuxieName(), Access));
+  TestTrue(TEXT("The grant is honoured while the balance is unknown"), Access.bAllowed);
+  TestTrue(TEXT("A grant covers a smaller requirement"), Evaluator.Evaluate(FNuxieName(TEXT("exports")), 1, FNuxieName(), Access));
+  TestTrue(TEXT("Which is allowed"), Access.bAllowed);
+  TestFalse(TEXT("But says nothing about a larger one"), Evaluator.Evaluate(FNuxieName(TEXT("exports")), 10, FNuxieName(), Access));
+
+  Answer.bAllowed = false;
+  Evaluator.Record(FNuxieName(TEXT("exports")), 5, FNuxieName(), Answer);
+  TestTrue(TEXT("The denial is known locally"), Evaluator.Evaluate(FNuxieName(TEXT("exports")), 5, FNuxieName(), Access));
+  TestFalse(TEXT("The denial is honoured while the balance is unknown"), Access.bAllowed);
+  TestTrue(TEXT("A denial covers a larger requirement"), Evaluator.Evaluate(FNuxieName(TEXT("exports")), 10, FNuxieName(), Access));
+  TestFalse(TEXT("Which is denied"), Access.bAllowed);
+  TestFalse(TEXT("But says nothing about a smaller one"), Evaluator.Evaluate(FNuxieName(TEXT("exports")), 1, FNuxieName(), Access));
+  return true;
+}
+
+#endif
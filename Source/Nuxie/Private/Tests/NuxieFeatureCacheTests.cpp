@@ -0,0 +1,218 @@
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "NuxieFeatureCheckCache.h"
+#include "Tests/NuxieTestBridge.h"
+
+namespace
+{
+  FNuxieFeatureAccess MakeBalanceAccess(int32 Balance, int32 RequiredBalance)
+  {
+    FNuxieFeatureAccess Access;
+    Access.Type = ENuxieFeatureType::Metered;
+    Access.bHasBalance = true;
+    Access.Balance = Balance;
+    Access.bAllowed = Balance >= RequiredBalance;
+    return Access;
+  }
+
+  FNuxieFeatureCheckResult MakeCheckResult(const FNuxieFeatureAccess& Access)
+  {
+    FNuxieFeatureCheckResult Result;
+    Result.Access = Access;
+    return Result;
+  }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+  FNuxieRevalidateOneEntryTest,
+  "Nuxie.FeatureCache.RevalidateUpdatesOnlyItsEntry",
+  EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FNuxieRevalidateOneEntryTest::RunTest(const FString& Parameters)
+{
+  FNuxieTestBridge* Bridge = nullptr;
+  UNuxieSubsystem* Subsystem = FNuxieSubsystemTestAccess::Create(FNuxieSubsystemTestAccess::MakeStateDirectory(TEXT("FeatureCache")), Bridge);
+  const FString FeatureId(TEXT("gems"));
+
+  // Two entities of one metered feature, checked with different required balances.
+  Bridge->CheckResult = MakeCheckResult(MakeBalanceAccess(5, 1));
+  Subsystem->CheckFeatureAsync(FeatureId, 1, TEXT("alice"), false, [](const FNuxieFeatureCheckResult&) {}, [](const FNuxieError&) {});
+  Bridge->CheckResult = MakeCheckResult(MakeBalanceAccess(50, 10));
+  Subsystem->CheckFeatureAsync(FeatureId, 10, TEXT("bob"), false, [](const FNuxieFeatureCheckResult&) {}, [](const FNuxieError&) {});
+
+  int32 AliceChanges = 0;
+  int32 BobChanges = 0;
+  Subsystem->SubscribeFeature(FeatureId, TEXT("alice"), FNuxieFeatureAccessChangedDelegate::CreateLambda([&AliceChanges](const FString&, const FNuxieFeatureAccess&, const FNuxieFeatureAccess&)
+  {
+    ++AliceChanges;
+  }));
+  Subsystem->SubscribeFeature(FeatureId, TEXT("bob"), FNuxieFeatureAccessChangedDelegate::CreateLambda([&BobChanges](const FString&, const FNuxieFeatureAccess&, const FNuxieFeatureAccess&)
+  {
+    ++BobChanges;
+  }));
+
+  // Alice's entry is stale; the refresh answers that her balance ran out.
+  FNuxieFeatureCachePolicy StalePolicy;
+  StalePolicy.MaxAgeSeconds = -1.0f;
+  StalePolicy.StaleWhileRevalidateSeconds = 3600.0f;
+  Bridge->CheckResult = MakeCheckResult(MakeBalanceAccess(0, 1));
+  FNuxieFeatureCheckResult Cached;
+  TestTrue(TEXT("Alice's stale entry is answered from the cache"), Subsystem->TryGetCachedFeatureCheck(FeatureId, 1, TEXT("alice"), StalePolicy, Cached));
+
+  FNuxieFeatureCachePolicy FreshPolicy;
+  FreshPolicy.MaxAgeSeconds = 3600.0f;
+  FNuxieFeatureCheckResult Alice;
+  FNuxieFeatureCheckResult Bob;
+  TestTrue(TEXT("Alice's entry is cached"), Subsystem->TryGetCachedFeatureCheck(FeatureId, 1, TEXT("alice"), FreshPolicy, Alice));
+  TestTrue(TEXT("Bob's entry is cached"), Subsystem->TryGetCachedFeatureCheck(FeatureId, 10, TEXT("bob"), FreshPolicy, Bob));
+  TestFalse(TEXT("Alice's entry took the refreshed answer"), Alice.Access.bAllowed);
+  TestEqual(TEXT("Alice's balance took the refreshed answer"), Alice.Access.Balance, 0);
+  TestTrue(TEXT("Bob's entry kept its own answer"), Bob.Access.bAllowed);
+  TestEqual(TEXT("Bob's balance kept its own answer"), Bob.Access.Balance, 50);
+
+  TestEqual(TEXT("Alice's subscription saw the change"), AliceChanges, 1);
+  TestEqual(TEXT("Bob's subscription did not"), BobChanges, 0);
+
+  FNuxieFeatureAccess Evaluated;
+  TestTrue(TEXT("The evaluator recorded Alice's answer"), Subsystem->EvaluateFeatureAccess(FeatureId, 1, TEXT("alice"), Evaluated) && !Evaluated.bAllowed);
+  TestTrue(TEXT("The evaluator kept Bob's answer"), Subsystem->EvaluateFeatureAccess(FeatureId, 10, TEXT("bob"), Evaluated) && Evaluated.bAllowed);
+  TestFalse(TEXT("No feature-level row was invented from Alice's answer"), Subsystem->EvaluateFeatureAccess(FeatureId, 1, FString(), Evaluated));
+
+  FNuxieSubsystemTestAccess::Destroy(Subsystem);
+  return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+  FNuxiePushReevaluatesEntriesTest,
+  "Nuxie.FeatureCache.PushReevaluatesEachEntry",
+  EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FNuxiePushReevaluatesEntriesTest::RunTest(const FString& Parameters)
+{
+  FNuxieFeatureCheckCache Cache;
+  const FString FeatureId(TEXT("energy"));
+  FNuxieFeatureAccess Previous;
+  Cache.Store(FeatureId, 1, FString(), MakeCheckResult(MakeBalanceAccess(20, 1)), Previous);
+  Cache.Store(FeatureId, 10, FString(), MakeCheckResult(MakeBalanceAccess(20, 10)), Previous);
+  Cache.Store(FeatureId, 1, TEXT("slot_1"), MakeCheckResult(MakeBalanceAccess(3, 1)), Previous);
+
+  // A feature-level push: 5 left, and bAllowed as answered for a required balance of 1.
+  Cache.ApplyAccessChange(FeatureId, MakeBalanceAccess(5, 1));
+
+  FNuxieFeatureCachePolicy Policy;
+  Policy.MaxAgeSeconds = 3600.0f;
+  FNuxieFeatureCheckResult Result;
+  TestTrue(TEXT("Required balance 1 is still cached"), Cache.Find(FeatureId, 1, FString(), Policy, Result) == FNuxieFeatureCheckCache::ELookup::Fresh);
+  TestTrue(TEXT("5 covers a required balance of 1"), Result.Access.bAllowed);
+  TestTrue(TEXT("Required balance 10 is still cached"), Cache.Find(FeatureId, 10, FString(), Policy, Result) == FNuxieFeatureCheckCache::ELookup::Fresh);
+  TestFalse(TEXT("5 does not cover a required balance of 10"), Result.Access.bAllowed);
+  TestTrue(TEXT("The push says nothing about the entity, so its entry is dropped"), Cache.Find(FeatureId, 1, TEXT("slot_1"), Policy, Result) == FNuxieFeatureCheckCache::ELookup::Miss);
+  return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+  FNuxieCacheCaseTest,
+  "Nuxie.FeatureCache.IdsAreCaseSensitive",
+  EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FNuxieCacheCaseTest::RunTest(const FString& Parameters)
+{
+  FNuxieFeatureCheckCache Cache;
+  FNuxieFeatureAccess Previous;
+  Cache.Store(TEXT("gems"), 1, TEXT("slot_1"), MakeCheckResult(MakeBalanceAccess(5, 1)), Previous);
+
+  // FName folds these together; they are still different features and entities.
+  FNuxieFeatureCachePolicy Policy;
+  Policy.MaxAgeSeconds = 3600.0f;
+  FNuxieFeatureCheckResult Result;
+  TestTrue(TEXT("The stored spelling hits"), Cache.Find(TEXT("gems"), 1, TEXT("slot_1"), Policy, Result) == FNuxieFeatureCheckCache::ELookup::Fresh);
+  TestTrue(TEXT("A feature differing only in case misses"), Cache.Find(TEXT("Gems"), 1, TEXT("slot_1"), Policy, Result) == FNuxieFeatureCheckCache::ELookup::Miss);
+  TestTrue(TEXT("An entity differing only in case misses"), Cache.Find(TEXT("gems"), 1, TEXT("Slot_1"), Policy, Result) == FNuxieFeatureCheckCache::ELookup::Miss);
+  return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+  FNuxieCheckAnswerDispatchTest,
+  "Nuxie.FeatureCache.ChangedCheckAnswerReachesSubscriptions",
+  EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FNuxieCheckAnswerDispatchTest::RunTest(const FString& Parameters)
+{
+  FNuxieTestBridge* Bridge = nullptr;
+  UNuxieSubsystem* Subsystem = FNuxieSubsystemTestAccess::Create(FNuxieSubsystemTestAccess::MakeStateDirectory(TEXT("CheckAnswerDispatch")), Bridge);
+  const FString FeatureId(TEXT("gems"));
+
+  int32 Changes = 0;
+  bool bLastAllowed = false;
+  Subsystem->SubscribeFeature(FeatureId, FString(), FNuxieFeatureAccessChangedDelegate::CreateLambda([&Changes, &bLastAllowed](const FString&, const FNuxieFeatureAccess&, const FNuxieFeatureAccess& Current)
+  {
+    ++Changes;
+    bLastAllowed = Current.bAllowed;
+  }));
+
+  auto Check = [Subsystem, Bridge, &FeatureId](const FNuxieFeatureAccess& Access)
+  {
+    Bridge->CheckResult = MakeCheckResult(Access);
+    Subsystem->CheckFeatureAsync(FeatureId, 1, FString(), true, [](const FNuxieFeatureCheckResult&) {}, [](const FNuxieError&) {});
+  };
+
+  // Nothing was known, so the first answer is a change: a gate waiting on it opens.
+  Check(MakeBalanceAccess(5, 1));
+  TestEqual(TEXT("The first answer reaches the subscription"), Changes, 1);
+  TestTrue(TEXT("It carries the answer"), bLastAllowed);
+
+  Check(MakeBalanceAccess(5, 1));
+  TestEqual(TEXT("The same answer again does not"), Changes, 1);
+
+  Check(MakeBalanceAccess(0, 1));
+  TestEqual(TEXT("A different answer does"), Changes, 2);
+  TestFalse(TEXT("It carries the new answer"), bLastAllowed);
+
+  FNuxieSubsystemTestAccess::Destroy(Subsystem);
+  return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+  FNuxieRequestFeatureAccessSharedTest,
+  "Nuxie.FeatureCache.GateRequestsShareOneCheck",
+  EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FNuxieRequestFeatureAccessSharedTest::RunTest(const FString& Parameters)
+{
+  FNuxieTestBridge* Bridge = nullptr;
+  UNuxieSubsystem* Subsystem = FNuxieSubsystemTestAccess::Create(FNuxieSubsystemTestAccess::MakeStateDirectory(TEXT("FeatureCache")), Bridge);
+  const FString FeatureId(TEXT("gems"));
+  constexpr int32 Gates = 100;
+
+  int32 Changes = 0;
+  Subsystem->SubscribeFeature(FeatureId, FString(), FNuxieFeatureAccessChangedDelegate::CreateLambda([&Changes](const FString&, const FNuxieFeatureAccess&, const FNuxieFeatureAccess&)
+  {
+    ++Changes;
+  }));
+
+  // Every gate on the feature registers before the SDK answers, as on a level load.
+  Bridge->CheckResult = MakeCheckResult(MakeBalanceAccess(5, 1));
+  Bridge->bHoldChecks = true;
+  for (int32 Index = 0; Index < Gates; ++Index)
+  {
+    Subsystem->RequestFeatureAccess(FeatureId, 1, FString());
+  }
+  TestEqual(TEXT("The gates share one bridge check"), Bridge->CheckFeatureCalls, 1);
+
+  Bridge->ReleaseChecks();
+  FNuxieFeatureAccess Access;
+  TestTrue(TEXT("The answer is known locally"), Subsystem->EvaluateFeatureAccess(FeatureId, 1, FString(), Access));
+  TestEqual(TEXT("And reached the subscription once"), Changes, 1);
+
+  Bridge->bHoldChecks = false;
+  Subsystem->RequestFeatureAccess(FeatureId, 1, FString());
+  TestEqual(TEXT("Once answered, the key can be asked again"), Bridge->CheckFeatureCalls, 2);
+
+  FNuxieSubsystemTestAccess::Destroy(Subsystem);
+  return true;
+}
+
+#endif
@@ -0,0 +1,62 @@
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "NuxieName.h"
+
+namespace
+{
+  constexpr int32 IdentifierCount = 256;
+  constexpr int32 LookupRounds = 1000;
+
+  double TimeNsPerLookup(TFunctionRef<void()> Round)
+  {
+    const double StartSeconds = FPlatformTime::Seconds();
+    for (int32 RoundIndex = 0; RoundIndex < LookupRounds; ++RoundIndex)
+    {
+      Round();
+    }
+    return (FPlatformTime::Seconds() - StartSeconds) * 1.0e9 / (static_cast<double>(LookupRounds) * IdentifierCount);
+  }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+  FNuxieIdentifierLookupCostTest,
+  "Nuxie.Identifiers.LookupCost",
+  EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FNuxieIdentifierLookupCostTest::RunTest(const FString& Parameters)
+{
+  // The subsystem's caches used to key on FString and now key on FNuxieName. This times both
+  // lookups, plus interning an FString per call as the FString overloads still do. The timings
+  // are logged for comparison; a wall-clock bound would only measure the machine.
+  TArray<FString> Ids;
+  TArray<FNuxieName> Names;
+  TMap<FString, int32> ByString;
+  TMap<FNuxieName, int32> ByName;
+  for (int32 Index = 0; Index < IdentifierCount; ++Index)
+  {
+    const FString& Id = Ids.Add_GetRef(FString::Printf(TEXT("Feature_%d"), Index));
+    Names.Add(FNuxieName(Id));
+    ByString.Add(Id, Index);
+    ByName.Add(Names.Last(), Index);
+  }
+
+  int64 Found = 0;
+  const double StringNs = TimeNsPerLookup([&]() { for (const FString& Id : Ids) { Found += ByString.Contains(Id) ? 1 : 0; } });
+  const double InternNs = TimeNsPerLookup([&]() { for (const FString& Id : Ids) { Found += ByName.Contains(FNuxieName(Id, FNAME_Find)) ? 1 : 0; } });
+  const double NameNs = TimeNsPerLookup([&]() { for (const FNuxieName& Name : Names) { Found += ByName.Contains(Name) ? 1 : 0; } });
+
+  AddInfo(FString::Printf(
+    TEXT("%d IDs, ns per lookup: FString key %.1f, FString interned per call %.1f, FNuxieName key %.1f."),
+    IdentifierCount,
+    StringNs,
+    InternNs,
+    NameNs));
+
+  TestEqual(TEXT("Every lookup finds its ID"), Found, int64(3) * LookupRounds * IdentifierCount);
+  return true;
+}
+
+#endif
@@ -0,0 +1,76 @@
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "NuxieIdentifyDiffer.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+  FNuxieIdentifyDifferTest,
+  "Nuxie.Identify.SendsOnlyChanges",
+  EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FNuxieIdentifyDifferTest::RunTest(const FString& Parameters)
+{
+  FNuxieIdentifyDiffer Differ;
+  FNuxieIdentifyDiffer::FUpdate Update;
+
+  FNuxiePropertyBag Properties;
+  Properties.SetInt(TEXT("level"), 3).SetString(TEXT("class"), TEXT("mage"));
+  FNuxiePropertyBag SetOnce;
+  SetOnce.SetString(TEXT("first_seen"), TEXT("2026-01-01"));
+  TestTrue(TEXT("The first call switches to the user"), Differ.Add(TEXT("alice"), Properties, SetOnce, Update) == FNuxieIdentifyDiffer::EResult::SendNow);
+  TestEqual(TEXT("It sends every property"), Update.UserProperties.Num(), 2);
+  TestEqual(TEXT("And the set-once key"), Update.UserPropertiesSetOnce.Num(), 1);
+
+  TestTrue(TEXT("The same call again is suppressed"), Differ.Add(TEXT("alice"), Properties, SetOnce, Update) == FNuxieIdentifyDiffer::EResult::Suppressed);
+
+  FNuxiePropertyBag Changed;
+  Changed.SetInt(TEXT("level"), 4).SetString(TEXT("class"), TEXT("mage"));
+  TestTrue(TEXT("A changed value is merged"), Differ.Add(TEXT("alice"), Changed, FNuxiePropertyBag(), Update) == FNuxieIdentifyDiffer::EResult::Merged);
+  FNuxieIdentifyDiffer::FUpdate Pending;
+  TestTrue(TEXT("The merged update is pending"), Differ.TakePending(Pending));
+  TestEqual(TEXT("It carries only the changed key"), Pending.UserProperties.Num(), 1);
+  TestTrue(TEXT("Which is level"), Pending.UserProperties.Contains(TEXT("level")));
+  return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+  FNuxieIdentifyDifferCaseTest,
+  "Nuxie.Identify.IdsAndKeysAreCaseSensitive",
+  EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FNuxieIdentifyDifferCaseTest::RunTest(const FString& Parameters)
+{
+  FNuxieIdentifyDiffer Differ;
+  FNuxieIdentifyDiffer::FUpdate Update;
+
+  FNuxiePropertyBag Properties;
+  Properties.SetInt(TEXT("level"), 3);
+  Differ.Add(TEXT("User"), Properties, FNuxiePropertyBag(), Update);
+
+  // Another user whose ID differs only in case: a switch, with nothing carried over from "User".
+  TestTrue(TEXT("A distinct ID differing only in case is a switch"), Differ.IsSwitch(TEXT("user")));
+  TestTrue(TEXT("It is sent right away"), Differ.Add(TEXT("user"), Properties, FNuxiePropertyBag(), Update) == FNuxieIdentifyDiffer::EResult::SendNow);
+  TestEqual(TEXT("With every property, since that user never got them"), Update.UserProperties.Num(), 1);
+
+  // Property keys differing only in case are different properties.
+  FNuxiePropertyBag Renamed;
+  Renamed.SetInt(TEXT("level"), 3).SetInt(TEXT("Level"), 3);
+  TestTrue(TEXT("A key differing only in case is a change"), Differ.Add(TEXT("user"), Renamed, FNuxiePropertyBag(), Update) == FNuxieIdentifyDiffer::EResult::Merged);
+  FNuxieIdentifyDiffer::FUpdate Pending;
+  Differ.TakePending(Pending);
+  TestEqual(TEXT("Only the new key is sent"), Pending.UserProperties.Num(), 1);
+  TestTrue(TEXT("Under its own spelling"), Pending.UserProperties.Contains(TEXT("Level")));
+
+  FNuxiePropertyBag SetOnce;
+  SetOnce.SetString(TEXT("origin"), TEXT("store"));
+  Differ.Add(TEXT("user"), FNuxiePropertyBag(), SetOnce, Update);
+  Differ.TakePending(Pending);
+  FNuxiePropertyBag OtherSetOnce;
+  OtherSetOnce.SetString(TEXT("Origin"), TEXT("store"));
+  TestTrue(TEXT("A set-once key differing only in case is still sent"), Differ.Add(TEXT("user"), FNuxiePropertyBag(), OtherSetOnce, Update) == FNuxieIdentifyDiffer::EResult::Merged);
+  return true;
+}
+
+#endif
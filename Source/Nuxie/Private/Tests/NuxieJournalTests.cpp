@@ -0,0 +1,201 @@
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "NuxieEventJournal.h"
+#include "Platform/Http/NuxieHttpBridge.h"
+#include "Tests/NuxieTestBridge.h"
+
+namespace
+{
+  void ConfigureWithJournal(UNuxieSubsystem* Subsystem)
+  {
+    FNuxieConfigureOptions Options;
+    Options.ApiKey = TEXT("test");
+    Options.bEnableEventJournal = true;
+    FNuxieError Error;
+    Subsystem->Configure(Options, Error);
+  }
+
+  // The cost test reports its timings rather than bounding them; shared CI machines are too noisy
+  // for a wall-clock limit. Use the Journal Append / Journal Recover stats to profile.
+  constexpr int32 CostRecords = 20000;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+  FNuxieJournalCleanSessionTest,
+  "Nuxie.Journal.CleanSessionReplaysNothing",
+  EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FNuxieJournalCleanSessionTest::RunTest(const FString& Parameters)
+{
+  const FString StateDirectory = FNuxieSubsystemTestAccess::MakeStateDirectory(TEXT("JournalCleanSession"));
+
+  FNuxieTestBridge* Bridge = nullptr;
+  UNuxieSubsystem* Subsystem = FNuxieSubsystemTestAccess::Create(StateDirectory, Bridge);
+  ConfigureWithJournal(Subsystem);
+
+  FNuxieError Error;
+  Subsystem->UseFeature(TEXT("gems"), 1.0f, FString(), TMap<FString, FString>(), Error);
+  Subsystem->UseFeature(TEXT("gems"), 2.0f, TEXT("slot_1"), TMap<FString, FString>(), Error);
+  TestEqual(TEXT("Both uses are journaled once the bridge takes them"), Subsystem->GetJournaledEventCount(), 2);
+
+  // The session ends normally: no explicit flush, the SDK shuts down cleanly.
+  FNuxieSubsystemTestAccess::Destroy(Subsystem);
+
+  Subsystem = FNuxieSubsystemTestAccess::Create(StateDirectory, Bridge);
+  ConfigureWithJournal(Subsystem);
+  TestEqual(TEXT("Nothing is replayed"), Subsystem->GetReplayedEventCount(), int64(0));
+  TestEqual(TEXT("The bridge sees no uses"), Bridge->UseFeatureCalls, 0);
+  TestEqual(TEXT("The journal starts empty"), Subsystem->GetJournaledEventCount(), 0);
+
+  FNuxieSubsystemTestAccess::Destroy(Subsystem);
+  return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+  FNuxieJournalCrashReplayTest,
+  "Nuxie.Journal.CrashIsReplayedOnce",
+  EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FNuxieJournalCrashReplayTest::RunTest(const FString& Parameters)
+{
+  const FString StateDirectory = FNuxieSubsystemTestAccess::MakeStateDirectory(TEXT("JournalCrash"));
+
+  // A process that died after handing a use to the bridge: the record is on disk, never acknowledged.
+  {
+    FNuxieEventJournal Journal(StateDirectory / TEXT("Journal"));
+    Journal.Open(100);
+    Journal.AppendUseFeature(TEXT("gems"), 3.0f, FString(), TMap<FString, FString>());
+    Journal.Close();
+  }
+
+  FNuxieTestBridge* Bridge = nullptr;
+  UNuxieSubsystem* Subsystem = FNuxieSubsystemTestAccess::Create(StateDirectory, Bridge);
+  ConfigureWithJournal(Subsystem);
+  TestEqual(TEXT("The unacknowledged use is replayed"), Subsystem->GetReplayedEventCount(), int64(1));
+  TestEqual(TEXT("The replay reaches the bridge"), Bridge->UseFeatureCalls, 1);
+  FNuxieSubsystemTestAccess::Destroy(Subsystem);
+
+  Subsystem = FNuxieSubsystemTestAccess::Create(StateDirectory, Bridge);
+  ConfigureWithJournal(Subsystem);
+  TestEqual(TEXT("A replayed use is not replayed again"), Subsystem->GetReplayedEventCount(), int64(0));
+  FNuxieSubsystemTestAccess::Destroy(Subsystem);
+  return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+  FNuxieJournalUnsentShutdownTest,
+  "Nuxie.Journal.UnsentEventsAtShutdownAreReplayed",
+  EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FNuxieJournalUnsentShutdownTest::RunTest(const FString& Parameters)
+{
+  const FString StateDirectory = FNuxieSubsystemTestAccess::MakeStateDirectory(TEXT("JournalUnsentShutdown"));
+
+  // An HTTP bridge whose API is unreachable: the use stays queued through the final flush.
+  UNuxieSubsystem* Subsystem = FNuxieSubsystemTestAccess::CreateWith(MakeUnique<FNuxieHttpBridge>(), StateDirectory);
+  FNuxieConfigureOptions Options;
+  Options.ApiKey = TEXT("test");
+  Options.ApiEndpoint = TEXT("http://127.0.0.1:1");
+  Options.RetryCount = 0;
+  Options.RequestTimeoutSeconds = 1;
+  Options.FlushAt = 100;
+  Options.bEnableEventJournal = true;
+  FNuxieError Error;
+  TestTrue(TEXT("The HTTP bridge configures"), Subsystem->Configure(Options, Error));
+  Subsystem->UseFeature(TEXT("gems"), 1.0f, FString(), TMap<FString, FString>(), Error);
+  TestEqual(TEXT("The use is journaled"), Subsystem->GetJournaledEventCount(), 1);
+  FNuxieSubsystemTestAccess::Destroy(Subsystem);
+
+  FNuxieTestBridge* Bridge = nullptr;
+  Subsystem = FNuxieSubsystemTestAccess::Create(StateDirectory, Bridge);
+  ConfigureWithJournal(Subsystem);
+  TestEqual(TEXT("The unsent use is replayed"), Subsystem->GetReplayedEventCount(), int64(1));
+  TestEqual(TEXT("The replay reaches the bridge"), Bridge->UseFeatureCalls, 1);
+  FNuxieSubsystemTestAccess::Destroy(Subsystem);
+  return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+  FNuxieJournalNativeFlushTest,
+  "Nuxie.Journal.EmptyNativeQueueAcknowledges",
+  EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FNuxieJournalNativeFlushTest::RunTest(const FString& Parameters)
+{
+  FNuxieTestBridge* Bridge = nullptr;
+  UNuxieSubsystem* Subsystem = FNuxieSubsystemTestAccess::Create(FNuxieSubsystemTestAccess::MakeStateDirectory(TEXT("JournalNativeFlush")), Bridge);
+  ConfigureWithJournal(Subsystem);
+
+  FNuxieError Error;
+  Subsystem->UseFeature(TEXT("gems"), 1.0f, FString(), TMap<FString, FString>(), Error);
+
+  // The SDK has not sent it yet.
+  Bridge->QueuedEventCount = 1;
+  FNuxieSubsystemTestAccess::TickEventJournal(Subsystem);
+  TestEqual(TEXT("A queued use stays journaled"), Subsystem->GetJournaledEventCount(), 1);
+
+  // Its own FlushAt or interval flush sent it.
+  Bridge->QueuedEventCount = 0;
+  FNuxieSubsystemTestAccess::TickEventJournal(Subsystem);
+  TestEqual(TEXT("A sent use is acknowledged without an explicit flush"), Subsystem->GetJournaledEventCount(), 0);
+  TestEqual(TEXT("No flush was needed"), Bridge->FlushCalls, 0);
+
+  FNuxieSubsystemTestAccess::Destroy(Subsystem);
+  return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+  FNuxieJournalCostTest,
+  "Nuxie.Journal.AppendAndRecoverCost",
+  EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FNuxieJournalCostTest::RunTest(const FString& Parameters)
+{
+  const FString Directory = FNuxieSubsystemTestAccess::MakeStateDirectory(TEXT("JournalCost")) / TEXT("Journal");
+
+  TMap<FString, FString> Metadata;
+  Metadata.Add(TEXT("source"), TEXT("arena"));
+  Metadata.Add(TEXT("level"), TEXT("12"));
+
+  double AppendSeconds = 0.0;
+  {
+    FNuxieEventJournal Journal(Directory);
+    Journal.Open(CostRecords);
+    const double StartSeconds = FPlatformTime::Seconds();
+    for (int32 Index = 0; Index < CostRecords; ++Index)
+    {
+      Journal.AppendUseFeature(TEXT("coins"), 1.0f, FString(), Metadata);
+    }
+    AppendSeconds = FPlatformTime::Seconds() - StartSeconds;
+    Journal.Close();
+  }
+
+  double RecoverSeconds = 0.0;
+  TArray<FNuxieEventJournal::FUseFeatureRecord> Records;
+  {
+    FNuxieEventJournal Journal(Directory);
+    const double StartSeconds = FPlatformTime::Seconds();
+    Journal.Open(CostRecords);
+    Journal.TakeRecovered(Records);
+    RecoverSeconds = FPlatformTime::Seconds() - StartSeconds;
+    Journal.Close();
+  }
+
+  const double AppendMicroseconds = AppendSeconds * 1.0e6 / CostRecords;
+  const double RecoverMicroseconds = RecoverSeconds * 1.0e6 / CostRecords;
+  AddInfo(FString::Printf(
+    TEXT("%d records: append %.2f us each (%.0f records/s), recover %.2f us each."),
+    CostRecords,
+    AppendMicroseconds,
+    AppendSeconds > 0.0 ? CostRecords / AppendSeconds : 0.0,
+    RecoverMicroseconds));
+
+  TestEqual(TEXT("Every appended record is recovered"), Records.Num(), CostRecords);
+  TestTrue(TEXT("The last record survived intact"), Records.Num() > 0 && Records.Last().FeatureId == TEXT("coins") && Records.Last().Metadata.Num() == Metadata.Num());
+  return true;
+}
+
+#endif
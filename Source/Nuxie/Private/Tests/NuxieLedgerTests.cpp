@@ -0,0 +1,133 @@
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "Misc/Paths.h"
+#include "NuxieBalanceLedger.h"
+#include "Tests/NuxieTestBridge.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+  FNuxieLedgerIdentityTest,
+  "Nuxie.Ledger.KeepsUsesAcrossSessionsOfOneUser",
+  EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FNuxieLedgerIdentityTest::RunTest(const FString& Parameters)
+{
+  const FString PersistPath = FNuxieSubsystemTestAccess::MakeStateDirectory(TEXT("Ledger")) / TEXT("PendingUsage.json");
+  {
+    FNuxieBalanceLedger Ledger(PersistPath);
+    Ledger.SetDistinctId(TEXT("alice"));
+    TOptional<int32> Projected;
+    Ledger.Reserve(TEXT("gems"), FString(), 3, 10, Projected);
+  }
+
+  FNuxieBalanceLedger Ledger(PersistPath);
+  TestEqual(TEXT("The unconfirmed use is restored"), Ledger.Load(), 1);
+  TestFalse(TEXT("Identifying as the same user does not clear the ledger"), Ledger.SetDistinctId(TEXT("alice")));
+  TestEqual(TEXT("The restored use is still pending"), Ledger.NumPending(), 1);
+  TestTrue(TEXT("Identifying as another user clears the ledger"), Ledger.SetDistinctId(TEXT("bob")));
+  TestEqual(TEXT("Nothing is pending for the new user"), Ledger.NumPending(), 0);
+  return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+  FNuxieLedgerDeferredSaveTest,
+  "Nuxie.Ledger.SavesOffTheMutationPath",
+  EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FNuxieLedgerDeferredSaveTest::RunTest(const FString& Parameters)
+{
+  const FString PersistPath = FNuxieSubsystemTestAccess::MakeStateDirectory(TEXT("Ledger")) / TEXT("PendingUsage.json");
+  FNuxieBalanceLedger Ledger(PersistPath);
+
+  // The ticker does not run inside the test, so nothing may be written until Flush.
+  TOptional<int32> Projected;
+  for (int32 Index = 0; Index < 100; ++Index)
+  {
+    Ledger.Reserve(TEXT("gems"), FString(), 1, 1000, Projected);
+  }
+  TestFalse(TEXT("Reserve does not write the file itself"), FPaths::FileExists(PersistPath));
+
+  Ledger.Flush();
+  TestTrue(TEXT("Flush writes the pending uses"), FPaths::FileExists(PersistPath));
+
+  FNuxieBalanceLedger Restored(PersistPath);
+  TestEqual(TEXT("Every use made it into the single write"), Restored.Load(), 100);
+  return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+  FNuxieLedgerShortfallTest,
+  "Nuxie.Ledger.ShortfallReportsError",
+  EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FNuxieLedgerShortfallTest::RunTest(const FString& Parameters)
+{
+  FNuxieTestBridge* Bridge = nullptr;
+  UNuxieSubsystem* Subsystem = FNuxieSubsystemTestAccess::Create(FNuxieSubsystemTestAccess::MakeStateDirectory(TEXT("Ledger")), Bridge);
+
+  // Seeds a known balance of 2.
+  Bridge->CheckResult.Access.Type = ENuxieFeatureType::Metered;
+  Bridge->CheckResult.Access.bHasBalance = true;
+  Bridge->CheckResult.Access.Balance = 2;
+  Bridge->CheckResult.Access.bAllowed = true;
+  Subsystem->CheckFeatureAsync(TEXT("gems"), 1, FString(), false, [](const FNuxieFeatureCheckResult&) {}, [](const FNuxieError&) {});
+
+  int32 Successes = 0;
+  TArray<FString> ErrorCodes;
+  const FNuxieFeatureUsageResult Projected = Subsystem->UseFeatureOptimistic(
+    TEXT("gems"),
+    5.0f,
+    FString(),
+    TMap<FString, FString>(),
+    [&Successes](const FNuxieFeatureUsageResult&) { ++Successes; },
+    [&ErrorCodes](const FNuxieError& Error) { ErrorCodes.Add(Error.Code); },
+    FNuxieDeliveryPolicy::AnyThread());
+
+  TestFalse(TEXT("The shortfall is projected"), Projected.bSuccess);
+  TestEqual(TEXT("Nothing is submitted"), Bridge->UseFeatureCalls, 0);
+  TestEqual(TEXT("OnSuccess does not fire"), Successes, 0);
+  TestEqual(TEXT("OnError fires once"), ErrorCodes.Num(), 1);
+  TestTrue(TEXT("OnError reports INSUFFICIENT_BALANCE"), ErrorCodes.Num() == 1 && ErrorCodes[0] == TEXT("INSUFFICIENT_BALANCE"));
+
+  FNuxieSubsystemTestAccess::Destroy(Subsystem);
+  return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+  FNuxieLedgerCaseTest,
+  "Nuxie.Ledger.IdsAreCaseSensitive",
+  EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FNuxieLedgerCaseTest::RunTest(const FString& Parameters)
+{
+  const FString PersistPath = FNuxieSubsystemTestAccess::MakeStateDirectory(TEXT("Ledger")) / TEXT("PendingUsage.json");
+  {
+    FNuxieBalanceLedger Ledger(PersistPath);
+    Ledger.SetDistinctId(TEXT("alice"));
+    TOptional<int32> Projected;
+    Ledger.Reserve(TEXT("LedgerGems"), FString(), 3, 10, Projected);
+    Ledger.Reserve(TEXT("ledgergems"), FString(), 1, 50, Projected);
+    TestEqual(TEXT("A feature differing only in case keeps its own base"), Projected.Get(0), 49);
+
+    int32 Balance = 0;
+    TestTrue(TEXT("The first feature projects"), Ledger.GetProjectedBalance(TEXT("LedgerGems"), FString(), TOptional<int32>(), Balance));
+    TestEqual(TEXT("From its own delta only"), Balance, 7);
+
+    Ledger.Reserve(TEXT("ledgergems"), TEXT("Hero"), 2, 5, Projected);
+    TestFalse(TEXT("Entities differing only in case stay apart"), Ledger.HasPending(TEXT("ledgergems"), TEXT("hero")));
+  }
+
+  FNuxieBalanceLedger Ledger(PersistPath);
+  TestEqual(TEXT("Every use is restored"), Ledger.Load(), 3);
+  TestTrue(TEXT("With the spelling it was saved under"), Ledger.HasPending(TEXT("LedgerGems"), FString()));
+  TestTrue(TEXT("For both features"), Ledger.HasPending(TEXT("ledgergems"), FString()));
+  TestTrue(TEXT("And the entity"), Ledger.HasPending(TEXT("ledgergems"), TEXT("Hero")));
+
+  TestTrue(TEXT("A distinct ID differing only in case is another user"), Ledger.SetDistinctId(TEXT("Alice")));
+  TestEqual(TEXT("So the pending uses are cleared"), Ledger.NumPending(), 0);
+  return true;
+}
+
+#endif
@@ -0,0 +1,41 @@
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "NuxiePurchaseTracker.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+  FNuxiePurchaseTrackerExpiryTest,
+  "Nuxie.Purchases.ExpireBeforePlatformTimeout",
+  EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FNuxiePurchaseTrackerExpiryTest::RunTest(const FString& Parameters)
+{
+  using EKind = FNuxiePurchaseTracker::EKind;
+  const TSharedRef<FNuxiePurchaseTracker, ESPMode::ThreadSafe> Tracker = MakeShared<FNuxiePurchaseTracker, ESPMode::ThreadSafe>(
+    [](const FString&, const FNuxiePurchaseResult&) {},
+    [](const FString&, const FNuxieRestoreResult&) {});
+
+  TestTrue(TEXT("A handle expires no later than the platform SDK's timeout"), FNuxiePurchaseTracker::ExpireAfterSeconds <= FNuxiePurchaseTracker::TimeoutSeconds);
+
+  constexpr double BeganAt = 1000.0;
+  const double JustInTime = BeganAt + FNuxiePurchaseTracker::ExpireAfterSeconds - 0.5;
+  const double TooLate = BeganAt + FNuxiePurchaseTracker::ExpireAfterSeconds;
+
+  Tracker->Begin(TEXT("on_time"), EKind::Purchase, BeganAt);
+  TestTrue(TEXT("A request is pending until it expires"), Tracker->IsPending(TEXT("on_time"), JustInTime));
+  TestTrue(TEXT("And can be claimed"), Tracker->Claim(TEXT("on_time"), EKind::Purchase, JustInTime));
+
+  Tracker->Begin(TEXT("late"), EKind::Purchase, BeganAt);
+  Tracker->Begin(TEXT("late_restore"), EKind::Restore, BeganAt);
+  TestFalse(TEXT("An expired request is not pending"), Tracker->IsPending(TEXT("late"), TooLate));
+  TestFalse(TEXT("An expired purchase cannot be claimed"), Tracker->Claim(TEXT("late"), EKind::Purchase, TooLate));
+  TestFalse(TEXT("Nor an expired restore"), Tracker->Claim(TEXT("late_restore"), EKind::Restore, TooLate));
+  TestEqual(TEXT("Expired requests leave the pending count"), Tracker->GetStats(EKind::Purchase).Pending, 0);
+  TestEqual(TEXT("Only the claimed request is completed"), Tracker->GetStats(EKind::Purchase).Completed, 1);
+  TestEqual(TEXT("For either kind"), Tracker->GetStats(EKind::Restore).Pending, 0);
+  return true;
+}
+
+#endif
@@ -0,0 +1,49 @@
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "Tests/NuxieTestBridge.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+  FNuxieRateLimitZeroRateTest,
+  "Nuxie.RateLimits.DeferringRuleNeedsRefillRate",
+  EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FNuxieRateLimitZeroRateTest::RunTest(const FString& Parameters)
+{
+  FNuxieTestBridge* Bridge = nullptr;
+  UNuxieSubsystem* Subsystem = FNuxieSubsystemTestAccess::Create(FNuxieSubsystemTestAccess::MakeStateDirectory(TEXT("RateLimits")), Bridge);
+
+  FNuxieRateLimitRule Rule;
+  Rule.Target = ENuxieRateLimitTarget::Feature;
+  Rule.Key = TEXT("coins");
+  Rule.TokensPerSecond = 0.0f;
+  Rule.Burst = 1;
+  Rule.Policy = ENuxieRateLimitPolicy::Queue;
+
+  FNuxieConfigureOptions Options;
+  Options.ApiKey = TEXT("test");
+  Options.RateLimits.Add(Rule);
+  FNuxieError Error;
+  TestFalse(TEXT("A queueing rule that never refills is rejected"), Subsystem->Configure(Options, Error));
+  TestEqual(TEXT("As an invalid argument"), Error.Code, FString(TEXT("INVALID_ARGUMENT")));
+  TestEqual(TEXT("Before the bridge is configured"), Bridge->ConfigureCalls, 0);
+
+  Options.RateLimits[0].Policy = ENuxieRateLimitPolicy::Coalesce;
+  TestFalse(TEXT("So is a coalescing one"), Subsystem->Configure(Options, Error));
+
+  // A fixed quota is fine: calls past it fail straight away.
+  Options.RateLimits[0].Policy = ENuxieRateLimitPolicy::Drop;
+  TestTrue(TEXT("A dropping rule may have no refill rate"), Subsystem->Configure(Options, Error));
+
+  Rule.TokensPerSecond = 5.0f;
+  Options.RateLimits[0].Policy = ENuxieRateLimitPolicy::Queue;
+  Options.RateLimits.Add(Rule);
+  TestTrue(TEXT("A later rule for the same key replaces the zero-rate one"), Subsystem->Configure(Options, Error));
+
+  FNuxieSubsystemTestAccess::Destroy(Subsystem);
+  return true;
+}
+
+#endif
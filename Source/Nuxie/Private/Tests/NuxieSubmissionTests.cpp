@@ -0,0 +1,55 @@
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Async/Async.h"
+#include "HAL/Event.h"
+#include "Misc/AutomationTest.h"
+#include "Tests/NuxieTestBridge.h"
+
+#include <atomic>
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+  FNuxieSubmitDuringTeardownTest,
+  "Nuxie.Submission.PushDuringTeardownIsRejected",
+  EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FNuxieSubmitDuringTeardownTest::RunTest(const FString& Parameters)
+{
+  FNuxieTestBridge* Bridge = nullptr;
+  UNuxieSubsystem* Subsystem = FNuxieSubsystemTestAccess::Create(FNuxieSubsystemTestAccess::MakeStateDirectory(TEXT("SubmitTeardown")), Bridge);
+
+  // A worker keeps submitting until the subsystem turns it away.
+  std::atomic<int32> Accepted { 0 };
+  std::atomic<bool> bRejected { false };
+  FEvent* Started = FPlatformProcess::GetSynchEventFromPool();
+  TFuture<void> Producer = Async(EAsyncExecution::Thread, [Subsystem, Started, &Accepted, &bRejected]()
+  {
+    for (int32 Index = 0; Index < 1000000; ++Index)
+    {
+      if (!Subsystem->SubmitUseFeature(TEXT("gems"), 1.0f, FString(), TMap<FString, FString>()))
+      {
+        bRejected = true;
+        break;
+      }
+      if (Accepted.fetch_add(1) == 0)
+      {
+        Started->Trigger();
+      }
+    }
+  });
+
+  Started->Wait();
+  FNuxieSubsystemTestAccess::Destroy(Subsystem);
+  Producer.Wait();
+  FPlatformProcess::ReturnSynchEventToPool(Started);
+
+  AddInfo(FString::Printf(TEXT("%d submissions accepted before teardown."), Accepted.load()));
+  TestTrue(TEXT("The worker was submitting when teardown started"), Accepted.load() > 0);
+  TestTrue(TEXT("Submissions after teardown are rejected"), bRejected.load());
+  TestFalse(TEXT("A later submission is rejected too"), Subsystem->SubmitUseFeature(TEXT("gems"), 1.0f, FString(), TMap<FString, FString>()));
+  TestTrue(TEXT("A later trigger start gets no request id"), Subsystem->SubmitStartTrigger(TEXT("level_up"), FNuxieTriggerOptions()).IsEmpty());
+  return true;
+}
+
+#endif
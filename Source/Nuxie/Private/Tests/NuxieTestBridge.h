@@ -0,0 +1,283 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "HAL/FileManager.h"
+#include "Misc/Paths.h"
+#include "NuxiePlatformBridge.h"
+#include "NuxieSubsystem.h"
+
+/**
+ * In-memory bridge for the automation tests. Counts the calls the subsystem makes and answers
+ * synchronously on the calling thread; the public fields set what it answers.
+ */
+class FNuxieTestBridge final : public INuxiePlatformBridge
+{
+public:
+  INuxiePlatformBridgeListener* Listener = nullptr;
+
+  bool bSucceed = true;
+  int32 QueuedEventCount = 0;
+  FNuxieFeatureCheckResult CheckResult;
+
+  /** While set, CheckFeatureAsync keeps its answers in HeldChecks until ReleaseChecks. */
+  bool bHoldChecks = false;
+  TArray<TFunction<void()>> HeldChecks;
+
+  int32 ConfigureCalls = 0;
+  int32 ShutdownCalls = 0;
+  int32 IdentifyCalls = 0;
+  int32 ResetCalls = 0;
+  int32 StartTriggerCalls = 0;
+  int32 CancelTriggerCalls = 0;
+  int32 CheckFeatureCalls = 0;
+  int32 UseFeatureCalls = 0;
+  int32 FlushCalls = 0;
+  TArray<FString> StartedRequestIds;
+  TArray<FString> CancelledRequestIds;
+
+  virtual void SetListener(INuxiePlatformBridgeListener* InListener) override
+  {
+    Listener = InListener;
+  }
+
+  virtual bool Configure(const FNuxieConfigureOptions& Options, FNuxieError& OutError) override
+  {
+    ++ConfigureCalls;
+    return Answer(OutError);
+  }
+
+  virtual bool Shutdown(FNuxieError& OutError) override
+  {
+    ++ShutdownCalls;
+    return Answer(OutError);
+  }
+
+  virtual bool UpdateRuntimeOptions(const FNuxieRuntimeOptions& Options, FNuxieError& OutError) override
+  {
+    return Answer(OutError);
+  }
+
+  virtual bool Identify(
+    const FString& DistinctId,
+    const TMap<FString, FString>& UserProperties,
+    const TMap<FString, FString>& UserPropertiesSetOnce,
+    FNuxieError& OutError) override
+  {
+    ++IdentifyCalls;
+    CurrentDistinctId = DistinctId;
+    return Answer(OutError);
+  }
+
+  virtual bool Reset(bool bKeepAnonymousId, FNuxieError& OutError) override
+  {
+    ++ResetCalls;
+    CurrentDistinctId.Reset();
+    return Answer(OutError);
+  }
+
+  virtual FString GetDistinctId() const override
+  {
+    return CurrentDistinctId;
+  }
+
+  virtual FString GetAnonymousId() const override
+  {
+    return TEXT("anonymous");
+  }
+
+  virtual bool IsIdentified() const override
+  {
+    return !CurrentDistinctId.IsEmpty();
+  }
+
+  virtual bool StartTrigger(const FString& RequestId, const FString& EventName, const FNuxieTriggerOptions& Options, FNuxieError& OutError) override
+  {
+    ++StartTriggerCalls;
+    StartedRequestIds.Add(RequestId);
+    return Answer(OutError);
+  }
+
+  virtual bool CancelTrigger(const FString& RequestId, FNuxieError& OutError) override
+  {
+    ++CancelTriggerCalls;
+    CancelledRequestIds.Add(RequestId);
+    return Answer(OutError);
+  }
+
+  virtual bool ShowFlow(const FString& FlowId, FNuxieError& OutError) override
+  {
+    return Answer(OutError);
+  }
+
+  virtual void RefreshProfileAsync(FNuxieProfileSuccessCallback OnSuccess, FNuxieErrorCallback OnError) override
+  {
+    OnSuccess(FNuxieProfileResponse());
+  }
+
+  virtual void HasFeatureAsync(
+    const FString& FeatureId,
+    int32 RequiredBalance,
+    const FString& EntityId,
+    FNuxieFeatureAccessSuccessCallback OnSuccess,
+    FNuxieErrorCallback OnError) override
+  {
+    OnSuccess(CheckResult.Access);
+  }
+
+  virtual void CheckFeatureAsync(
+    const FString& FeatureId,
+    int32 RequiredBalance,
+    const FString& EntityId,
+    bool bForceRefresh,
+    FNuxieFeatureCheckSuccessCallback OnSuccess,
+    FNuxieErrorCallback OnError) override
+  {
+    ++CheckFeatureCalls;
+    FNuxieFeatureCheckResult Result = CheckResult;
+    Result.FeatureId = FeatureId;
+    Result.RequiredBalance = RequiredBalance;
+    if (bHoldChecks)
+    {
+      HeldChecks.Add([Result, OnSuccess = MoveTemp(OnSuccess)]() { OnSuccess(Result); });
+      return;
+    }
+    OnSuccess(Result);
+  }
+
+  void ReleaseChecks()
+  {
+    TArray<TFunction<void()>> Checks = MoveTemp(HeldChecks);
+    for (TFunction<void()>& Check : Checks)
+    {
+      Check();
+    }
+  }
+
+  virtual bool UseFeature(
+    const FString& FeatureId,
+    float Amount,
+    const FString& EntityId,
+    const TMap<FString, FString>& Metadata,
+    FNuxieError& OutError) override
+  {
+    ++UseFeatureCalls;
+    return Answer(OutError);
+  }
+
+  virtual void UseFeatureAndWaitAsync(
+    const FString& FeatureId,
+    float Amount,
+    const FString& EntityId,
+    bool bSetUsage,
+    const TMap<FString, FString>& Metadata,
+    FNuxieFeatureUsageSuccessCallback OnSuccess,
+    FNuxieErrorCallback OnError) override
+  {
+    ++UseFeatureCalls;
+    FNuxieFeatureUsageResult Result;
+    Result.bSuccess = bSucceed;
+    Result.FeatureId = FeatureId;
+    Result.AmountUsed = Amount;
+    OnSuccess(Result);
+  }
+
+  virtual void FlushEventsAsync(FNuxieBoolSuccessCallback OnSuccess, FNuxieErrorCallback OnError) override
+  {
+    ++FlushCalls;
+    OnSuccess(bSucceed);
+  }
+
+  virtual void GetQueuedEventCountAsync(FNuxieIntSuccessCallback OnSuccess, FNuxieErrorCallback OnError) override
+  {
+    OnSuccess(QueuedEventCount);
+  }
+
+  virtual void PauseEventQueueAsync(FSimpleDelegate OnSuccess, FNuxieErrorCallback OnError) override
+  {
+    OnSuccess.ExecuteIfBound();
+  }
+
+  virtual void ResumeEventQueueAsync(FSimpleDelegate OnSuccess, FNuxieErrorCallback OnError) override
+  {
+    OnSuccess.ExecuteIfBound();
+  }
+
+  virtual bool CompletePurchase(const FString& RequestId, const FNuxiePurchaseResult& Result, FNuxieError& OutError) override
+  {
+    return Answer(OutError);
+  }
+
+  virtual bool CompleteRestore(const FString& RequestId, const FNuxieRestoreResult& Result, FNuxieError& OutError) override
+  {
+    return Answer(OutError);
+  }
+
+private:
+  bool Answer(FNuxieError& OutError) const
+  {
+    if (!bSucceed)
+    {
+      OutError = FNuxieError::Make(TEXT("TEST_FAILURE"), TEXT("The test bridge was told to fail."));
+    }
+    return bSucceed;
+  }
+
+  FString CurrentDistinctId;
+};
+
+/** Builds subsystems over an FNuxieTestBridge, outside of any game instance. */
+class FNuxieSubsystemTestAccess
+{
+public:
+  /** A fresh scratch directory for the ledger and the event journal, under Intermediate/. */
+  static FString MakeStateDirectory(const TCHAR* TestName)
+  {
+    const FString Directory = FPaths::ProjectIntermediateDir() / TEXT("NuxieTests") / TestName;
+    IFileManager::Get().DeleteDirectory(*Directory, false, true);
+    return Directory;
+  }
+
+  /** The subsystem is rooted until Destroy. OutBridge stays valid until then as well. */
+  static UNuxieSubsystem* Create(const FString& StateDirectory, FNuxieTestBridge*& OutBridge)
+  {
+    TUniquePtr<FNuxieTestBridge> Bridge = MakeUnique<FNuxieTestBridge>();
+    OutBridge = Bridge.Get();
+    return CreateWith(MoveTemp(Bridge), StateDirectory);
+  }
+
+  /** As Create, over any bridge. */
+  static UNuxieSubsystem* CreateWith(TUniquePtr<INuxiePlatformBridge> Bridge, const FString& StateDirectory)
+  {
+    UNuxieSubsystem* Subsystem = NewObject<UNuxieSubsystem>();
+    Subsystem->AddToRoot();
+    Subsystem->InitializeWith(MoveTemp(Bridge), StateDirectory);
+    return Subsystem;
+  }
+
+  static void Destroy(UNuxieSubsystem* Subsystem)
+  {
+    Subsystem->Deinitialize();
+    Subsystem->RemoveFromRoot();
+  }
+
+  /** Runs the tickers the subsystem registers, without waiting for their interval. */
+  static void TickTriggerTimeouts(UNuxieSubsystem* Subsystem)
+  {
+    Subsystem->TickTriggerTimeouts(0.0f);
+  }
+
+  static void TickRateLimiter(UNuxieSubsystem* Subsystem)
+  {
+    Subsystem->TickRateLimiter(0.0f);
+  }
+
+  static void TickEventJournal(UNuxieSubsystem* Subsystem)
+  {
+    Subsystem->TickEventJournal(0.0f);
+  }
+};
+
+#endif
@@ -0,0 +1,109 @@
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "GenericPlatform/GenericPlatformHttp.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/Guid.h"
+#include "NuxieAllocationCounter.h"
+#include "NuxieRequestIdGenerator.h"
+#include "NuxieTriggerStartEncoder.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+  FNuxieTriggerStartLayoutTest,
+  "Nuxie.TriggerStart.PackedLayout",
+  EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FNuxieTriggerStartLayoutTest::RunTest(const FString& Parameters)
+{
+  FNuxieTriggerOptions Options;
+  Options.UserProperties.Add(TEXT("plan"), TEXT("pro"));
+  FNuxiePropertyBag Properties;
+  Properties.SetInt(TEXT("level"), 12).SetDouble(TEXT("score"), 1.0e20);
+
+  FNuxieTriggerStartEncoder Encoder;
+  Encoder.Encode(TEXT("req_1"), TEXT("level_complete"), Properties, Options);
+
+  // NuxieBridge.startTriggerPacked splits on the two NULs, then decodes the rest as a payload.
+  static constexpr ANSICHAR Expected[] =
+    "req_1\0level_complete\0"
+    "properties=level%3Di12%26score%3Dd1e20"
+    "&user_properties=plan%3Dspro"
+    "&user_properties_set_once=";
+  const TArray<uint8>& Packed = Encoder.GetPacked();
+  TestEqual(TEXT("The packed start has the expected length"), Packed.Num(), int32(UE_ARRAY_COUNT(Expected) - 1));
+  TestTrue(TEXT("The packed start has the expected bytes"), Packed.Num() == UE_ARRAY_COUNT(Expected) - 1 && FMemory::Memcmp(Packed.GetData(), Expected, Packed.Num()) == 0);
+
+  ANSICHAR Number[40];
+  FNuxieTriggerStartEncoder::FormatTaggedDouble(Number, -2.5e-8);
+  TestEqual(TEXT("A negative exponent keeps its sign"), FString(Number), FString(TEXT("d-2.5e-08")));
+  return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+  FNuxieTriggerStartAllocationsTest,
+  "Nuxie.TriggerStart.EncodingAllocatesNothing",
+  EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FNuxieTriggerStartAllocationsTest::RunTest(const FString& Parameters)
+{
+  if (!TestTrue(TEXT("Runs on the game thread"), IsInGameThread()))
+  {
+    return false;
+  }
+
+  // StartTrigger used to format a GUID, build the options payload from temporary strings and maps,
+  // and convert three strings for NewStringUTF. This counts the allocations of both versions.
+  constexpr int32 Count = 10000;
+
+  FNuxieTriggerOptions Options;
+  Options.UserProperties.Add(TEXT("plan"), TEXT("pro"));
+  FNuxiePropertyBag Properties;
+  Properties.SetString(TEXT("source"), TEXT("arena")).SetInt(TEXT("level"), 12).SetDouble(TEXT("score"), 4210.5).SetBool(TEXT("ranked"), true);
+  const FString EventName(TEXT("level_complete"));
+
+  int64 Encoded = 0;
+  const double GuidAndStrings = FNuxieAllocationCounter::CountPerCall(Count, [&]()
+  {
+    const FString RequestId = FGuid::NewGuid().ToString(EGuidFormats::DigitsWithHyphensLower);
+    TMap<FString, FString> Sections;
+    Sections.Add(TEXT("properties"), FGenericPlatformHttp::UrlEncode(FString::Printf(TEXT("level=i%d"), 12)));
+    Sections.Add(TEXT("user_properties"), FGenericPlatformHttp::UrlEncode(TEXT("plan=spro")));
+    FString Payload;
+    for (const TPair<FString, FString>& Pair : Sections)
+    {
+      Payload += Pair.Key + TEXT("=") + Pair.Value;
+    }
+    const FTCHARToUTF8 Request(*RequestId);
+    const FTCHARToUTF8 Event(*EventName);
+    const FTCHARToUTF8 Payload8(*Payload);
+    Encoded += Request.Length() + Event.Length() + Payload8.Length();
+  });
+
+  // One warm-up start grows the encoder's buffers to fit. The request id reserves room for longer
+  // counters up front, since the counter gains digits during the run.
+  FNuxieRequestIdGenerator RequestIds;
+  FNuxieTriggerStartEncoder Encoder;
+  FString RequestId;
+  RequestId.Reserve(64);
+  RequestIds.Next(RequestId);
+  Encoder.Encode(RequestId, EventName, Properties, Options);
+  const double Packed = FNuxieAllocationCounter::CountPerCall(Count, [&]()
+  {
+    RequestIds.Next(RequestId);
+    Encoder.Encode(RequestId, EventName, Properties, Options);
+    Encoded += Encoder.GetPacked().Num();
+  });
+
+  AddInfo(FString::Printf(
+    TEXT("%d calls, allocations per call: GUID and temporary strings %.2f, request id counter and packed buffer %.2f."),
+    Count,
+    GuidAndStrings,
+    Packed));
+
+  TestTrue(TEXT("Every start was encoded"), Encoded > 0);
+  TestEqual(TEXT("A warm encoder allocates nothing per start"), Packed, 0.0);
+  return true;
+}
+
+#endif
@@ -0,0 +1,62 @@
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "Tests/NuxieTestBridge.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+  FNuxieDeferredTriggerTimeoutTest,
+  "Nuxie.Triggers.TimeoutStartsWhenSent",
+  EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FNuxieDeferredTriggerTimeoutTest::RunTest(const FString& Parameters)
+{
+  FNuxieTestBridge* Bridge = nullptr;
+  UNuxieSubsystem* Subsystem = FNuxieSubsystemTestAccess::Create(FNuxieSubsystemTestAccess::MakeStateDirectory(TEXT("TriggerTimeout")), Bridge);
+
+  // One start per 100 ms; later ones wait their turn. Requests time out after 50 ms of silence.
+  FNuxieRateLimitRule Rule;
+  Rule.Target = ENuxieRateLimitTarget::Trigger;
+  Rule.Key = TEXT("boss_defeated");
+  Rule.TokensPerSecond = 10.0f;
+  Rule.Burst = 1;
+  Rule.Policy = ENuxieRateLimitPolicy::Queue;
+
+  FNuxieConfigureOptions Options;
+  Options.ApiKey = TEXT("test");
+  Options.TriggerTimeoutSeconds = 0.05f;
+  Options.RateLimits.Add(Rule);
+  FNuxieError Error;
+  Subsystem->Configure(Options, Error);
+
+  FString SentId;
+  FString DeferredId;
+  Subsystem->StartTrigger(TEXT("boss_defeated"), FNuxieTriggerOptions(), SentId, Error);
+  Subsystem->StartTrigger(TEXT("boss_defeated"), FNuxieTriggerOptions(), DeferredId, Error);
+  TestEqual(TEXT("Only the first start reaches the bridge"), Bridge->StartedRequestIds.Num(), 1);
+  TestEqual(TEXT("Only the sent start is in the registry"), Subsystem->GetActiveTriggerCount(), 1);
+
+  FPlatformProcess::Sleep(0.06f);
+  FNuxieSubsystemTestAccess::TickTriggerTimeouts(Subsystem);
+  TestEqual(TEXT("Only the sent start timed out"), Subsystem->GetTimedOutTriggerCount(), int64(1));
+  TestTrue(TEXT("The sent start is cancelled natively"), Bridge->CancelledRequestIds.Num() == 1 && Bridge->CancelledRequestIds[0] == SentId);
+
+  FPlatformProcess::Sleep(0.1f);
+  FNuxieSubsystemTestAccess::TickRateLimiter(Subsystem);
+  TestTrue(TEXT("The deferred start is sent once a token is free"), Bridge->StartedRequestIds.Num() == 2 && Bridge->StartedRequestIds[1] == DeferredId);
+  TestEqual(TEXT("Its timeout clock starts now"), Subsystem->GetActiveTriggerCount(), 1);
+
+  // Cancelled while waiting: the drain must not send it.
+  FString CancelledId;
+  Subsystem->StartTrigger(TEXT("boss_defeated"), FNuxieTriggerOptions(), CancelledId, Error);
+  Subsystem->CancelTrigger(CancelledId, Error);
+  FPlatformProcess::Sleep(0.1f);
+  FNuxieSubsystemTestAccess::TickRateLimiter(Subsystem);
+  TestFalse(TEXT("A cancelled deferred start never reaches the bridge"), Bridge->StartedRequestIds.Contains(CancelledId));
+
+  FNuxieSubsystemTestAccess::Destroy(Subsystem);
+  return true;
+}
+
+#endif
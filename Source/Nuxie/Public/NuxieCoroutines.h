@@ -0,0 +1,428 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "NuxieSubsystem.h"
+#include "NuxieTypes.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+#include <atomic>
+#include <coroutine>
+
+/**
+ * C++20 coroutine support for the UNuxieSubsystem async APIs.
+ *
+ *   FNuxieCoroutine UnlockFlow(UNuxieSubsystem* Nuxie)
+ *   {
+ *     TNuxieAsyncResult<FNuxieProfileResponse> Profile = co_await FNuxieRefreshProfileAwaitable(Nuxie);
+ *     auto [Pro, Hints] = co_await NuxieWhenAll(
+ *       FNuxieCheckFeatureAwaitable(Nuxie, TEXT("pro")),
+ *       FNuxieCheckFeatureAwaitable(Nuxie, TEXT("hints")));
+ *     ...
+ *   }
+ *
+ * Awaiter state lives in the coroutine frame. Callbacks handed to the subsystem capture only
+ * references into that frame. The subsystem API takes TFunctions, which store any capture on the
+ * heap, so each operation still allocates for its two callbacks, the subsystem's own wrappers and
+ * the resume task; the awaiter adds nothing beyond the frame. Completion resumes on the game
+ * thread unless the awaitable is given another policy via ResumeOn(). A call that completes before
+ * it suspends continues inline without a round trip through the task graph. A call whose callbacks
+ * are destroyed without being called, as when the subsystem is torn down mid-flight, completes with
+ * an error instead of leaving the coroutine suspended.
+ */
+
+template <typename T>
+struct TNuxieAsyncResult
+{
+  TOptional<T> Value;
+  FNuxieError Error;
+
+  bool IsOk() const
+  {
+    return Value.IsSet();
+  }
+
+  const T& GetValue() const
+  {
+    return Value.GetValue();
+  }
+};
+
+class INuxieAwaitContinuation
+{
+public:
+  virtual ~INuxieAwaitContinuation() = default;
+
+  /** Called exactly once per started operation, from any thread. */
+  virtual void Continue() = 0;
+};
+
+namespace NuxieCoroutines
+{
+  NUXIE_API void Resume(const FNuxieDeliveryPolicy& Delivery, std::coroutine_handle<> Handle);
+  NUXIE_API FNuxieError MakeSubsystemUnavailableError();
+  NUXIE_API FNuxieError MakeDroppedError();
+}
+
+/**
+ * Completion state of one started operation, stored in the awaiter. Each callback handed to the
+ * subsystem holds an FNuxieAwaitSinkRef to it. The continuation runs once the last reference is
+ * gone, so no callback can touch the frame after the coroutine resumes; if none of them called
+ * Complete, the operation's error is set first.
+ */
+class FNuxieAwaitSlot
+{
+public:
+  FNuxieAwaitSlot() = default;
+  FNuxieAwaitSlot(const FNuxieAwaitSlot&) = delete;
+  FNuxieAwaitSlot& operator=(const FNuxieAwaitSlot&) = delete;
+
+  /** Takes one reference that End drops, so the callbacks can be built and handed over first. */
+  void Begin(INuxieAwaitContinuation& InContinuation, FNuxieError& InError)
+  {
+    Continuation = &InContinuation;
+    Error = &InError;
+    bCompleted.store(false);
+    RefCount.store(1);
+  }
+
+  void End()
+  {
+    Release();
+  }
+
+  /** Call after writing the value or error; the continuation follows when the callbacks are released. */
+  void Complete()
+  {
+    bCompleted.store(true);
+  }
+
+private:
+  friend class FNuxieAwaitSinkRef;
+
+  void AddRef()
+  {
+    RefCount.fetch_add(1);
+  }
+
+  void Release()
+  {
+    if (RefCount.fetch_sub(1) != 1)
+    {
+      return;
+    }
+
+    if (!bCompleted.load())
+    {
+      *Error = NuxieCoroutines::MakeDroppedError();
+    }
+    Continuation->Continue();
+  }
+
+  INuxieAwaitContinuation* Continuation = nullptr;
+  FNuxieError* Error = nullptr;
+  std::atomic<int32> RefCount { 0 };
+  std::atomic<bool> bCompleted { false };
+};
+
+/** Copyable reference from a subsystem callback to its FNuxieAwaitSlot; lives in the callback's capture. */
+class FNuxieAwaitSinkRef
+{
+public:
+  explicit FNuxieAwaitSinkRef(FNuxieAwaitSlot& InSlot)
+    : Slot(&InSlot)
+  {
+    Slot->AddRef();
+  }
+
+  FNuxieAwaitSinkRef(const FNuxieAwaitSinkRef& Other)
+    : Slot(Other.Slot)
+  {
+    Slot->AddRef();
+  }
+
+  FNuxieAwaitSinkRef(FNuxieAwaitSinkRef&& Other)
+    : Slot(Other.Slot)
+  {
+    Other.Slot = nullptr;
+  }
+
+  FNuxieAwaitSinkRef& operator=(const FNuxieAwaitSinkRef&) = delete;
+  FNuxieAwaitSinkRef& operator=(FNuxieAwaitSinkRef&&) = delete;
+
+  ~FNuxieAwaitSinkRef()
+  {
+    if (Slot != nullptr)
+    {
+      Slot->Release();
+    }
+  }
+
+  void Complete() const
+  {
+    Slot->Complete();
+  }
+
+private:
+  FNuxieAwaitSlot* Slot;
+};
+
+/** Fire-and-forget coroutine return type. Starts eagerly and frees its frame when it finishes. */
+struct FNuxieCoroutine
+{
+  struct promise_type
+  {
+    FNuxieCoroutine get_return_object()
+    {
+      return FNuxieCoroutine();
+    }
+
+    std::suspend_never initial_suspend() noexcept
+    {
+      return {};
+    }
+
+    std::suspend_never final_suspend() noexcept
+    {
+      return {};
+    }
+
+    void return_void()
+    {
+    }
+
+    void unhandled_exception()
+    {
+      checkNoEntry();
+    }
+  };
+};
+
+/**
+ * Base for single-operation awaitables. DerivedType provides
+ * `void Start(TNuxieAsyncResult<T>& OutResult, FNuxieAwaitSlot& Slot)`, which must not touch the
+ * awaitable after handing its callbacks to the subsystem.
+ */
+template <typename DerivedType, typename T>
+class TNuxieAwaitable : private INuxieAwaitContinuation
+{
+public:
+  using ValueType = T;
+
+  TNuxieAwaitable() = default;
+
+  /** Awaitables may be moved (e.g. into NuxieWhenAll) until they are awaited. */
+  TNuxieAwaitable(TNuxieAwaitable&& Other)
+    : Delivery(Other.Delivery)
+    , Result(MoveTemp(Other.Result))
+  {
+  }
+
+  /** Selects the thread the coroutine resumes on, e.g. `co_await FNuxieCheckFeatureAwaitable(...).ResumeOn(...)`. */
+  DerivedType&& ResumeOn(const FNuxieDeliveryPolicy& InDelivery) &&
+  {
+    Delivery = InDelivery;
+    return MoveTemp(static_cast<DerivedType&>(*this));
+  }
+
+  bool await_ready() const
+  {
+    return false;
+  }
+
+  bool await_suspend(std::coroutine_handle<> InHandle)
+  {
+    Handle = InHandle;
+    Slot.Begin(*this, Result.Error);
+    static_cast<DerivedType*>(this)->Start(Result, Slot);
+    Slot.End();
+
+    // Completed while starting: keep running on this thread instead of suspending.
+    return State.exchange(EState::Suspended) != EState::Completed;
+  }
+
+  TNuxieAsyncResult<T> await_resume()
+  {
+    return MoveTemp(Result);
+  }
+
+private:
+  enum class EState : uint8
+  {
+    Starting,
+    Suspended,
+    Completed
+  };
+
+  virtual void Continue() override
+  {
+    if (State.exchange(EState::Completed) == EState::Suspended)
+    {
+      NuxieCoroutines::Resume(Delivery, Handle);
+    }
+  }
+
+  FNuxieDeliveryPolicy Delivery;
+  std::coroutine_handle<> Handle;
+  std::atomic<EState> State { EState::Starting };
+  TNuxieAsyncResult<T> Result;
+  FNuxieAwaitSlot Slot;
+};
+
+class NUXIE_API FNuxieRefreshProfileAwaitable : public TNuxieAwaitable<FNuxieRefreshProfileAwaitable, FNuxieProfileResponse>
+{
+public:
+  explicit FNuxieRefreshProfileAwaitable(UNuxieSubsystem* InSubsystem);
+
+  void Start(TNuxieAsyncResult<FNuxieProfileResponse>& OutResult, FNuxieAwaitSlot& Slot);
+
+private:
+  TWeakObjectPtr<UNuxieSubsystem> Subsystem;
+};
+
+class NUXIE_API FNuxieHasFeatureAwaitable : public TNuxieAwaitable<FNuxieHasFeatureAwaitable, FNuxieFeatureAccess>
+{
+public:
+  FNuxieHasFeatureAwaitable(UNuxieSubsystem* InSubsystem, FString InFeatureId, int32 InRequiredBalance = 1, FString InEntityId = FString());
+
+  void Start(TNuxieAsyncResult<FNuxieFeatureAccess>& OutResult, FNuxieAwaitSlot& Slot);
+
+private:
+  TWeakObjectPtr<UNuxieSubsystem> Subsystem;
+  FString FeatureId;
+  int32 RequiredBalance = 1;
+  FString EntityId;
+};
+
+class NUXIE_API FNuxieCheckFeatureAwaitable : public TNuxieAwaitable<FNuxieCheckFeatureAwaitable, FNuxieFeatureCheckResult>
+{
+public:
+  FNuxieCheckFeatureAwaitable(
+    UNuxieSubsystem* InSubsystem,
+    FString InFeatureId,
+    int32 InRequiredBalance = 1,
+    FString InEntityId = FString(),
+    bool bInForceRefresh = false);
+
+  void Start(TNuxieAsyncResult<FNuxieFeatureCheckResult>& OutResult, FNuxieAwaitSlot& Slot);
+
+private:
+  TWeakObjectPtr<UNuxieSubsystem> Subsystem;
+  FString FeatureId;
+  int32 RequiredBalance = 1;
+  FString EntityId;
+  bool bForceRefresh = false;
+};
+
+class NUXIE_API FNuxieUseFeatureAndWaitAwaitable : public TNuxieAwaitable<FNuxieUseFeatureAndWaitAwaitable, FNuxieFeatureUsageResult>
+{
+public:
+  FNuxieUseFeatureAndWaitAwaitable(
+    UNuxieSubsystem* InSubsystem,
+    FString InFeatureId,
+    float InAmount = 1.0f,
+    FString InEntityId = FString(),
+    bool bInSetUsage = false,
+    TMap<FString, FString> InMetadata = TMap<FString, FString>());
+
+  void Start(TNuxieAsyncResult<FNuxieFeatureUsageResult>& OutResult, FNuxieAwaitSlot& Slot);
+
+private:
+  TWeakObjectPtr<UNuxieSubsystem> Subsystem;
+  FString FeatureId;
+  float Amount = 1.0f;
+  FString EntityId;
+  bool bSetUsage = false;
+  TMap<FString, FString> Metadata;
+};
+
+class NUXIE_API FNuxieFlushEventsAwaitable : public TNuxieAwaitable<FNuxieFlushEventsAwaitable, bool>
+{
+public:
+  explicit FNuxieFlushEventsAwaitable(UNuxieSubsystem* InSubsystem);
+
+  void Start(TNuxieAsyncResult<bool>& OutResult, FNuxieAwaitSlot& Slot);
+
+private:
+  TWeakObjectPtr<UNuxieSubsystem> Subsystem;
+};
+
+class NUXIE_API FNuxieQueuedEventCountAwaitable : public TNuxieAwaitable<FNuxieQueuedEventCountAwaitable, int32>
+{
+public:
+  explicit FNuxieQueuedEventCountAwaitable(UNuxieSubsystem* InSubsystem);
+
+  void Start(TNuxieAsyncResult<int32>& OutResult, FNuxieAwaitSlot& Slot);
+
+private:
+  TWeakObjectPtr<UNuxieSubsystem> Subsystem;
+};
+
+/** Starts every operation at once and resumes after the last one completes. */
+template <typename... AwaitableTypes>
+class TNuxieWhenAll : private INuxieAwaitContinuation
+{
+public:
+  using ResultType = TTuple<TNuxieAsyncResult<typename AwaitableTypes::ValueType>...>;
+
+  explicit TNuxieWhenAll(AwaitableTypes... InOperations)
+    : Operations(MoveTemp(InOperations)...)
+  {
+  }
+
+  TNuxieWhenAll&& ResumeOn(const FNuxieDeliveryPolicy& InDelivery) &&
+  {
+    Delivery = InDelivery;
+    return MoveTemp(*this);
+  }
+
+  bool await_ready() const
+  {
+    return false;
+  }
+
+  bool await_suspend(std::coroutine_handle<> InHandle)
+  {
+    Handle = InHandle;
+
+    // One extra count keeps operations that complete while starting from resuming the coroutine early.
+    Remaining.store(sizeof...(AwaitableTypes) + 1);
+    int32 Index = 0;
+    VisitTupleElements([this, &Index](auto& Operation, auto& Result)
+    {
+      FNuxieAwaitSlot& Slot = Slots[Index++];
+      Slot.Begin(*this, Result.Error);
+      Operation.Start(Result, Slot);
+      Slot.End();
+    }, Operations, Results);
+
+    return Remaining.fetch_sub(1) != 1;
+  }
+
+  ResultType await_resume()
+  {
+    return MoveTemp(Results);
+  }
+
+private:
+  virtual void Continue() override
+  {
+    if (Remaining.fetch_sub(1) == 1)
+    {
+      NuxieCoroutines::Resume(Delivery, Handle);
+    }
+  }
+
+  FNuxieDeliveryPolicy Delivery;
+  TTuple<AwaitableTypes...> Operations;
+  ResultType Results;
+  FNuxieAwaitSlot Slots[sizeof...(AwaitableTypes)];
+  std::coroutine_handle<> Handle;
+  std::atomic<int32> Remaining { 0 };
+};
+
+template <typename... AwaitableTypes>
+TNuxieWhenAll<AwaitableTypes...> NuxieWhenAll(AwaitableTypes... Operations)
+{
+  return TNuxieWhenAll<AwaitableTypes...>(MoveTemp(Operations)...);
+}
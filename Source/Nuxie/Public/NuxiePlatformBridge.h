@@ -2,6 +2,8 @@
 
 #include "CoreMinimal.h"
 
+#include "Async/TaskGraphInterfaces.h"
+#include "NuxiePropertyBag.h"
 #include "NuxieTypes.h"
 
 using FNuxieErrorCallback = TFunction<void(const FNuxieError&)>;
@@ -12,6 +14,43 @@ using FNuxieFeatureUsageSuccessCallback = TFunction<void(const FNuxieFeatureUsag
 using FNuxieBoolSuccessCallback = TFunction<void(bool)>;
 using FNuxieIntSuccessCallback = TFunction<void(int32)>;
 
+enum class ENuxieDeliveryMode : uint8
+{
+  /** Callback runs on the game thread (inline when the result is already there). */
+  GameThread,
+  /** Callback runs inline on whichever thread produced the result. */
+  AnyThread,
+  /** Callback is queued to NamedThread on the task graph. */
+  NamedThread
+};
+
+/** Where an async API invokes its success/error callback. Defaults to the game thread. */
+struct FNuxieDeliveryPolicy
+{
+  ENuxieDeliveryMode Mode = ENuxieDeliveryMode::GameThread;
+  ENamedThreads::Type NamedThread = ENamedThreads::AnyBackgroundThreadNormalTask;
+
+  static FNuxieDeliveryPolicy GameThread()
+  {
+    return FNuxieDeliveryPolicy();
+  }
+
+  static FNuxieDeliveryPolicy AnyThread()
+  {
+    FNuxieDeliveryPolicy Policy;
+    Policy.Mode = ENuxieDeliveryMode::AnyThread;
+    return Policy;
+  }
+
+  static FNuxieDeliveryPolicy OnNamedThread(ENamedThreads::Type InNamedThread)
+  {
+    FNuxieDeliveryPolicy Policy;
+    Policy.Mode = ENuxieDeliveryMode::NamedThread;
+    Policy.NamedThread = InNamedThread;
+    return Policy;
+  }
+};
+
 class INuxiePlatformBridgeListener
 {
 public:
@@ -19,12 +58,30 @@ public:
 
   virtual void OnTriggerUpdate(const FString& RequestId, const FNuxieTriggerUpdate& Update) = 0;
   virtual void OnFeatureAccessChanged(const FString& FeatureId, const FNuxieFeatureAccess& Previous, const FNuxieFeatureAccess& Current) = 0;
+
+  /** All changes observed in one dispatch window (typically one profile sync). */
+  virtual void OnFeatureAccessBatchChanged(const TArray<FNuxieFeatureAccessChange>& Changes)
+  {
+    for (const FNuxieFeatureAccessChange& Change : Changes)
+    {
+      OnFeatureAccessChanged(Change.FeatureId, Change.Previous, Change.Current);
+    }
+  }
+
   virtual void OnPurchaseRequest(const FNuxiePurchaseRequest& Request) = 0;
   virtual void OnRestoreRequest(const FNuxieRestoreRequest& Request) = 0;
   virtual void OnFlowPresented(const FString& FlowId) = 0;
   virtual void OnFlowDismissed(const FString& FlowId) = 0;
 };
 
+/**
+ * Async methods may invoke their callbacks on any thread. The subsystem applies the caller's
+ * FNuxieDeliveryPolicy on top, so bridges must not hop to the game thread themselves.
+ *
+ * The subsystem sends properties and metadata as FNuxiePropertyBag. The bag overloads default to
+ * formatting the bag into the TMap<FString, FString> overloads; bridges that can pass typed values
+ * to their SDK override both.
+ */
 class INuxiePlatformBridge
 {
 public:
@@ -35,12 +92,24 @@ public:
   virtual bool Configure(const FNuxieConfigureOptions& Options, FNuxieError& OutError) = 0;
   virtual bool Shutdown(FNuxieError& OutError) = 0;
 
+  /** Applies queue and network settings to the running native SDK without reconfiguring it. */
+  virtual bool UpdateRuntimeOptions(const FNuxieRuntimeOptions& Options, FNuxieError& OutError) = 0;
+
   virtual bool Identify(
     const FString& DistinctId,
     const TMap<FString, FString>& UserProperties,
     const TMap<FString, FString>& UserPropertiesSetOnce,
     FNuxieError& OutError) = 0;
 
+  virtual bool Identify(
+    const FString& DistinctId,
+    FNuxiePropertyBag&& UserProperties,
+    FNuxiePropertyBag&& UserPropertiesSetOnce,
+    FNuxieError& OutError)
+  {
+    return Identify(DistinctId, UserProperties.ToStringMap(), UserPropertiesSetOnce.ToStringMap(), OutError);
+  }
+
   virtual bool Reset(bool bKeepAnonymousId, FNuxieError& OutError) = 0;
 
   virtual FString GetDistinctId() const = 0;
@@ -53,6 +122,19 @@ public:
     const FNuxieTriggerOptions& Options,
     FNuxieError& OutError) = 0;
 
+  /** Properties replaces Options.Properties, which is ignored. */
+  virtual bool StartTrigger(
+    const FString& RequestId,
+    const FString& EventName,
+    FNuxiePropertyBag&& Properties,
+    const FNuxieTriggerOptions& Options,
+    FNuxieError& OutError)
+  {
+    FNuxieTriggerOptions MapOptions = Options;
+    MapOptions.Properties = Properties.ToStringMap();
+    return StartTrigger(RequestId, EventName, MapOptions, OutError);
+  }
+
   virtual bool CancelTrigger(const FString& RequestId, FNuxieError& OutError) = 0;
 
   virtual bool ShowFlow(const FString& FlowId, FNuxieError& OutError) = 0;
@@ -81,6 +163,16 @@ public:
     const TMap<FString, FString>& Metadata,
     FNuxieError& OutError) = 0;
 
+  virtual bool UseFeature(
+    const FString& FeatureId,
+    float Amount,
+    const FString& EntityId,
+    FNuxiePropertyBag&& Metadata,
+    FNuxieError& OutError)
+  {
+    return UseFeature(FeatureId, Amount, EntityId, Metadata.ToStringMap(), OutError);
+  }
+
   virtual void UseFeatureAndWaitAsync(
     const FString& FeatureId,
     float Amount,
@@ -90,6 +182,18 @@ public:
     FNuxieFeatureUsageSuccessCallback OnSuccess,
     FNuxieErrorCallback OnError) = 0;
 
+  virtual void UseFeatureAndWaitAsync(
+    const FString& FeatureId,
+    float Amount,
+    const FString& EntityId,
+    bool bSetUsage,
+    FNuxiePropertyBag&& Metadata,
+    FNuxieFeatureUsageSuccessCallback OnSuccess,
+    FNuxieErrorCallback OnError)
+  {
+    UseFeatureAndWaitAsync(FeatureId, Amount, EntityId, bSetUsage, Metadata.ToStringMap(), MoveTemp(OnSuccess), MoveTemp(OnError));
+  }
+
   virtual void FlushEventsAsync(FNuxieBoolSuccessCallback OnSuccess, FNuxieErrorCallback OnError) = 0;
   virtual void GetQueuedEventCountAsync(FNuxieIntSuccessCallback OnSuccess, FNuxieErrorCallback OnError) = 0;
   virtual void PauseEventQueueAsync(FSimpleDelegate OnSuccess, FNuxieErrorCallback OnError) = 0;
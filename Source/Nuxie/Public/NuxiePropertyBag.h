@@ -0,0 +1,113 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+enum class ENuxiePropertyType : uint8
+{
+  Int,
+  Double,
+  Bool,
+  String
+};
+
+/**
+ * Typed event properties, user properties or usage metadata, stored in one flat buffer.
+ *
+ * Up to InlineBytes of entries live inside the bag itself, so a handful of properties needs no heap
+ * allocation and no hashing. Values keep their type all the way to the native SDK instead of being
+ * formatted into strings and parsed back. Setting a key again replaces its value; keys are
+ * case-sensitive and lookups are linear, which suits the dozen or so entries a call carries.
+ * Move-only: pass it with MoveTemp, or Clone it explicitly.
+ */
+class NUXIE_API FNuxiePropertyBag
+{
+public:
+  static constexpr int32 InlineBytes = 256;
+
+  /** One entry; Key and String point into the bag and are valid until it is next modified. */
+  struct FProperty
+  {
+    ENuxiePropertyType Type = ENuxiePropertyType::String;
+    FStringView Key;
+    int64 Int = 0;
+    double Double = 0.0;
+    bool bBool = false;
+    FStringView String;
+
+    /** The value as the string-map overloads would have sent it. */
+    FString ValueToString() const;
+  };
+
+  class NUXIE_API FConstIterator
+  {
+  public:
+    FConstIterator(const FNuxiePropertyBag& InBag, int32 InWordIndex);
+
+    FProperty operator*() const;
+    FConstIterator& operator++();
+    bool operator!=(const FConstIterator& Other) const;
+
+  private:
+    const FNuxiePropertyBag& Bag;
+    int32 WordIndex = 0;
+  };
+
+  FNuxiePropertyBag() = default;
+  /** Leaves Other empty; a defaulted move would empty Words but keep the count. */
+  FNuxiePropertyBag(FNuxiePropertyBag&& Other);
+  FNuxiePropertyBag& operator=(FNuxiePropertyBag&& Other);
+  FNuxiePropertyBag(const FNuxiePropertyBag&) = delete;
+  FNuxiePropertyBag& operator=(const FNuxiePropertyBag&) = delete;
+
+  /** Adapter for the TMap<FString, FString> overloads; every value becomes a String entry. */
+  static FNuxiePropertyBag FromStringMap(const TMap<FString, FString>& Values);
+
+  FNuxiePropertyBag Clone() const;
+
+  FNuxiePropertyBag& SetInt(FStringView Key, int64 Value);
+  FNuxiePropertyBag& SetDouble(FStringView Key, double Value);
+  FNuxiePropertyBag& SetBool(FStringView Key, bool Value);
+  FNuxiePropertyBag& SetString(FStringView Key, FStringView Value);
+
+  /** Copies one entry of another bag, replacing the value under the same key. */
+  void Set(const FProperty& Property);
+
+  /** Copies the entries of Other whose keys this bag does not have yet. */
+  void AppendMissing(const FNuxiePropertyBag& Other);
+
+  bool Remove(FStringView Key);
+  bool Contains(FStringView Key) const;
+  bool Find(FStringView Key, FProperty& OutProperty) const;
+
+  int32 Num() const;
+  bool IsEmpty() const;
+  void Reset();
+
+  /** Adapter for bridges and code that still take TMap<FString, FString>; see FProperty::ValueToString. */
+  void ToStringMap(TMap<FString, FString>& OutValues) const;
+  TMap<FString, FString> ToStringMap() const;
+
+  FConstIterator begin() const;
+  FConstIterator end() const;
+
+private:
+  // Each entry is a header, the key and the value, padded to whole words so that the key and
+  // string characters and the 64-bit values stay aligned.
+  struct FEntryHeader
+  {
+    ENuxiePropertyType Type;
+    uint8 Padding;
+    uint16 KeyLength;
+    uint32 ValueBytes;
+  };
+
+  static_assert(sizeof(FEntryHeader) == sizeof(uint64), "Entry headers must fill exactly one word.");
+
+  static int32 GetEntryWords(const FEntryHeader& Header);
+  FProperty ReadEntry(int32 WordIndex, int32* OutNumWords = nullptr) const;
+  int32 FindEntry(FStringView Key) const;
+  void AppendEntry(ENuxiePropertyType Type, FStringView Key, const void* Value, int32 ValueBytes);
+
+  TArray<uint64, TInlineAllocator<InlineBytes / sizeof(uint64)>> Words;
+  int32 NumProperties = 0;
+};
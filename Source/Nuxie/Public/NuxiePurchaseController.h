@@ -6,6 +6,8 @@
 #include "NuxieTypes.h"
 #include "NuxiePurchaseController.generated.h"
 
+class FNuxiePurchaseTracker;
+
 UINTERFACE(BlueprintType)
 class NUXIE_API UNuxiePurchaseController : public UInterface
 {
@@ -23,3 +25,64 @@ public:
   UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = "Nuxie|Purchases")
   FNuxieRestoreResult OnRestoreRequested(const FNuxieRestoreRequest& Request);
 };
+
+/**
+ * Completes one purchase request of an INuxieAsyncPurchaseController. Copies refer to the same
+ * request and only the first Complete counts. Complete may be called from any thread; the result
+ * reaches the platform SDK from the game thread.
+ */
+USTRUCT(BlueprintType)
+struct NUXIE_API FNuxiePurchaseCompletion
+{
+  GENERATED_BODY()
+
+  UPROPERTY(BlueprintReadOnly, Category = "Nuxie|Purchases")
+  FString RequestId;
+
+  /** Returns false when the request was already completed or has expired, or its subsystem is gone. */
+  bool Complete(const FNuxiePurchaseResult& Result) const;
+  bool IsPending() const;
+
+  TSharedPtr<FNuxiePurchaseTracker, ESPMode::ThreadSafe> Tracker;
+};
+
+/** FNuxiePurchaseCompletion for restore requests. */
+USTRUCT(BlueprintType)
+struct NUXIE_API FNuxieRestoreCompletion
+{
+  GENERATED_BODY()
+
+  UPROPERTY(BlueprintReadOnly, Category = "Nuxie|Purchases")
+  FString RequestId;
+
+  /** Returns false when the request was already completed or has expired, or its subsystem is gone. */
+  bool Complete(const FNuxieRestoreResult& Result) const;
+  bool IsPending() const;
+
+  TSharedPtr<FNuxiePurchaseTracker, ESPMode::ThreadSafe> Tracker;
+};
+
+UINTERFACE(BlueprintType)
+class NUXIE_API UNuxieAsyncPurchaseController : public UInterface
+{
+  GENERATED_BODY()
+};
+
+/**
+ * Purchase controller for store flows that take seconds. The request is handed over with a
+ * completion handle and the call returns at once; keep the handle and complete it when the store
+ * answers, from any thread. Requests not completed before the platform SDK gives up (60 seconds on
+ * Android) fail natively with a timeout; their handles expire just before that, and Complete
+ * returns false.
+ */
+class NUXIE_API INuxieAsyncPurchaseController
+{
+  GENERATED_BODY()
+
+public:
+  UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = "Nuxie|Purchases")
+  void OnPurchaseRequestedAsync(const FNuxiePurchaseRequest& Request, const FNuxiePurchaseCompletion& Completion);
+
+  UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = "Nuxie|Purchases")
+  void OnRestoreRequestedAsync(const FNuxieRestoreRequest& Request, const FNuxieRestoreCompletion& Completion);
+};
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Containers/Ticker.h"
 #include "Subsystems/GameInstanceSubsystem.h"
 
 #include "NuxiePlatformBridge.h"
@@ -10,12 +11,25 @@
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FNuxieTriggerUpdateEvent, const FString&, RequestId, const FNuxieTriggerUpdate&, Update);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FNuxieFeatureAccessChangedEvent, const FString&, FeatureId, const FNuxieFeatureAccess&, PreviousAccess, const FNuxieFeatureAccess&, CurrentAccess);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FNuxieFeatureAccessBatchChangedEvent, const TArray<FNuxieFeatureAccessChange>&, Changes);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_FourParams(FNuxieFeatureBalanceCorrectedEvent, const FString&, FeatureId, const FString&, EntityId, int32, ProjectedBalance, int32, CorrectedBalance);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FNuxieEventsFlushedEvent, const FNuxieFlushReport&, Report);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FNuxiePurchaseRequestEvent, const FNuxiePurchaseRequest&, Request);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FNuxieRestoreRequestEvent, const FNuxieRestoreRequest&, Request);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FNuxieFlowPresentedEvent, const FString&, FlowId);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FNuxieFlowDismissedEvent, const FString&, FlowId);
 
 DECLARE_MULTICAST_DELEGATE_TwoParams(FNuxieTriggerUpdateNativeEvent, const FString&, const FNuxieTriggerUpdate&);
+DECLARE_MULTICAST_DELEGATE_ThreeParams(FNuxieFeatureAccessChangedNativeEvent, const FString&, const FNuxieFeatureAccess&, const FNuxieFeatureAccess&);
+DECLARE_MULTICAST_DELEGATE_OneParam(FNuxieFeatureAccessBatchChangedNativeEvent, const TArray<FNuxieFeatureAccessChange>&);
+DECLARE_MULTICAST_DELEGATE(FNuxieFeatureStateReloadedNativeEvent);
+DECLARE_MULTICAST_DELEGATE_FourParams(FNuxieFeatureBalanceCorrectedNativeEvent, const FString&, const FString&, int32, int32);
+DECLARE_MULTICAST_DELEGATE_OneParam(FNuxieEventsFlushedNativeEvent, const FNuxieFlushReport&);
+DECLARE_MULTICAST_DELEGATE_OneParam(FNuxiePurchaseRequestNativeEvent, const FNuxiePurchaseRequest&);
+DECLARE_MULTICAST_DELEGATE_OneParam(FNuxieRestoreRequestNativeEvent, const FNuxieRestoreRequest&);
+DECLARE_MULTICAST_DELEGATE_OneParam(FNuxieFlowNativeEvent, const FString&);
+
+DECLARE_DELEGATE_ThreeParams(FNuxieFeatureAccessChangedDelegate, const FString&, const FNuxieFeatureAccess&, const FNuxieFeatureAccess&);
 
 UCLASS()
 class NUXIE_API UNuxieSubsystem : public UGameInstanceSubsystem
@@ -33,6 +47,25 @@ public:
   UFUNCTION(BlueprintCallable, Category = "Nuxie")
   bool Shutdown(FNuxieError& OutError);
 
+  /**
+   * Changes queue and network settings of the running session without a Shutdown/Configure cycle.
+   * A nuxie.* console variable set to zero or more overrides the matching field.
+   */
+  UFUNCTION(BlueprintCallable, Category = "Nuxie")
+  bool UpdateRuntimeOptions(const FNuxieRuntimeOptions& Options, FNuxieError& OutError);
+
+  /** The configured or last updated options with console variable overrides applied. */
+  UFUNCTION(BlueprintPure, Category = "Nuxie")
+  FNuxieRuntimeOptions GetRuntimeOptions() const;
+
+  /** Sends the runtime options again, e.g. after a nuxie.* console variable changed. */
+  bool ReapplyRuntimeOptions(FNuxieError& OutError);
+
+  /**
+   * Sends only the properties that changed since the last call for DistinctId, and set-once keys
+   * not sent before. Calls for the current distinct ID are merged and sent once per frame; a call
+   * that changes nothing is suppressed. Switching distinct ID is sent right away.
+   */
   UFUNCTION(BlueprintCallable, Category = "Nuxie")
   bool Identify(
     const FString& DistinctId,
@@ -40,6 +73,17 @@ public:
     const TMap<FString, FString>& UserPropertiesSetOnce,
     FNuxieError& OutError);
 
+  /** Identify with typed values; the TMap overload above sends every value as a string. */
+  bool Identify(
+    const FString& DistinctId,
+    FNuxiePropertyBag&& UserProperties,
+    FNuxiePropertyBag&& UserPropertiesSetOnce,
+    FNuxieError& OutError);
+
+  /** Number of Identify calls that changed no property and were not sent. */
+  UFUNCTION(BlueprintPure, Category = "Nuxie")
+  int64 GetSuppressedIdentifyCount() const;
+
   UFUNCTION(BlueprintCallable, Category = "Nuxie")
   bool Reset(bool bKeepAnonymousId, FNuxieError& OutError);
 
@@ -59,6 +103,33 @@ public:
     FString& OutRequestId,
     FNuxieError& OutError);
 
+  /** StartTrigger with typed event properties, sent in place of Options.Properties. */
+  bool StartTrigger(
+    const FString& EventName,
+    FNuxiePropertyBag&& Properties,
+    const FNuxieTriggerOptions& Options,
+    FString& OutRequestId,
+    FNuxieError& OutError);
+
+  /** Number of StartTrigger calls resolved from the campaign event index without a bridge call. */
+  UFUNCTION(BlueprintPure, Category = "Nuxie")
+  int64 GetTriggersResolvedLocally() const;
+
+  /** Number of StartTrigger calls attached to an in-flight request by FNuxieTriggerOptions::DebounceWindowSeconds. */
+  UFUNCTION(BlueprintPure, Category = "Nuxie")
+  int64 GetCoalescedTriggerCount() const;
+
+  /** Trigger requests started through this subsystem that have not reached a terminal update. */
+  UFUNCTION(BlueprintPure, Category = "Nuxie")
+  int32 GetActiveTriggerCount() const;
+
+  /** Number of trigger requests ended by FNuxieConfigureOptions::TriggerTimeoutSeconds. */
+  UFUNCTION(BlueprintPure, Category = "Nuxie")
+  int64 GetTimedOutTriggerCount() const;
+
+  /** Writes every active trigger request with its age, last update and memory to Ar (`nuxie.ListTriggers`). */
+  void DumpActiveTriggers(FOutputDevice& Ar) const;
+
   UFUNCTION(BlueprintCallable, Category = "Nuxie")
   bool CancelTrigger(const FString& RequestId, FNuxieError& OutError);
 
@@ -73,6 +144,18 @@ public:
     const TMap<FString, FString>& Metadata,
     FNuxieError& OutError);
 
+  /** UseFeature with typed metadata. The event journal keeps the values as strings. */
+  bool UseFeature(
+    const FString& FeatureId,
+    float Amount,
+    const FString& EntityId,
+    FNuxiePropertyBag&& Metadata,
+    FNuxieError& OutError);
+
+  /** Calls governed by FNuxieConfigureOptions::RateLimits; calls without a matching rule are not counted. */
+  UFUNCTION(BlueprintPure, Category = "Nuxie")
+  FNuxieRateLimitStats GetRateLimitStats() const;
+
   UFUNCTION(BlueprintCallable, Category = "Nuxie")
   bool CompletePurchase(const FString& RequestId, const FNuxiePurchaseResult& Result, FNuxieError& OutError);
 
@@ -82,35 +165,202 @@ public:
   UFUNCTION(BlueprintCallable, Category = "Nuxie")
   void SetPurchaseController(const TScriptInterface<INuxiePurchaseController>& Controller);
 
+  /** Takes precedence over the synchronous controller while set; pass null to clear it. */
+  UFUNCTION(BlueprintCallable, Category = "Nuxie")
+  void SetAsyncPurchaseController(const TScriptInterface<INuxieAsyncPurchaseController>& Controller);
+
+  /** Time from a purchase request reaching the game to its completion, over this session. */
+  UFUNCTION(BlueprintPure, Category = "Nuxie")
+  FNuxiePurchaseLatencyStats GetPurchaseLatency() const;
+
+  UFUNCTION(BlueprintPure, Category = "Nuxie")
+  FNuxiePurchaseLatencyStats GetRestoreLatency() const;
+
   UFUNCTION(BlueprintPure, Category = "Nuxie")
   bool GetIsConfigured() const;
 
-  void RefreshProfileAsync(FNuxieProfileSuccessCallback OnSuccess, FNuxieErrorCallback OnError);
+  // Async results are delivered on the game thread unless Delivery says otherwise. Callers on
+  // worker threads that don't need the game thread can pass FNuxieDeliveryPolicy::AnyThread().
+  void RefreshProfileAsync(
+    FNuxieProfileSuccessCallback OnSuccess,
+    FNuxieErrorCallback OnError,
+    const FNuxieDeliveryPolicy& Delivery = FNuxieDeliveryPolicy());
   void HasFeatureAsync(
     const FString& FeatureId,
     int32 RequiredBalance,
     const FString& EntityId,
     FNuxieFeatureAccessSuccessCallback OnSuccess,
-    FNuxieErrorCallback OnError);
+    FNuxieErrorCallback OnError,
+    const FNuxieDeliveryPolicy& Delivery = FNuxieDeliveryPolicy());
   void CheckFeatureAsync(
     const FString& FeatureId,
     int32 RequiredBalance,
     const FString& EntityId,
     bool bForceRefresh,
     FNuxieFeatureCheckSuccessCallback OnSuccess,
-    FNuxieErrorCallback OnError);
+    FNuxieErrorCallback OnError,
+    const FNuxieDeliveryPolicy& Delivery = FNuxieDeliveryPolicy());
+
+  /**
+   * Answers from the subsystem-side cache when the last native answer is within
+   * CachePolicy.MaxAgeSeconds. Within the following StaleWhileRevalidateSeconds it still answers
+   * from the cache, and also refreshes in the background; a changed value is then announced through
+   * OnFeatureAccessChanged and the feature subscriptions for EntityId. Older or missing entries are
+   * fetched natively.
+   */
+  void CheckFeatureAsync(
+    const FString& FeatureId,
+    int32 RequiredBalance,
+    const FString& EntityId,
+    const FNuxieFeatureCachePolicy& CachePolicy,
+    FNuxieFeatureCheckSuccessCallback OnSuccess,
+    FNuxieErrorCallback OnError,
+    const FNuxieDeliveryPolicy& Delivery = FNuxieDeliveryPolicy());
+
+  /**
+   * The same-frame half of the CachePolicy CheckFeatureAsync: returns true and fills OutResult when
+   * the cache can answer under CachePolicy, and starts the background refresh for a stale answer.
+   * Returns false where CheckFeatureAsync would ask the platform SDK.
+   */
+  bool TryGetCachedFeatureCheck(
+    const FString& FeatureId,
+    int32 RequiredBalance,
+    const FString& EntityId,
+    const FNuxieFeatureCachePolicy& CachePolicy,
+    FNuxieFeatureCheckResult& OutResult);
+
+  /**
+   * Asks the platform SDK for an answer that is not known locally yet, without a callback: it
+   * reaches EvaluateFeatureAccess and the feature subscriptions. Requests for the same feature,
+   * required balance and entity share one bridge call while it is in flight, so any number of
+   * feature gates waiting on one feature cost a single check.
+   */
+  void RequestFeatureAccess(const FString& FeatureId, int32 RequiredBalance, const FString& EntityId);
+  void UseFeatureAndWaitAsync(
+    const FString& FeatureId,
+    float Amount,
+    const FString& EntityId,
+    bool bSetUsage,
+    const TMap<FString, FString>& Metadata,
+    FNuxieFeatureUsageSuccessCallback OnSuccess,
+    FNuxieErrorCallback OnError,
+    const FNuxieDeliveryPolicy& Delivery = FNuxieDeliveryPolicy());
   void UseFeatureAndWaitAsync(
     const FString& FeatureId,
     float Amount,
     const FString& EntityId,
     bool bSetUsage,
+    FNuxiePropertyBag&& Metadata,
+    FNuxieFeatureUsageSuccessCallback OnSuccess,
+    FNuxieErrorCallback OnError,
+    const FNuxieDeliveryPolicy& Delivery = FNuxieDeliveryPolicy());
+
+  /**
+   * Optimistic UseFeatureAndWaitAsync for metered and credit-system features. Deducts Amount from a
+   * local balance ledger and returns the projected result in the same frame; UsageRemaining is set
+   * when a balance is known locally. A projected shortfall is returned unsubmitted and reported
+   * through OnError with INSUFFICIENT_BALANCE. When the server result or a pushed access change moves
+   * the projected balance, OnFeatureBalanceCorrected fires. Unconfirmed uses survive a restart as
+   * projections but are not resubmitted. Game thread only.
+   */
+  FNuxieFeatureUsageResult UseFeatureOptimistic(
+    const FString& FeatureId,
+    float Amount,
+    const FString& EntityId,
     const TMap<FString, FString>& Metadata,
     FNuxieFeatureUsageSuccessCallback OnSuccess,
-    FNuxieErrorCallback OnError);
-  void FlushEventsAsync(FNuxieBoolSuccessCallback OnSuccess, FNuxieErrorCallback OnError);
-  void GetQueuedEventCountAsync(FNuxieIntSuccessCallback OnSuccess, FNuxieErrorCallback OnError);
-  void PauseEventQueueAsync(FSimpleDelegate OnSuccess, FNuxieErrorCallback OnError);
-  void ResumeEventQueueAsync(FSimpleDelegate OnSuccess, FNuxieErrorCallback OnError);
+    FNuxieErrorCallback OnError,
+    const FNuxieDeliveryPolicy& Delivery = FNuxieDeliveryPolicy());
+
+  /** Known balance minus optimistic uses the server has not confirmed yet. Game thread only. */
+  bool GetProjectedFeatureBalance(const FString& FeatureId, const FString& EntityId, int32& OutBalance) const;
+
+  /** UseFeature calls in the event journal (FNuxieConfigureOptions::bEnableEventJournal) not yet known to be sent. */
+  UFUNCTION(BlueprintPure, Category = "Nuxie")
+  int32 GetJournaledEventCount() const;
+
+  /** UseFeature calls recovered from the journal of an earlier run and sent again at Configure. */
+  UFUNCTION(BlueprintPure, Category = "Nuxie")
+  int64 GetReplayedEventCount() const;
+
+  void FlushEventsAsync(
+    FNuxieBoolSuccessCallback OnSuccess,
+    FNuxieErrorCallback OnError,
+    const FNuxieDeliveryPolicy& Delivery = FNuxieDeliveryPolicy());
+  void GetQueuedEventCountAsync(
+    FNuxieIntSuccessCallback OnSuccess,
+    FNuxieErrorCallback OnError,
+    const FNuxieDeliveryPolicy& Delivery = FNuxieDeliveryPolicy());
+  void PauseEventQueueAsync(
+    FSimpleDelegate OnSuccess,
+    FNuxieErrorCallback OnError,
+    const FNuxieDeliveryPolicy& Delivery = FNuxieDeliveryPolicy());
+  void ResumeEventQueueAsync(
+    FSimpleDelegate OnSuccess,
+    FNuxieErrorCallback OnError,
+    const FNuxieDeliveryPolicy& Delivery = FNuxieDeliveryPolicy());
+
+  /**
+   * Pauses the native event queue while gameplay is critical (e.g. a ranked match). Calls nest:
+   * the queue resumes and flushes in one burst when the last true is matched by a false. Going to
+   * the background or terminating still flushes. Prefer FNuxieGameplayCriticalScope in C++.
+   */
+  UFUNCTION(BlueprintCallable, Category = "Nuxie")
+  void SetGameplayCritical(bool bCritical);
+
+  UFUNCTION(BlueprintPure, Category = "Nuxie")
+  bool IsGameplayCritical() const;
+
+  /** Flushes now unless gameplay is critical, e.g. on a loading screen or results screen. */
+  UFUNCTION(BlueprintCallable, Category = "Nuxie")
+  void MarkFlushSafePoint();
+
+  UFUNCTION(BlueprintPure, Category = "Nuxie")
+  FNuxieFlushReport GetLastFlushReport() const;
+
+  /**
+   * Answers HasFeature on the game thread from state the SDK already delivered (profile snapshot,
+   * earlier check results and pushed access changes) without crossing the bridge. Returns false
+   * when the answer is not known locally; ask CheckFeatureAsync in that case.
+   * IDs match case-sensitively. An FName only carries the case it was first created with outside
+   * the editor, so use the FString overload for IDs that differ only by case.
+   */
+  bool EvaluateFeatureAccess(FName FeatureId, int32 RequiredBalance, FName EntityId, FNuxieFeatureAccess& OutAccess) const;
+  bool EvaluateFeatureAccess(const FString& FeatureId, int32 RequiredBalance, const FString& EntityId, FNuxieFeatureAccess& OutAccess) const;
+
+  /**
+   * Non-blocking, lock-free variants of UseFeature / StartTrigger / Identify that may be called from
+   * any thread. Calls are queued and executed in order by a single bridge worker; submissions from
+   * one thread keep their relative order. They are not ordered against the synchronous methods
+   * above. A rejected SubmitStartTrigger ends its request id with a terminal Error update; other
+   * submission errors are dropped. The rvalue overloads move their arguments into the queue; the
+   * others copy them. Once Deinitialize has started they reject the call: false, or an empty
+   * request id.
+   */
+  bool SubmitUseFeature(const FString& FeatureId, float Amount, const FString& EntityId, const TMap<FString, FString>& Metadata);
+  bool SubmitUseFeature(const FString& FeatureId, float Amount, const FString& EntityId, FNuxiePropertyBag&& Metadata);
+  FString SubmitStartTrigger(const FString& EventName, const FNuxieTriggerOptions& Options);
+  FString SubmitStartTrigger(const FString& EventName, FNuxiePropertyBag&& Properties, FNuxieTriggerOptions&& Options);
+  bool SubmitIdentify(
+    const FString& DistinctId,
+    const TMap<FString, FString>& UserProperties,
+    const TMap<FString, FString>& UserPropertiesSetOnce);
+  bool SubmitIdentify(
+    const FString& DistinctId,
+    FNuxiePropertyBag&& UserProperties,
+    FNuxiePropertyBag&& UserPropertiesSetOnce);
+  int32 GetPendingSubmissionCount() const;
+
+  /**
+   * Subscribes to access changes of a single feature. An empty EntityId receives every change for
+   * the feature. Callbacks bound with CreateUObject / CreateWeakLambda are removed automatically
+   * once their owner is destroyed; others must be released with UnsubscribeFeature. IDs match
+   * case-sensitively, with the same FName caveat as EvaluateFeatureAccess.
+   */
+  FDelegateHandle SubscribeFeature(FName FeatureId, FName EntityId, FNuxieFeatureAccessChangedDelegate Callback);
+  FDelegateHandle SubscribeFeature(const FString& FeatureId, const FString& EntityId, FNuxieFeatureAccessChangedDelegate Callback);
+  bool UnsubscribeFeature(FDelegateHandle Handle);
+  void UnsubscribeAllFeatures(const void* UserObject);
 
   UPROPERTY(BlueprintAssignable, Category = "Nuxie|Events")
   FNuxieTriggerUpdateEvent OnTriggerUpdate;
@@ -120,26 +370,132 @@ public:
   UPROPERTY(BlueprintAssignable, Category = "Nuxie|Events")
   FNuxieFeatureAccessChangedEvent OnFeatureAccessChanged;
 
+  FNuxieFeatureAccessChangedNativeEvent OnFeatureAccessChangedNative;
+
+  /** Fires once per sync with every feature whose access changed, after the per-feature events. */
+  UPROPERTY(BlueprintAssignable, Category = "Nuxie|Events")
+  FNuxieFeatureAccessBatchChangedEvent OnFeatureAccessBatchChanged;
+
+  FNuxieFeatureAccessBatchChangedNativeEvent OnFeatureAccessBatchChangedNative;
+
+  /** Fires when reconciliation moves a balance projected by UseFeatureOptimistic. */
+  UPROPERTY(BlueprintAssignable, Category = "Nuxie|Events")
+  FNuxieFeatureBalanceCorrectedEvent OnFeatureBalanceCorrected;
+
+  FNuxieFeatureBalanceCorrectedNativeEvent OnFeatureBalanceCorrectedNative;
+
+  /**
+   * Fires on the game thread when the feature state behind EvaluateFeatureAccess is replaced as a
+   * whole: a profile snapshot loaded, Identify switched distinct ID, or Reset. Single features that
+   * change are announced through feature subscriptions instead.
+   */
+  FNuxieFeatureStateReloadedNativeEvent OnFeatureStateReloadedNative;
+
+  /** Fires when a flush started by the scheduler (safe point, background, terminate) completes. */
+  UPROPERTY(BlueprintAssignable, Category = "Nuxie|Events")
+  FNuxieEventsFlushedEvent OnEventsFlushed;
+
+  FNuxieEventsFlushedNativeEvent OnEventsFlushedNative;
+
   UPROPERTY(BlueprintAssignable, Category = "Nuxie|Events")
   FNuxiePurchaseRequestEvent OnPurchaseRequest;
 
+  FNuxiePurchaseRequestNativeEvent OnPurchaseRequestNative;
+
   UPROPERTY(BlueprintAssignable, Category = "Nuxie|Events")
   FNuxieRestoreRequestEvent OnRestoreRequest;
 
+  FNuxieRestoreRequestNativeEvent OnRestoreRequestNative;
+
   UPROPERTY(BlueprintAssignable, Category = "Nuxie|Events")
   FNuxieFlowPresentedEvent OnFlowPresented;
 
+  FNuxieFlowNativeEvent OnFlowPresentedNative;
+
   UPROPERTY(BlueprintAssignable, Category = "Nuxie|Events")
   FNuxieFlowDismissedEvent OnFlowDismissed;
 
+  FNuxieFlowNativeEvent OnFlowDismissedNative;
+
 private:
   friend class FNuxieBridgeListener;
+  friend class FNuxieSubsystemTestAccess;
 
+  /** Initialize with an explicit bridge, and the directory that holds the ledger and the event journal. */
+  void InitializeWith(TUniquePtr<INuxiePlatformBridge> InBridge, const FString& StateDirectory);
   bool EnsureBridge(FNuxieError& OutError) const;
+  void RevalidateFeature(const FString& FeatureId, int32 RequiredBalance, const FString& EntityId);
+
+  /**
+   * Records a changed answer for FeatureId (and EntityId, empty for the feature itself) in the
+   * evaluator and the ledger, then announces it. The check cache is updated by the caller.
+   */
+  void ApplyFeatureAccessChange(const FNuxieFeatureAccessChange& Change, const FString& EntityId);
+
+  /**
+   * Records an answer the caller asked for in the evaluator, on the game thread. When it differs
+   * from what the evaluator answered for RequiredBalance before, or nothing was known, the feature
+   * subscriptions are called; OnFeatureAccessChanged stays reserved for pushed changes.
+   */
+  static void RecordFeatureAccess(
+    TWeakObjectPtr<UNuxieSubsystem> WeakThis,
+    const FString& FeatureId,
+    int32 RequiredBalance,
+    const FString& EntityId,
+    const FNuxieFeatureAccess& Access);
+  void ResolveTriggerLocally(const FString& RequestId);
+  void EndTriggerWithError(const FString& RequestId, const FNuxieError& Error);
+  bool TickTriggerTimeouts(float DeltaTime);
+  void ScheduleRateLimitDrain();
+  bool TickRateLimiter(float DeltaTime);
+  bool TickEventJournal(float DeltaTime);
+  TOptional<int32> GetKnownBalance(const FString& FeatureId, const FString& EntityId) const;
+  void ReconcileBalance(const FString& FeatureId, const FString& EntityId, TFunctionRef<void()> Apply);
+  void ReplayEventJournal();
+  void FlushPendingIdentify();
 
   TUniquePtr<INuxiePlatformBridge> Bridge;
   bool bIsConfigured = false;
+  bool bSkipUnmatchedTriggers = false;
+  int64 TriggersResolvedLocally = 0;
+  float TriggerTimeoutSeconds = 900.0f;
+  int64 TriggersTimedOut = 0;
+  int64 JournalEventsReplayed = 0;
+  FNuxieRuntimeOptions RuntimeOptions;
+  FTSTicker::FDelegateHandle TriggerTimeoutTicker;
+  FTSTicker::FDelegateHandle RateLimitDrainTicker;
+  FTSTicker::FDelegateHandle IdentifyFlushTicker;
+  FTSTicker::FDelegateHandle EventJournalTicker;
   TScriptInterface<INuxiePurchaseController> PurchaseController;
+  TScriptInterface<INuxieAsyncPurchaseController> AsyncPurchaseController;
 
   class FNuxieBridgeListener* BridgeListener = nullptr;
+  class FNuxieFeatureSubscriptionIndex* FeatureSubscriptions = nullptr;
+  class FNuxieEntitlementEvaluator* EntitlementEvaluator = nullptr;
+  class FNuxieBalanceLedger* BalanceLedger = nullptr;
+  class FNuxieCampaignEventIndex* CampaignEventIndex = nullptr;
+  class FNuxieTriggerDebouncer* TriggerDebouncer = nullptr;
+  class FNuxieTriggerRegistry* TriggerRegistry = nullptr;
+  class FNuxieRateLimiter* RateLimiter = nullptr;
+  class FNuxieIdentifyDiffer* IdentifyDiffer = nullptr;
+  TSharedPtr<class FNuxieFlushScheduler> FlushScheduler;
+  TSharedPtr<class FNuxieSubmissionQueue, ESPMode::ThreadSafe> SubmissionQueue;
+  TSharedPtr<class FNuxieRequestIdGenerator, ESPMode::ThreadSafe> RequestIds;
+  TSharedPtr<class FNuxieFeatureCheckCache, ESPMode::ThreadSafe> FeatureCheckCache;
+  TSharedPtr<class FNuxieEventJournal, ESPMode::ThreadSafe> EventJournal;
+  TSharedPtr<class FNuxiePurchaseTracker, ESPMode::ThreadSafe> PurchaseTracker;
+};
+
+/** Keeps the event queue paused for its lifetime; see UNuxieSubsystem::SetGameplayCritical. */
+class NUXIE_API FNuxieGameplayCriticalScope
+{
+public:
+  explicit FNuxieGameplayCriticalScope(UNuxieSubsystem* InSubsystem);
+  ~FNuxieGameplayCriticalScope();
+
+  FNuxieGameplayCriticalScope(const FNuxieGameplayCriticalScope&) = delete;
+  FNuxieGameplayCriticalScope& operator=(const FNuxieGameplayCriticalScope&) = delete;
+
+private:
+  TWeakObjectPtr<UNuxieSubsystem> Subsystem;
 };
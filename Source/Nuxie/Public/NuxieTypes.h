@@ -98,6 +98,14 @@ enum class ENuxieFeatureType : uint8
   CreditSystem,
 };
 
+UENUM(BlueprintType)
+enum class ENuxieFeatureResultSource : uint8
+{
+  Native,
+  Cache,
+  StaleCache,
+};
+
 UENUM(BlueprintType)
 enum class ENuxiePurchaseResultKind : uint8
 {
@@ -115,6 +123,29 @@ enum class ENuxieRestoreResultKind : uint8
   Failed,
 };
 
+UENUM(BlueprintType)
+enum class ENuxieRateLimitTarget : uint8
+{
+  Trigger,
+  Feature,
+};
+
+UENUM(BlueprintType)
+enum class ENuxieRateLimitPolicy : uint8
+{
+  Drop,
+  Queue,
+  Coalesce,
+};
+
+UENUM(BlueprintType)
+enum class ENuxieFlushReason : uint8
+{
+  SafePoint,
+  Background,
+  Terminate,
+};
+
 USTRUCT(BlueprintType)
 struct NUXIE_API FNuxieError
 {
@@ -138,6 +169,82 @@ struct NUXIE_API FNuxieError
   }
 };
 
+/**
+ * Token bucket for StartTrigger (keyed by event name) or UseFeature (keyed by feature id). Key "*"
+ * is a single shared bucket for every key of that target without a rule of its own.
+ */
+USTRUCT(BlueprintType)
+struct NUXIE_API FNuxieRateLimitRule
+{
+  GENERATED_BODY()
+
+  UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Nuxie")
+  ENuxieRateLimitTarget Target = ENuxieRateLimitTarget::Trigger;
+
+  UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Nuxie")
+  FString Key;
+
+  UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Nuxie", meta = (ClampMin = "0.0"))
+  float TokensPerSecond = 1.0f;
+
+  UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Nuxie", meta = (ClampMin = "1"))
+  int32 Burst = 1;
+
+  /** What happens to a call that finds the bucket empty. */
+  UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Nuxie")
+  ENuxieRateLimitPolicy Policy = ENuxieRateLimitPolicy::Drop;
+
+  /** Queue and Coalesce drop calls beyond this many waiting ones. */
+  UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Nuxie", meta = (ClampMin = "0"))
+  int32 MaxDeferred = 64;
+
+  /** A rule that holds calls back needs a refill rate, or they would wait forever. */
+  bool IsValid() const
+  {
+    return TokensPerSecond > 0.0f || Policy == ENuxieRateLimitPolicy::Drop;
+  }
+};
+
+USTRUCT(BlueprintType)
+struct NUXIE_API FNuxieRateLimitStats
+{
+  GENERATED_BODY()
+
+  UPROPERTY(BlueprintReadOnly, Category = "Nuxie")
+  int64 Admitted = 0;
+
+  UPROPERTY(BlueprintReadOnly, Category = "Nuxie")
+  int64 Dropped = 0;
+
+  /** Queued or coalesced into a waiting call. */
+  UPROPERTY(BlueprintReadOnly, Category = "Nuxie")
+  int64 Deferred = 0;
+};
+
+USTRUCT(BlueprintType)
+struct NUXIE_API FNuxieFlushReport
+{
+  GENERATED_BODY()
+
+  UPROPERTY(BlueprintReadOnly, Category = "Nuxie")
+  ENuxieFlushReason Reason = ENuxieFlushReason::SafePoint;
+
+  UPROPERTY(BlueprintReadOnly, Category = "Nuxie")
+  bool bSuccess = false;
+
+  /** From the flush call to its completion. */
+  UPROPERTY(BlueprintReadOnly, Category = "Nuxie")
+  float LatencyMs = 0.0f;
+
+  /** Events queued when the flush started; -1 when the flush could not wait to ask (lifecycle flushes). */
+  UPROPERTY(BlueprintReadOnly, Category = "Nuxie")
+  int32 EventCount = -1;
+
+  /** Estimated from EventCount; the native SDKs do not report payload sizes. */
+  UPROPERTY(BlueprintReadOnly, Category = "Nuxie")
+  int64 ApproxBytes = 0;
+};
+
 USTRUCT(BlueprintType)
 struct NUXIE_API FNuxieConfigureOptions
 {
@@ -205,6 +312,97 @@ struct NUXIE_API FNuxieConfigureOptions
 
   UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Nuxie")
   bool bUsePurchaseController = false;
+
+  /**
+   * Resolves StartTrigger locally with a terminal NoMatch when the campaigns in the last profile
+   * snapshot cannot match the event. Such events never reach the native SDK and are not tracked.
+   */
+  UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Nuxie")
+  bool bSkipUnmatchedTriggers = false;
+
+  /**
+   * Trigger requests with no update for this long are ended with a synthetic terminal Error
+   * (code TRIGGER_TIMEOUT) and cancelled natively. Zero disables the timeout.
+   */
+  UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Nuxie", meta = (ClampMin = "0.0"))
+  float TriggerTimeoutSeconds = 900.0f;
+
+  /**
+   * Journals UseFeature calls under Saved/Nuxie/Journal until a flush confirms them, and replays
+   * any a crash left behind at the next Configure. Delivery becomes at-least-once: a use the native
+   * SDK had already persisted before the crash is sent again.
+   */
+  UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Nuxie")
+  bool bEnableEventJournal = false;
+
+  /**
+   * Client-side rate limits for StartTrigger and UseFeature. They are merged over the
+   * `+RateLimits=(...)` entries of `[/Script/Nuxie.NuxieSubsystem]` in the game ini; a rule here
+   * replaces an ini rule with the same Target and Key.
+   */
+  UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Nuxie")
+  TArray<FNuxieRateLimitRule> RateLimits;
+};
+
+/**
+ * Queue and network settings that can change while a session is running. Configure seeds them from
+ * FNuxieConfigureOptions; UNuxieSubsystem::UpdateRuntimeOptions and the nuxie.* console variables
+ * change them later without a Shutdown/Configure cycle.
+ */
+USTRUCT(BlueprintType)
+struct NUXIE_API FNuxieRuntimeOptions
+{
+  GENERATED_BODY()
+
+  UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Nuxie", meta = (ClampMin = "1"))
+  int32 EventBatchSize = 50;
+
+  UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Nuxie", meta = (ClampMin = "1"))
+  int32 FlushAt = 20;
+
+  UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Nuxie", meta = (ClampMin = "1"))
+  int32 FlushIntervalSeconds = 30;
+
+  UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Nuxie", meta = (ClampMin = "1"))
+  int32 MaxQueueSize = 1000;
+
+  UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Nuxie", meta = (ClampMin = "0"))
+  int32 RetryCount = 3;
+
+  UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Nuxie", meta = (ClampMin = "1"))
+  int32 RequestTimeoutSeconds = 30;
+
+  static FNuxieRuntimeOptions FromConfigureOptions(const FNuxieConfigureOptions& Options)
+  {
+    FNuxieRuntimeOptions Runtime;
+    Runtime.EventBatchSize = Options.EventBatchSize;
+    Runtime.FlushAt = Options.FlushAt;
+    Runtime.FlushIntervalSeconds = Options.FlushIntervalSeconds;
+    Runtime.MaxQueueSize = Options.MaxQueueSize;
+    Runtime.RetryCount = Options.RetryCount;
+    Runtime.RequestTimeoutSeconds = Options.RequestTimeoutSeconds;
+    return Runtime;
+  }
+
+  void ApplyTo(FNuxieConfigureOptions& Options) const
+  {
+    Options.EventBatchSize = EventBatchSize;
+    Options.FlushAt = FlushAt;
+    Options.FlushIntervalSeconds = FlushIntervalSeconds;
+    Options.MaxQueueSize = MaxQueueSize;
+    Options.RetryCount = RetryCount;
+    Options.RequestTimeoutSeconds = RequestTimeoutSeconds;
+  }
+
+  bool IsValid() const
+  {
+    return EventBatchSize > 0
+      && FlushAt > 0
+      && FlushIntervalSeconds > 0
+      && MaxQueueSize > 0
+      && RetryCount >= 0
+      && RequestTimeoutSeconds > 0;
+  }
 };
 
 USTRUCT(BlueprintType)
@@ -220,6 +418,14 @@ struct NUXIE_API FNuxieTriggerOptions
 
   UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Nuxie")
   TMap<FString, FString> UserPropertiesSetOnce;
+
+  /**
+   * When above zero, starts of the same event within this many seconds of an in-flight request
+   * (one without a terminal update yet) return that request id instead of starting a new one. The
+   * later calls' properties are not sent.
+   */
+  UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Nuxie", meta = (ClampMin = "0.0"))
+  float DebounceWindowSeconds = 0.0f;
 };
 
 USTRUCT(BlueprintType)
@@ -330,6 +536,21 @@ struct NUXIE_API FNuxieFeatureAccess
   ENuxieFeatureType Type = ENuxieFeatureType::Boolean;
 };
 
+USTRUCT(BlueprintType)
+struct NUXIE_API FNuxieFeatureAccessChange
+{
+  GENERATED_BODY()
+
+  UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Nuxie")
+  FString FeatureId;
+
+  UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Nuxie")
+  FNuxieFeatureAccess Previous;
+
+  UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Nuxie")
+  FNuxieFeatureAccess Current;
+};
+
 USTRUCT(BlueprintType)
 struct NUXIE_API FNuxieFeatureCheckResult
 {
@@ -352,6 +573,28 @@ struct NUXIE_API FNuxieFeatureCheckResult
 
   UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Nuxie")
   FString PreviewJson;
+
+  /** Where this answer came from. Native results are fetched from the platform SDK for this call. */
+  UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Nuxie")
+  ENuxieFeatureResultSource Source = ENuxieFeatureResultSource::Native;
+
+  /** Seconds since the answer was fetched from the platform SDK. */
+  UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Nuxie")
+  float AgeSeconds = 0.0f;
+};
+
+USTRUCT(BlueprintType)
+struct NUXIE_API FNuxieFeatureCachePolicy
+{
+  GENERATED_BODY()
+
+  /** Cached answers younger than this are returned without calling the platform SDK. */
+  UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Nuxie")
+  float MaxAgeSeconds = 0.0f;
+
+  /** Past MaxAgeSeconds, a cached answer is still returned for this long while a refresh runs in the background. */
+  UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Nuxie")
+  float StaleWhileRevalidateSeconds = 0.0f;
 };
 
 USTRUCT(BlueprintType)
@@ -501,6 +744,29 @@ struct NUXIE_API FNuxieRestoreResult
   FString Message;
 };
 
+/** Time from a purchase or restore request reaching the game to its completion. */
+USTRUCT(BlueprintType)
+struct NUXIE_API FNuxiePurchaseLatencyStats
+{
+  GENERATED_BODY()
+
+  UPROPERTY(BlueprintReadOnly, Category = "Nuxie")
+  int64 Completed = 0;
+
+  /** Requests delivered and not completed yet. */
+  UPROPERTY(BlueprintReadOnly, Category = "Nuxie")
+  int32 Pending = 0;
+
+  UPROPERTY(BlueprintReadOnly, Category = "Nuxie")
+  float LastLatencyMs = 0.0f;
+
+  UPROPERTY(BlueprintReadOnly, Category = "Nuxie")
+  float AverageLatencyMs = 0.0f;
+
+  UPROPERTY(BlueprintReadOnly, Category = "Nuxie")
+  float MaxLatencyMs = 0.0f;
+};
+
 namespace Nuxie
 {
   struct NUXIE_API FTriggerContract
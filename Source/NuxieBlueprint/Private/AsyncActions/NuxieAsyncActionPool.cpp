@@ -0,0 +1,93 @@
+#include "AsyncActions/NuxieAsyncActionPool.h"
+
+#include "AsyncActions/NuxieCheckFeatureAsyncAction.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+
+UNuxieAsyncActionPool* UNuxieAsyncActionPool::Get(const UObject* WorldContextObject)
+{
+  if (WorldContextObject == nullptr || GEngine == nullptr)
+  {
+    return nullptr;
+  }
+
+  UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
+  if (World == nullptr || World->GetGameInstance() == nullptr)
+  {
+    return nullptr;
+  }
+
+  return World->GetGameInstance()->GetSubsystem<UNuxieAsyncActionPool>();
+}
+
+void UNuxieAsyncActionPool::Deinitialize()
+{
+  FreeCheckFeatureActions.Reset();
+  ActiveActions.Reset();
+  Super::Deinitialize();
+}
+
+template <typename ActionType>
+ActionType* UNuxieAsyncActionPool::Acquire(TArray<TObjectPtr<ActionType>>& FreeActions)
+{
+  check(IsInGameThread());
+
+  ActionType* Action = nullptr;
+  if (FreeActions.Num() > 0)
+  {
+    Action = FreeActions.Pop();
+    ++ReusedCount;
+  }
+  else
+  {
+    Action = NewObject<ActionType>(this);
+    ++CreatedCount;
+  }
+
+  Action->Pool = this;
+  ActiveActions.Add(Action);
+  return Action;
+}
+
+template <typename ActionType>
+void UNuxieAsyncActionPool::Release(ActionType* Action, TArray<TObjectPtr<ActionType>>& FreeActions)
+{
+  check(IsInGameThread());
+
+  // An action that already finished must not be pooled twice.
+  if (Action == nullptr || ActiveActions.Remove(Action) == 0)
+  {
+    return;
+  }
+
+  Action->ResetForReuse();
+  if (FreeActions.Num() < MaxFreeActions)
+  {
+    FreeActions.Add(Action);
+  }
+}
+
+UNuxieCheckFeatureAsyncAction* UNuxieAsyncActionPool::AcquireCheckFeatureAction()
+{
+  return Acquire(FreeCheckFeatureActions);
+}
+
+void UNuxieAsyncActionPool::Release(UNuxieCheckFeatureAsyncAction* Action)
+{
+  Release(Action, FreeCheckFeatureActions);
+}
+
+int64 UNuxieAsyncActionPool::GetCreatedActionCount() const
+{
+  return CreatedCount;
+}
+
+int64 UNuxieAsyncActionPool::GetReusedActionCount() const
+{
+  return ReusedCount;
+}
+
+int32 UNuxieAsyncActionPool::GetActiveActionCount() const
+{
+  return ActiveActions.Num();
+}
@@ -1,5 +1,6 @@
 #include "AsyncActions/NuxieCheckFeatureAsyncAction.h"
 
+#include "AsyncActions/NuxieAsyncActionPool.h"
 #include "Engine/Engine.h"
 #include "Engine/GameInstance.h"
 #include "NuxieSubsystem.h"
@@ -11,12 +12,14 @@ UNuxieCheckFeatureAsyncAction* UNuxieCheckFeatureAsyncAction::CheckNuxieFeature(
   const FString& EntityIdIn,
   bool bForceRefreshIn)
 {
-  UNuxieCheckFeatureAsyncAction* Action = NewObject<UNuxieCheckFeatureAsyncAction>();
+  UNuxieAsyncActionPool* Pool = UNuxieAsyncActionPool::Get(WorldContextObjectIn);
+  UNuxieCheckFeatureAsyncAction* Action = Pool != nullptr ? Pool->AcquireCheckFeatureAction() : NewObject<UNuxieCheckFeatureAsyncAction>();
   Action->WorldContextObject = WorldContextObjectIn;
   Action->FeatureId = FeatureIdIn;
   Action->RequiredBalance = RequiredBalanceIn;
   Action->EntityId = EntityIdIn;
   Action->bForceRefresh = bForceRefreshIn;
+  Action->bInUse = true;
   return Action;
 }
 
@@ -24,51 +27,86 @@ void UNuxieCheckFeatureAsyncAction::Activate()
 {
   if (WorldContextObject == nullptr)
   {
-    OnFailed.Broadcast(FNuxieError::Make(TEXT("NO_WORLD_CONTEXT"), TEXT("World context object is required.")));
-    SetReadyToDestroy();
+    Fail(FNuxieError::Make(TEXT("NO_WORLD_CONTEXT"), TEXT("World context object is required.")));
     return;
   }
 
   UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
   if (World == nullptr || World->GetGameInstance() == nullptr)
   {
-    OnFailed.Broadcast(FNuxieError::Make(TEXT("NO_GAME_INSTANCE"), TEXT("Unable to resolve game instance.")));
-    SetReadyToDestroy();
+    Fail(FNuxieError::Make(TEXT("NO_GAME_INSTANCE"), TEXT("Unable to resolve game instance.")));
     return;
   }
 
   UNuxieSubsystem* Subsystem = World->GetGameInstance()->GetSubsystem<UNuxieSubsystem>();
   if (Subsystem == nullptr)
   {
-    OnFailed.Broadcast(FNuxieError::Make(TEXT("NO_SUBSYSTEM"), TEXT("Nuxie subsystem is unavailable.")));
-    SetReadyToDestroy();
+    Fail(FNuxieError::Make(TEXT("NO_SUBSYSTEM"), TEXT("Nuxie subsystem is unavailable.")));
     return;
   }
 
   TWeakObjectPtr<UNuxieCheckFeatureAsyncAction> WeakThis(this);
+  const uint32 CheckGeneration = Generation;
   Subsystem->CheckFeatureAsync(
     FeatureId,
     RequiredBalance,
     EntityId,
     bForceRefresh,
-    [WeakThis](const FNuxieFeatureCheckResult& Result)
+    [WeakThis, CheckGeneration](const FNuxieFeatureCheckResult& Result)
     {
-      if (!WeakThis.IsValid())
+      if (!WeakThis.IsValid() || WeakThis->Generation != CheckGeneration)
       {
         return;
       }
 
       WeakThis->OnSuccess.Broadcast(Result);
-      WeakThis->SetReadyToDestroy();
+      if (WeakThis.IsValid())
+      {
+        WeakThis->Finish(CheckGeneration);
+      }
     },
-    [WeakThis](const FNuxieError& Error)
+    [WeakThis, CheckGeneration](const FNuxieError& Error)
     {
-      if (!WeakThis.IsValid())
+      if (!WeakThis.IsValid() || WeakThis->Generation != CheckGeneration)
       {
         return;
       }
 
-      WeakThis->OnFailed.Broadcast(Error);
-      WeakThis->SetReadyToDestroy();
+      WeakThis->Fail(Error);
     });
 }
+
+void UNuxieCheckFeatureAsyncAction::Fail(const FNuxieError& Error)
+{
+  const uint32 UseGeneration = Generation;
+  OnFailed.Broadcast(Error);
+  Finish(UseGeneration);
+}
+
+void UNuxieCheckFeatureAsyncAction::Finish(uint32 UseGeneration)
+{
+  // A handler may have ended this use already, and a new node may have taken the action since.
+  if (!bInUse || UseGeneration != Generation)
+  {
+    return;
+  }
+
+  bInUse = false;
+  ++Generation;
+  SetReadyToDestroy();
+  if (UNuxieAsyncActionPool* OwningPool = Pool.Get())
+  {
+    OwningPool->Release(this);
+  }
+}
+
+void UNuxieCheckFeatureAsyncAction::ResetForReuse()
+{
+  OnSuccess.Clear();
+  OnFailed.Clear();
+  WorldContextObject = nullptr;
+  FeatureId.Reset();
+  RequiredBalance = 1;
+  EntityId.Reset();
+  bForceRefresh = false;
+}
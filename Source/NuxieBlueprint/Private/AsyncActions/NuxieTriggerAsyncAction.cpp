@@ -13,6 +13,7 @@ UNuxieTriggerAsyncAction* UNuxieTriggerAsyncAction::StartNuxieTrigger(
   Action->WorldContextObject = WorldContextObjectIn;
   Action->EventName = EventNameIn;
   Action->Options = OptionsIn;
+  Action->bInUse = true;
   return Action;
 }
 
@@ -20,24 +21,21 @@ void UNuxieTriggerAsyncAction::Activate()
 {
   if (WorldContextObject == nullptr)
   {
-    OnFailed.Broadcast(FNuxieError::Make(TEXT("NO_WORLD_CONTEXT"), TEXT("World context object is required.")));
-    SetReadyToDestroy();
+    Fail(FNuxieError::Make(TEXT("NO_WORLD_CONTEXT"), TEXT("World context object is required.")));
     return;
   }
 
   UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
   if (World == nullptr || World->GetGameInstance() == nullptr)
   {
-    OnFailed.Broadcast(FNuxieError::Make(TEXT("NO_GAME_INSTANCE"), TEXT("Unable to resolve game instance.")));
-    SetReadyToDestroy();
+    Fail(FNuxieError::Make(TEXT("NO_GAME_INSTANCE"), TEXT("Unable to resolve game instance.")));
     return;
   }
 
   Subsystem = World->GetGameInstance()->GetSubsystem<UNuxieSubsystem>();
   if (Subsystem == nullptr)
   {
-    OnFailed.Broadcast(FNuxieError::Make(TEXT("NO_SUBSYSTEM"), TEXT("Nuxie subsystem is unavailable.")));
-    SetReadyToDestroy();
+    Fail(FNuxieError::Make(TEXT("NO_SUBSYSTEM"), TEXT("Nuxie subsystem is unavailable.")));
     return;
   }
 
@@ -47,14 +45,19 @@ void UNuxieTriggerAsyncAction::Activate()
   if (!Subsystem->StartTrigger(EventName, Options, RequestId, Error))
   {
     CleanupBinding();
-    OnFailed.Broadcast(Error);
-    SetReadyToDestroy();
+    Fail(Error);
     return;
   }
 }
 
 void UNuxieTriggerAsyncAction::Cancel()
 {
+  // Cancelling an action that already ended, from a completion handler or a second time, does nothing.
+  if (!bInUse)
+  {
+    return;
+  }
+
   if (Subsystem != nullptr && !RequestId.IsEmpty())
   {
     FNuxieError IgnoreError;
@@ -63,7 +66,7 @@ void UNuxieTriggerAsyncAction::Cancel()
 
   CleanupBinding();
   Super::Cancel();
-  SetReadyToDestroy();
+  Finish();
 }
 
 void UNuxieTriggerAsyncAction::HandleSubsystemTriggerUpdate(const FString& InRequestId, const FNuxieTriggerUpdate& Update)
@@ -74,12 +77,17 @@ void UNuxieTriggerAsyncAction::HandleSubsystemTriggerUpdate(const FString& InReq
   }
 
   OnUpdate.Broadcast(Update);
+  if (!bInUse)
+  {
+    // A handler cancelled this trigger.
+    return;
+  }
 
   if (Update.bIsTerminal || Nuxie::FTriggerContract::IsTerminal(Update))
   {
     CleanupBinding();
     OnCompleted.Broadcast(Update);
-    SetReadyToDestroy();
+    Finish();
   }
 }
 
@@ -91,3 +99,21 @@ void UNuxieTriggerAsyncAction::CleanupBinding()
     TriggerUpdateHandle.Reset();
   }
 }
+
+void UNuxieTriggerAsyncAction::Fail(const FNuxieError& Error)
+{
+  OnFailed.Broadcast(Error);
+  Finish();
+}
+
+void UNuxieTriggerAsyncAction::Finish()
+{
+  // A handler may have cancelled the action already.
+  if (!bInUse)
+  {
+    return;
+  }
+
+  bInUse = false;
+  SetReadyToDestroy();
+}
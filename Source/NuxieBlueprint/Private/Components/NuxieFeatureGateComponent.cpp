@@ -0,0 +1,118 @@
+#include "Components/NuxieFeatureGateComponent.h"
+
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "NuxieSubsystem.h"
+
+UNuxieFeatureGateComponent::UNuxieFeatureGateComponent()
+{
+  PrimaryComponentTick.bCanEverTick = false;
+}
+
+void UNuxieFeatureGateComponent::BeginPlay()
+{
+  Super::BeginPlay();
+  Register();
+}
+
+void UNuxieFeatureGateComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+  Unregister();
+  Super::EndPlay(EndPlayReason);
+}
+
+void UNuxieFeatureGateComponent::SetFeature(FName InFeatureId, int32 InRequiredBalance, FName InEntityId)
+{
+  FeatureId = InFeatureId;
+  RequiredBalance = InRequiredBalance;
+  EntityId = InEntityId;
+
+  if (HasBegunPlay())
+  {
+    Unregister();
+    Register();
+  }
+}
+
+bool UNuxieFeatureGateComponent::IsGateOpen() const
+{
+  return bOpen;
+}
+
+FNuxieFeatureAccess UNuxieFeatureGateComponent::GetAccess() const
+{
+  return Access;
+}
+
+void UNuxieFeatureGateComponent::Register()
+{
+  UWorld* World = GetWorld();
+  UGameInstance* GameInstance = World != nullptr ? World->GetGameInstance() : nullptr;
+  UNuxieSubsystem* NuxieSubsystem = GameInstance != nullptr ? GameInstance->GetSubsystem<UNuxieSubsystem>() : nullptr;
+  if (NuxieSubsystem != nullptr && !FeatureId.IsNone())
+  {
+    Subsystem = NuxieSubsystem;
+    SubscriptionHandle = NuxieSubsystem->SubscribeFeature(
+      FeatureId,
+      EntityId,
+      FNuxieFeatureAccessChangedDelegate::CreateUObject(this, &UNuxieFeatureGateComponent::HandleAccessChanged));
+    ReloadHandle = NuxieSubsystem->OnFeatureStateReloadedNative.AddUObject(this, &UNuxieFeatureGateComponent::Evaluate);
+  }
+
+  // Without a subsystem the answer is unknown, which closes a gate that SetFeature moved.
+  Evaluate();
+
+  // Ask the SDK once when nothing is known locally yet; gates on the same feature share the call.
+  // The answer is recorded in the evaluator, which calls the subscription above, so the gate opens
+  // from HandleAccessChanged.
+  if (NuxieSubsystem != nullptr && !FeatureId.IsNone() && !bKnown)
+  {
+    NuxieSubsystem->RequestFeatureAccess(FeatureId.ToString(), RequiredBalance, EntityId.IsNone() ? FString() : EntityId.ToString());
+  }
+}
+
+void UNuxieFeatureGateComponent::Unregister()
+{
+  if (UNuxieSubsystem* NuxieSubsystem = Subsystem.Get())
+  {
+    NuxieSubsystem->UnsubscribeFeature(SubscriptionHandle);
+    NuxieSubsystem->OnFeatureStateReloadedNative.Remove(ReloadHandle);
+  }
+
+  Subsystem.Reset();
+  SubscriptionHandle.Reset();
+  ReloadHandle.Reset();
+}
+
+void UNuxieFeatureGateComponent::HandleAccessChanged(
+  const FString& ChangedFeatureId,
+  const FNuxieFeatureAccess& Previous,
+  const FNuxieFeatureAccess& Current)
+{
+  // The pushed access is customer-level; the evaluator applies RequiredBalance and the entity.
+  Evaluate();
+}
+
+void UNuxieFeatureGateComponent::Evaluate()
+{
+  const UNuxieSubsystem* NuxieSubsystem = Subsystem.Get();
+  FNuxieFeatureAccess Evaluated;
+  bKnown = NuxieSubsystem != nullptr && NuxieSubsystem->EvaluateFeatureAccess(FeatureId, RequiredBalance, EntityId, Evaluated);
+  const bool bNowOpen = bKnown && Evaluated.bAllowed;
+  Access = bKnown ? Evaluated : FNuxieFeatureAccess();
+
+  if (bNowOpen == bOpen)
+  {
+    return;
+  }
+
+  bOpen = bNowOpen;
+  if (bOpen)
+  {
+    OnGateOpened.Broadcast(Access);
+  }
+  else
+  {
+    OnGateClosed.Broadcast(Access);
+  }
+}
@@ -0,0 +1,73 @@
+#include "NuxieBlueprintLibrary.h"
+
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "NuxieSubsystem.h"
+
+namespace
+{
+  UNuxieSubsystem* FindSubsystem(const UObject* WorldContextObject)
+  {
+    if (WorldContextObject == nullptr || GEngine == nullptr)
+    {
+      return nullptr;
+    }
+
+    UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
+    if (World == nullptr || World->GetGameInstance() == nullptr)
+    {
+      return nullptr;
+    }
+
+    return World->GetGameInstance()->GetSubsystem<UNuxieSubsystem>();
+  }
+}
+
+void UNuxieBlueprintLibrary::GetCachedFeatureCheck(
+  UObject* WorldContextObject,
+  const FString& FeatureId,
+  int32 RequiredBalance,
+  const FString& EntityId,
+  const FNuxieFeatureCachePolicy& CachePolicy,
+  FNuxieFeatureCheckResult& Result,
+  ENuxieCachedAnswer& Answer)
+{
+  UNuxieSubsystem* Subsystem = FindSubsystem(WorldContextObject);
+  Answer = Subsystem != nullptr && Subsystem->TryGetCachedFeatureCheck(FeatureId, RequiredBalance, EntityId, CachePolicy, Result)
+    ? ENuxieCachedAnswer::Known
+    : ENuxieCachedAnswer::Unknown;
+}
+
+void UNuxieBlueprintLibrary::EvaluateFeatureAccess(
+  UObject* WorldContextObject,
+  FName FeatureId,
+  int32 RequiredBalance,
+  FName EntityId,
+  FNuxieFeatureAccess& Access,
+  ENuxieCachedAnswer& Answer)
+{
+  const UNuxieSubsystem* Subsystem = FindSubsystem(WorldContextObject);
+  Answer = Subsystem != nullptr && Subsystem->EvaluateFeatureAccess(FeatureId, RequiredBalance, EntityId, Access)
+    ? ENuxieCachedAnswer::Known
+    : ENuxieCachedAnswer::Unknown;
+}
+
+bool UNuxieBlueprintLibrary::CompletePurchase(const FNuxiePurchaseCompletion& Completion, const FNuxiePurchaseResult& Result)
+{
+  return Completion.Complete(Result);
+}
+
+bool UNuxieBlueprintLibrary::CompleteRestore(const FNuxieRestoreCompletion& Completion, const FNuxieRestoreResult& Result)
+{
+  return Completion.Complete(Result);
+}
+
+bool UNuxieBlueprintLibrary::IsPurchasePending(const FNuxiePurchaseCompletion& Completion)
+{
+  return Completion.IsPending();
+}
+
+bool UNuxieBlueprintLibrary::IsRestorePending(const FNuxieRestoreCompletion& Completion)
+{
+  return Completion.IsPending();
+}
@@ -0,0 +1,73 @@
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "AsyncActions/NuxieAsyncActionPool.h"
+#include "AsyncActions/NuxieTriggerAsyncAction.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "Misc/AutomationTest.h"
+
+namespace
+{
+  /** A standalone game instance, so the pool subsystem exists; shut down when it goes out of scope. */
+  struct FScopedGameInstance
+  {
+    UGameInstance* GameInstance = nullptr;
+
+    FScopedGameInstance()
+    {
+      GameInstance = NewObject<UGameInstance>(GEngine);
+      GameInstance->AddToRoot();
+      GameInstance->InitializeStandalone();
+    }
+
+    ~FScopedGameInstance()
+    {
+      UWorld* World = GameInstance->GetWorld();
+      GameInstance->Shutdown();
+      if (World != nullptr)
+      {
+        GEngine->DestroyWorldContext(World);
+        World->DestroyWorld(false);
+      }
+      GameInstance->RemoveFromRoot();
+    }
+  };
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+  FNuxieAsyncActionTriggerNotPooledTest,
+  "Nuxie.AsyncActions.TriggerNodesAreNotPooled",
+  EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FNuxieAsyncActionTriggerNotPooledTest::RunTest(const FString& Parameters)
+{
+  FScopedGameInstance Scope;
+  UWorld* World = Scope.GameInstance->GetWorld();
+  UNuxieAsyncActionPool* Pool = UNuxieAsyncActionPool::Get(World);
+  if (!TestNotNull(TEXT("The game instance has an action pool"), Pool))
+  {
+    return false;
+  }
+
+  // Actions are cancelled before activation, so the SDK is never called.
+  const int64 CreatedBefore = Pool->GetCreatedActionCount();
+  UNuxieTriggerAsyncAction* First = UNuxieTriggerAsyncAction::StartNuxieTrigger(World, TEXT("nuxie_test"), FNuxieTriggerOptions());
+  First->Cancel();
+  First->Cancel();
+
+  // A Blueprint that kept the first pin and cancels it late must not reach the second node.
+  UNuxieTriggerAsyncAction* Second = UNuxieTriggerAsyncAction::StartNuxieTrigger(World, TEXT("nuxie_test"), FNuxieTriggerOptions());
+  TestTrue(TEXT("The second node gets its own action"), Second != First);
+  First->Cancel();
+
+  TestEqual(TEXT("Trigger nodes take nothing from the pool"), Pool->GetCreatedActionCount(), CreatedBefore);
+  TestEqual(TEXT("Nor check anything out"), Pool->GetActiveActionCount(), 0);
+
+  Second->Cancel();
+  return true;
+}
+
+#endif
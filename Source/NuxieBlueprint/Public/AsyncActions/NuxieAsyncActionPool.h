@@ -0,0 +1,66 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+
+#include "NuxieAsyncActionPool.generated.h"
+
+class UNuxieCheckFeatureAsyncAction;
+
+/**
+ * Recycles the feature-check async actions of one game instance, so that UI firing many check
+ * nodes does not create a UObject per call for the garbage collector.
+ *
+ * An action goes back to the pool once it has broadcast its last event; its delegates are cleared
+ * then, so a Blueprint must not keep the action pin past completion. Cancellable actions such as
+ * UNuxieTriggerAsyncAction are not pooled, since a kept pin could cancel the next node's work. Up
+ * to MaxFreeActions are kept; beyond that, finished actions are left to GC as before.
+ * Game thread only.
+ */
+UCLASS()
+class NUXIEBLUEPRINT_API UNuxieAsyncActionPool : public UGameInstanceSubsystem
+{
+  GENERATED_BODY()
+
+public:
+  static constexpr int32 MaxFreeActions = 32;
+
+  /** Null without a game instance, e.g. for a null or editor-only world context. */
+  static UNuxieAsyncActionPool* Get(const UObject* WorldContextObject);
+
+  virtual void Deinitialize() override;
+
+  UNuxieCheckFeatureAsyncAction* AcquireCheckFeatureAction();
+
+  /** Resets Action and keeps it for reuse; ignored for an action that is not checked out. */
+  void Release(UNuxieCheckFeatureAsyncAction* Action);
+
+  /** Actions created because the pool had none free. */
+  UFUNCTION(BlueprintPure, Category = "Nuxie|Async")
+  int64 GetCreatedActionCount() const;
+
+  /** Actions handed out again instead of creating new ones. */
+  UFUNCTION(BlueprintPure, Category = "Nuxie|Async")
+  int64 GetReusedActionCount() const;
+
+  /** Actions checked out and not finished yet. */
+  UFUNCTION(BlueprintPure, Category = "Nuxie|Async")
+  int32 GetActiveActionCount() const;
+
+private:
+  template <typename ActionType>
+  ActionType* Acquire(TArray<TObjectPtr<ActionType>>& FreeActions);
+
+  template <typename ActionType>
+  void Release(ActionType* Action, TArray<TObjectPtr<ActionType>>& FreeActions);
+
+  UPROPERTY()
+  TArray<TObjectPtr<UNuxieCheckFeatureAsyncAction>> FreeCheckFeatureActions;
+
+  /** Keeps checked-out actions alive until they finish; nothing else references them. */
+  UPROPERTY()
+  TSet<TObjectPtr<UObject>> ActiveActions;
+
+  int64 CreatedCount = 0;
+  int64 ReusedCount = 0;
+};
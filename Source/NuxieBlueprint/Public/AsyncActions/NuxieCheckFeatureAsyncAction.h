@@ -6,11 +6,13 @@
 #include "NuxieTypes.h"
 #include "NuxieCheckFeatureAsyncAction.generated.h"
 
+class UNuxieAsyncActionPool;
 class UNuxieSubsystem;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FNuxieCheckFeatureSuccessEvent, const FNuxieFeatureCheckResult&, Result);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FNuxieCheckFeatureFailureEvent, const FNuxieError&, Error);
 
+/** Pooled per game instance by UNuxieAsyncActionPool; do not keep the action past OnSuccess or OnFailed. */
 UCLASS()
 class NUXIEBLUEPRINT_API UNuxieCheckFeatureAsyncAction : public UBlueprintAsyncActionBase
 {
@@ -34,6 +36,18 @@ public:
   FNuxieCheckFeatureFailureEvent OnFailed;
 
 private:
+  friend class UNuxieAsyncActionPool;
+
+  /** Broadcasts OnFailed, then ends this use. */
+  void Fail(const FNuxieError& Error);
+
+  /**
+   * Ends the use numbered UseGeneration and hands the action back to its pool, if it has one. A
+   * no-op once that use has ended, even if the action already serves another node.
+   */
+  void Finish(uint32 UseGeneration);
+  void ResetForReuse();
+
   UPROPERTY()
   TObjectPtr<UObject> WorldContextObject;
 
@@ -41,4 +55,12 @@ private:
   int32 RequiredBalance = 1;
   FString EntityId;
   bool bForceRefresh = false;
+
+  TWeakObjectPtr<UNuxieAsyncActionPool> Pool;
+
+  /** Bumped when a use ends, so the answer to an earlier use is not delivered to the next one. */
+  uint32 Generation = 0;
+
+  /** Set by CheckNuxieFeature and cleared by Finish. */
+  bool bInUse = false;
 };
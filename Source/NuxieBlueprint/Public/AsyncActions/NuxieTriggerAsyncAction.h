@@ -12,6 +12,10 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FNuxieTriggerAsyncUpdateEvent, const
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FNuxieTriggerAsyncCompletedEvent, const FNuxieTriggerUpdate&, TerminalUpdate);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FNuxieTriggerAsyncFailedEvent, const FNuxieError&, Error);
 
+/**
+ * Not pooled, unlike UNuxieCheckFeatureAsyncAction: a Blueprint can keep the action pin and call
+ * Cancel at any time, and on a recycled action that would cancel another node's trigger.
+ */
 UCLASS()
 class NUXIEBLUEPRINT_API UNuxieTriggerAsyncAction : public UCancellableAsyncAction
 {
@@ -42,6 +46,12 @@ private:
 
   void CleanupBinding();
 
+  /** Broadcasts OnFailed, then ends the action. */
+  void Fail(const FNuxieError& Error);
+
+  /** Marks the action ready to destroy; a no-op once it has ended. */
+  void Finish();
+
   UPROPERTY()
   TObjectPtr<UObject> WorldContextObject;
 
@@ -52,4 +62,7 @@ private:
   FNuxieTriggerOptions Options;
   FString RequestId;
   FDelegateHandle TriggerUpdateHandle;
+
+  /** Set by StartNuxieTrigger and cleared by Finish; Cancel is a no-op once the action has ended. */
+  bool bInUse = false;
 };
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+
+#include "NuxieTypes.h"
+#include "NuxieFeatureGateComponent.generated.h"
+
+class UNuxieSubsystem;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FNuxieFeatureGateEvent, const FNuxieFeatureAccess&, Access);
+
+/**
+ * Opens while the owner has access to one feature, without polling CheckFeatureAsync.
+ *
+ * On BeginPlay the gate subscribes once to the subsystem's feature subscription index, which buckets
+ * subscribers by feature so that any number of gates share it, and takes its initial state from
+ * EvaluateFeatureAccess. When that answer is unknown, it asks the SDK once with CheckFeatureAsync.
+ * It then re-evaluates only when an answer for its feature changes or the local feature state is
+ * reloaded. The gate starts closed; OnGateOpened and OnGateClosed fire only when the answer flips,
+ * including the first time it opens. An unknown answer keeps the gate closed.
+ */
+UCLASS(ClassGroup = (Nuxie), meta = (BlueprintSpawnableComponent))
+class NUXIEBLUEPRINT_API UNuxieFeatureGateComponent : public UActorComponent
+{
+  GENERATED_BODY()
+
+public:
+  UNuxieFeatureGateComponent();
+
+  virtual void BeginPlay() override;
+  virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+  /** Points the gate at another feature and re-evaluates it; the events fire if the answer flips. */
+  UFUNCTION(BlueprintCallable, Category = "Nuxie|Features")
+  void SetFeature(FName InFeatureId, int32 InRequiredBalance, FName InEntityId);
+
+  UFUNCTION(BlueprintPure, Category = "Nuxie|Features")
+  bool IsGateOpen() const;
+
+  /** Last access the gate evaluated; the default, not allowed, while the answer is unknown. */
+  UFUNCTION(BlueprintPure, Category = "Nuxie|Features")
+  FNuxieFeatureAccess GetAccess() const;
+
+  UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Nuxie|Features")
+  FName FeatureId;
+
+  UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Nuxie|Features", meta = (ClampMin = "1"))
+  int32 RequiredBalance = 1;
+
+  /** Leave empty for customer-level access. */
+  UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Nuxie|Features")
+  FName EntityId;
+
+  UPROPERTY(BlueprintAssignable, Category = "Nuxie|Features")
+  FNuxieFeatureGateEvent OnGateOpened;
+
+  UPROPERTY(BlueprintAssignable, Category = "Nuxie|Features")
+  FNuxieFeatureGateEvent OnGateClosed;
+
+private:
+  void Register();
+  void Unregister();
+  void HandleAccessChanged(const FString& ChangedFeatureId, const FNuxieFeatureAccess& Previous, const FNuxieFeatureAccess& Current);
+  void Evaluate();
+
+  TWeakObjectPtr<UNuxieSubsystem> Subsystem;
+  FDelegateHandle SubscriptionHandle;
+  FDelegateHandle ReloadHandle;
+  FNuxieFeatureAccess Access;
+  bool bKnown = false;
+  bool bOpen = false;
+};
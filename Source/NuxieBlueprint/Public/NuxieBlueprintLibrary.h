@@ -0,0 +1,61 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+
+#include "NuxiePurchaseController.h"
+#include "NuxieTypes.h"
+#include "NuxieBlueprintLibrary.generated.h"
+
+UENUM(BlueprintType)
+enum class ENuxieCachedAnswer : uint8
+{
+  Known,
+  Unknown
+};
+
+/**
+ * Same-frame feature nodes that answer from state the subsystem already holds. They run like any
+ * other function call, with no async action behind them; on Unknown, fall back to the async nodes.
+ * Also exposes the purchase completion handles of INuxieAsyncPurchaseController to Blueprints.
+ */
+UCLASS()
+class NUXIEBLUEPRINT_API UNuxieBlueprintLibrary : public UBlueprintFunctionLibrary
+{
+  GENERATED_BODY()
+
+public:
+  /** Answers from the CheckFeatureAsync cache under CachePolicy; a stale answer also starts a background refresh. */
+  UFUNCTION(BlueprintCallable, meta = (WorldContext = "WorldContextObject", ExpandEnumAsExecs = "Answer"), Category = "Nuxie|Features")
+  static void GetCachedFeatureCheck(
+    UObject* WorldContextObject,
+    const FString& FeatureId,
+    int32 RequiredBalance,
+    const FString& EntityId,
+    const FNuxieFeatureCachePolicy& CachePolicy,
+    FNuxieFeatureCheckResult& Result,
+    ENuxieCachedAnswer& Answer);
+
+  /** UNuxieSubsystem::EvaluateFeatureAccess: profile snapshot, earlier answers and pushed changes. */
+  UFUNCTION(BlueprintCallable, meta = (WorldContext = "WorldContextObject", ExpandEnumAsExecs = "Answer"), Category = "Nuxie|Features")
+  static void EvaluateFeatureAccess(
+    UObject* WorldContextObject,
+    FName FeatureId,
+    int32 RequiredBalance,
+    FName EntityId,
+    FNuxieFeatureAccess& Access,
+    ENuxieCachedAnswer& Answer);
+
+  /** Returns false when the request was already completed, or its subsystem is gone. */
+  UFUNCTION(BlueprintCallable, Category = "Nuxie|Purchases")
+  static bool CompletePurchase(const FNuxiePurchaseCompletion& Completion, const FNuxiePurchaseResult& Result);
+
+  UFUNCTION(BlueprintCallable, Category = "Nuxie|Purchases")
+  static bool CompleteRestore(const FNuxieRestoreCompletion& Completion, const FNuxieRestoreResult& Result);
+
+  UFUNCTION(BlueprintPure, Category = "Nuxie|Purchases")
+  static bool IsPurchasePending(const FNuxiePurchaseCompletion& Completion);
+
+  UFUNCTION(BlueprintPure, Category = "Nuxie|Purchases")
+  static bool IsRestorePending(const FNuxieRestoreCompletion& Completion);
+};
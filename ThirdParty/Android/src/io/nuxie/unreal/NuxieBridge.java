@@ -7,19 +7,27 @@ import java.lang.reflect.Method;
 import java.lang.reflect.Proxy;
 import java.net.URLDecoder;
 import java.net.URLEncoder;
+import java.nio.ByteBuffer;
 import java.nio.charset.StandardCharsets;
 import java.util.Arrays;
 import java.util.Collections;
 import java.util.HashMap;
 import java.util.LinkedHashMap;
+import java.util.Locale;
 import java.util.Map;
 import java.util.UUID;
 import java.util.concurrent.CompletableFuture;
 import java.util.concurrent.ConcurrentHashMap;
-import java.util.concurrent.CountDownLatch;
+import java.util.concurrent.ExecutionException;
+import java.util.concurrent.Executors;
+import java.util.concurrent.ScheduledExecutorService;
+import java.util.concurrent.ScheduledFuture;
+import java.util.concurrent.ThreadFactory;
 import java.util.concurrent.TimeUnit;
 import java.util.concurrent.TimeoutException;
+import java.util.concurrent.atomic.AtomicInteger;
 import java.util.concurrent.atomic.AtomicReference;
+import java.util.function.BiConsumer;
 
 /**
  * Unreal <-> native Android bridge entrypoint.
@@ -47,9 +55,19 @@ public final class NuxieBridge {
 
     void onFeatureAccessChanged(String featureId, FeatureAccessPayload from, FeatureAccessPayload to);
 
-    PurchaseResultPayload awaitPurchaseResult(PurchaseRequestPayload request, long timeoutMs);
+    /**
+     * Emits the request and returns at once. The future completes when Unreal completes the request,
+     * or with a failed result after timeoutMs; no thread waits on it in between.
+     */
+    CompletableFuture<PurchaseResultPayload> requestPurchaseResult(PurchaseRequestPayload request, long timeoutMs);
 
-    RestoreResultPayload awaitRestoreResult(RestoreRequestPayload request, long timeoutMs);
+    CompletableFuture<RestoreResultPayload> requestRestoreResult(RestoreRequestPayload request, long timeoutMs);
+
+    /** How long a blocking call into a suspend function waits for it. */
+    long requestTimeoutMillis();
+
+    /** How long a purchase or restore request waits for Unreal; Unreal sets it at configure. */
+    long purchaseTimeoutMillis();
 
     void onFlowPresented(String flowId);
 
@@ -61,7 +79,7 @@ public final class NuxieBridge {
 
     void shutdown() throws Exception;
 
-    void identify(String distinctId, Map<String, String> userProperties, Map<String, String> userPropertiesSetOnce) throws Exception;
+    void identify(String distinctId, Map<String, Object> userProperties, Map<String, Object> userPropertiesSetOnce) throws Exception;
 
     void reset(boolean keepAnonymousId) throws Exception;
 
@@ -83,9 +101,9 @@ public final class NuxieBridge {
 
     FeatureCheckPayload checkFeature(String featureId, Integer requiredBalance, String entityId, boolean forceRefresh) throws Exception;
 
-    void useFeature(String featureId, double amount, String entityId, Map<String, String> metadata) throws Exception;
+    void useFeature(String featureId, double amount, String entityId, Map<String, Object> metadata) throws Exception;
 
-    FeatureUsagePayload useFeatureAndWait(String featureId, double amount, String entityId, boolean setUsage, Map<String, String> metadata) throws Exception;
+    FeatureUsagePayload useFeatureAndWait(String featureId, double amount, String entityId, boolean setUsage, Map<String, Object> metadata) throws Exception;
 
     boolean flushEvents() throws Exception;
 
@@ -95,12 +113,26 @@ public final class NuxieBridge {
 
     void resumeEventQueue() throws Exception;
 
+    void updateRuntimeOptions(Map<String, String> options) throws Exception;
+
     void completePurchase(String requestId, PurchaseResultPayload result) throws Exception;
 
     void completeRestore(String requestId, RestoreResultPayload result) throws Exception;
   }
 
   private static final class BridgeCore implements RuntimeCallbacks {
+    /** Used until Unreal sends FNuxiePurchaseTracker::TimeoutSeconds at configure. */
+    private static final long DEFAULT_PURCHASE_TIMEOUT_MILLIS = 60_000L;
+
+    private static final ScheduledExecutorService REQUEST_TIMEOUTS = Executors.newSingleThreadScheduledExecutor(new ThreadFactory() {
+      @Override
+      public Thread newThread(Runnable runnable) {
+        Thread thread = new Thread(runnable, "nuxie-request-timeouts");
+        thread.setDaemon(true);
+        return thread;
+      }
+    });
+
     private final Map<String, CompletableFuture<PurchaseResultPayload>> pendingPurchases = new ConcurrentHashMap<>();
     private final Map<String, CompletableFuture<RestoreResultPayload>> pendingRestores = new ConcurrentHashMap<>();
     private final Map<String, Object> startedTriggers = new ConcurrentHashMap<>();
@@ -109,6 +141,7 @@ public final class NuxieBridge {
     private volatile Emitter emitter;
     private volatile long nativeHandle;
     private volatile long requestTimeoutMillis = 60_000L;
+    private volatile long purchaseTimeoutMillis = DEFAULT_PURCHASE_TIMEOUT_MILLIS;
 
     private BridgeCore() {
       this.runtime = new ReflectiveRuntime();
@@ -136,6 +169,7 @@ public final class NuxieBridge {
       if (wrapperVersion != null && !wrapperVersion.isEmpty()) {
         options.put("wrapper_version", wrapperVersion);
       }
+      purchaseTimeoutMillis = parsePurchaseTimeoutMillis(options.get("purchase_timeout_seconds"));
 
       runtime.configure(apiKey, options, usePurchaseController, this);
     }
@@ -150,8 +184,8 @@ public final class NuxieBridge {
     synchronized void identify(String distinctId, String userPropertiesPayload, String userPropertiesSetOncePayload) throws Exception {
       runtime.identify(
         distinctId,
-        KvCodec.decodeMap(userPropertiesPayload),
-        KvCodec.decodeMap(userPropertiesSetOncePayload));
+        KvCodec.decodeProperties(userPropertiesPayload),
+        KvCodec.decodeProperties(userPropertiesSetOncePayload));
     }
 
     synchronized void reset(boolean keepAnonymousId) throws Exception {
@@ -185,49 +219,55 @@ public final class NuxieBridge {
       runtime.showFlow(flowId);
     }
 
-    synchronized String refreshProfile() throws Exception {
+    // The calls that wait on a suspend function take no lock, so a slow one never holds up
+    // completePurchase, completeRestore or the other bridge calls.
+    String refreshProfile() throws Exception {
       return runtime.refreshProfile().toPayload();
     }
 
-    synchronized String hasFeature(String featureId, Integer requiredBalance, String entityId) throws Exception {
+    String hasFeature(String featureId, Integer requiredBalance, String entityId) throws Exception {
       return runtime.hasFeature(featureId, requiredBalance, entityId).toPayload();
     }
 
-    synchronized String checkFeature(String featureId, Integer requiredBalance, String entityId, boolean forceRefresh)
+    String checkFeature(String featureId, Integer requiredBalance, String entityId, boolean forceRefresh)
       throws Exception {
       return runtime.checkFeature(featureId, requiredBalance, entityId, forceRefresh).toPayload();
     }
 
     synchronized void useFeature(String featureId, double amount, String entityId, String metadataPayload) throws Exception {
-      runtime.useFeature(featureId, amount, entityId, KvCodec.decodeMap(metadataPayload));
+      runtime.useFeature(featureId, amount, entityId, KvCodec.decodeProperties(metadataPayload));
     }
 
-    synchronized String useFeatureAndWait(
+    String useFeatureAndWait(
       String featureId,
       double amount,
       String entityId,
       boolean setUsage,
       String metadataPayload)
       throws Exception {
-      return runtime.useFeatureAndWait(featureId, amount, entityId, setUsage, KvCodec.decodeMap(metadataPayload)).toPayload();
+      return runtime.useFeatureAndWait(featureId, amount, entityId, setUsage, KvCodec.decodeProperties(metadataPayload)).toPayload();
     }
 
-    synchronized boolean flushEvents() throws Exception {
+    boolean flushEvents() throws Exception {
       return runtime.flushEvents();
     }
 
-    synchronized int getQueuedEventCount() throws Exception {
+    int getQueuedEventCount() throws Exception {
       return runtime.getQueuedEventCount();
     }
 
-    synchronized void pauseEventQueue() throws Exception {
+    void pauseEventQueue() throws Exception {
       runtime.pauseEventQueue();
     }
 
-    synchronized void resumeEventQueue() throws Exception {
+    void resumeEventQueue() throws Exception {
       runtime.resumeEventQueue();
     }
 
+    synchronized void updateRuntimeOptions(String optionsPayload) throws Exception {
+      runtime.updateRuntimeOptions(KvCodec.decodeMap(optionsPayload));
+    }
+
     synchronized void completePurchase(String requestId, String purchaseResultPayload) throws Exception {
       PurchaseResultPayload result = PurchaseResultPayload.fromPayload(purchaseResultPayload);
       CompletableFuture<PurchaseResultPayload> future = pendingPurchases.remove(requestId);
@@ -261,29 +301,67 @@ public final class NuxieBridge {
     }
 
     @Override
-    public PurchaseResultPayload awaitPurchaseResult(PurchaseRequestPayload request, long timeoutMs) {
+    public CompletableFuture<PurchaseResultPayload> requestPurchaseResult(PurchaseRequestPayload request, long timeoutMs) {
       CompletableFuture<PurchaseResultPayload> future = new CompletableFuture<PurchaseResultPayload>();
       pendingPurchases.put(request.requestId, future);
+      failOnTimeout(pendingPurchases, request.requestId, future, PurchaseResultPayload.failed("purchase_timeout"), timeoutMs);
       emitPurchaseRequest(request.toPayload());
-      try {
-        return future.get(timeoutMs, TimeUnit.MILLISECONDS);
-      } catch (Exception timeout) {
-        pendingPurchases.remove(request.requestId);
-        return PurchaseResultPayload.failed("purchase_timeout");
-      }
+      return future;
     }
 
     @Override
-    public RestoreResultPayload awaitRestoreResult(RestoreRequestPayload request, long timeoutMs) {
+    public CompletableFuture<RestoreResultPayload> requestRestoreResult(RestoreRequestPayload request, long timeoutMs) {
       CompletableFuture<RestoreResultPayload> future = new CompletableFuture<RestoreResultPayload>();
       pendingRestores.put(request.requestId, future);
+      failOnTimeout(pendingRestores, request.requestId, future, RestoreResultPayload.failed("restore_timeout"), timeoutMs);
       emitRestoreRequest(request.toPayload());
-      try {
-        return future.get(timeoutMs, TimeUnit.MILLISECONDS);
-      } catch (Exception timeout) {
-        pendingRestores.remove(request.requestId);
-        return RestoreResultPayload.failed("restore_timeout");
+      return future;
+    }
+
+    @Override
+    public long requestTimeoutMillis() {
+      return requestTimeoutMillis;
+    }
+
+    @Override
+    public long purchaseTimeoutMillis() {
+      return purchaseTimeoutMillis;
+    }
+
+    private static long parsePurchaseTimeoutMillis(String seconds) {
+      if (seconds == null || seconds.isEmpty()) {
+        return DEFAULT_PURCHASE_TIMEOUT_MILLIS;
       }
+      try {
+        long parsed = Long.parseLong(seconds);
+        return parsed > 0 ? parsed * 1000L : DEFAULT_PURCHASE_TIMEOUT_MILLIS;
+      } catch (NumberFormatException invalid) {
+        return DEFAULT_PURCHASE_TIMEOUT_MILLIS;
+      }
+    }
+
+    private static <T> void failOnTimeout(
+      final Map<String, CompletableFuture<T>> pending,
+      final String requestId,
+      final CompletableFuture<T> future,
+      final T timedOut,
+      long timeoutMs) {
+      final ScheduledFuture<?> timer = REQUEST_TIMEOUTS.schedule(new Runnable() {
+        @Override
+        public void run() {
+          // Only the timer that still owns the pending entry fails it; a completion removes it first.
+          if (pending.remove(requestId, future)) {
+            future.complete(timedOut);
+          }
+        }
+      }, timeoutMs, TimeUnit.MILLISECONDS);
+
+      future.whenComplete(new BiConsumer<T, Throwable>() {
+        @Override
+        public void accept(T result, Throwable error) {
+          timer.cancel(false);
+        }
+      });
     }
 
     @Override
@@ -404,12 +482,12 @@ public final class NuxieBridge {
         return;
       }
       Method shutdown = findMethod(sdk.getClass(), "shutdown", 1);
-      invokeSuspend(shutdown, sdk);
+      awaitSuspend(shutdown, sdk);
       triggerHandles.clear();
     }
 
     @Override
-    public void identify(String distinctId, Map<String, String> userProperties, Map<String, String> userPropertiesSetOnce)
+    public void identify(String distinctId, Map<String, Object> userProperties, Map<String, Object> userPropertiesSetOnce)
       throws Exception {
       Method identify = findMethod(sdk.getClass(), "identify", 3);
       identify.invoke(sdk, distinctId, userProperties, userPropertiesSetOnce);
@@ -489,7 +567,7 @@ public final class NuxieBridge {
     @Override
     public ProfilePayload refreshProfile() throws Exception {
       Method refresh = findMethod(sdk.getClass(), "refreshProfile", 1);
-      Object profile = invokeSuspend(refresh, sdk);
+      Object profile = awaitSuspend(refresh, sdk);
       return ProfilePayload.fromProfile(profile);
     }
 
@@ -497,12 +575,12 @@ public final class NuxieBridge {
     public FeatureAccessPayload hasFeature(String featureId, Integer requiredBalance, String entityId) throws Exception {
       if (requiredBalance != null) {
         Method hasFeature = findMethod(sdk.getClass(), "hasFeature", 4);
-        Object access = invokeSuspend(hasFeature, sdk, featureId, Integer.valueOf(requiredBalance.intValue()), entityId);
+        Object access = awaitSuspend(hasFeature, sdk, featureId, Integer.valueOf(requiredBalance.intValue()), entityId);
         return FeatureAccessPayload.fromFeatureAccess(access);
       }
 
       Method hasFeature = findMethod(sdk.getClass(), "hasFeature", 2);
-      Object access = invokeSuspend(hasFeature, sdk, featureId);
+      Object access = awaitSuspend(hasFeature, sdk, featureId);
       return FeatureAccessPayload.fromFeatureAccess(access);
     }
 
@@ -511,12 +589,12 @@ public final class NuxieBridge {
       throws Exception {
       final String methodName = forceRefresh ? "refreshFeature" : "checkFeature";
       Method check = findMethod(sdk.getClass(), methodName, 4);
-      Object result = invokeSuspend(check, sdk, featureId, requiredBalance, entityId);
+      Object result = awaitSuspend(check, sdk, featureId, requiredBalance, entityId);
       return FeatureCheckPayload.fromCheckResult(result);
     }
 
     @Override
-    public void useFeature(String featureId, double amount, String entityId, Map<String, String> metadata) throws Exception {
+    public void useFeature(String featureId, double amount, String entityId, Map<String, Object> metadata) throws Exception {
       Method useFeature = findMethod(sdk.getClass(), "useFeature", 4);
       useFeature.invoke(sdk, featureId, Double.valueOf(amount), entityId, metadata);
     }
@@ -527,37 +605,45 @@ public final class NuxieBridge {
       double amount,
       String entityId,
       boolean setUsage,
-      Map<String, String> metadata)
+      Map<String, Object> metadata)
       throws Exception {
       Method method = findMethod(sdk.getClass(), "useFeatureAndWait", 6);
-      Object result = invokeSuspend(method, sdk, featureId, Double.valueOf(amount), entityId, Boolean.valueOf(setUsage), metadata);
+      Object result = awaitSuspend(method, sdk, featureId, Double.valueOf(amount), entityId, Boolean.valueOf(setUsage), metadata);
       return FeatureUsagePayload.fromUsageResult(result);
     }
 
     @Override
     public boolean flushEvents() throws Exception {
       Method method = findMethod(sdk.getClass(), "flushEvents", 1);
-      Object value = invokeSuspend(method, sdk);
+      Object value = awaitSuspend(method, sdk);
       return asBoolean(value);
     }
 
     @Override
     public int getQueuedEventCount() throws Exception {
       Method method = findMethod(sdk.getClass(), "getQueuedEventCount", 1);
-      Object value = invokeSuspend(method, sdk);
+      Object value = awaitSuspend(method, sdk);
       return asInt(value);
     }
 
     @Override
     public void pauseEventQueue() throws Exception {
       Method method = findMethod(sdk.getClass(), "pauseEventQueue", 1);
-      invokeSuspend(method, sdk);
+      awaitSuspend(method, sdk);
     }
 
     @Override
     public void resumeEventQueue() throws Exception {
       Method method = findMethod(sdk.getClass(), "resumeEventQueue", 1);
-      invokeSuspend(method, sdk);
+      awaitSuspend(method, sdk);
+    }
+
+    @Override
+    public void updateRuntimeOptions(Map<String, String> options) throws Exception {
+      // The SDK reads queue and network settings from its live configuration on each use.
+      Method getConfiguration = findMethod(sdk.getClass(), "getConfiguration", 0);
+      Object configuration = getConfiguration.invoke(sdk);
+      applyRuntimeOptions(configuration.getClass(), configuration, options);
     }
 
     @Override
@@ -580,6 +666,7 @@ public final class NuxieBridge {
       setOptionalBooleanField(configClass, config, "isDebugMode", options.get("debug"));
       setOptionalBooleanField(configClass, config, "enableConsoleLogging", options.get("console_logging"));
       setOptionalBooleanField(configClass, config, "enableFileLogging", options.get("file_logging"));
+      applyRuntimeOptions(configClass, config, options);
 
       if (options.get("api_endpoint") != null && !options.get("api_endpoint").isEmpty()) {
         Method setApiEndpoint = findMethod(configClass, "setApiEndpoint", 1);
@@ -588,6 +675,11 @@ public final class NuxieBridge {
 
       if (usePurchaseController) {
         Class<?> delegateInterface = Class.forName("io.nuxie.sdk.purchases.NuxiePurchaseDelegate");
+        final Class<?> continuationClass = Class.forName("kotlin.coroutines.Continuation", true, delegateInterface.getClassLoader());
+        final Object suspendedMarker = Class
+          .forName("kotlin.coroutines.intrinsics.IntrinsicsKt", true, delegateInterface.getClassLoader())
+          .getMethod("getCOROUTINE_SUSPENDED")
+          .invoke(null);
         Object delegateProxy = Proxy.newProxyInstance(
           delegateInterface.getClassLoader(),
           new Class[] { delegateInterface },
@@ -598,19 +690,34 @@ public final class NuxieBridge {
               if ("purchase".equals(name)) {
                 String productId = args != null && args.length > 0 && args[0] != null ? String.valueOf(args[0]) : "";
                 PurchaseRequestPayload request = PurchaseRequestPayload.create(productId);
-                PurchaseResultPayload result = callbacks.awaitPurchaseResult(request, 60_000L);
-                return buildPurchaseResultObject(result);
+                CompletableFuture<PurchaseResultPayload> result = callbacks.requestPurchaseResult(request, callbacks.purchaseTimeoutMillis());
+                return completeDelegateCall(args, continuationClass, suspendedMarker, result, new ResultMapper<PurchaseResultPayload>() {
+                  @Override
+                  public Object map(PurchaseResultPayload payload) throws Exception {
+                    return buildPurchaseResultObject(payload);
+                  }
+                });
               }
               if ("purchaseOutcome".equals(name)) {
-                String productId = args != null && args.length > 0 && args[0] != null ? String.valueOf(args[0]) : "";
+                final String productId = args != null && args.length > 0 && args[0] != null ? String.valueOf(args[0]) : "";
                 PurchaseRequestPayload request = PurchaseRequestPayload.create(productId);
-                PurchaseResultPayload result = callbacks.awaitPurchaseResult(request, 60_000L);
-                return buildPurchaseOutcomeObject(result, productId);
+                CompletableFuture<PurchaseResultPayload> result = callbacks.requestPurchaseResult(request, callbacks.purchaseTimeoutMillis());
+                return completeDelegateCall(args, continuationClass, suspendedMarker, result, new ResultMapper<PurchaseResultPayload>() {
+                  @Override
+                  public Object map(PurchaseResultPayload payload) throws Exception {
+                    return buildPurchaseOutcomeObject(payload, productId);
+                  }
+                });
               }
               if ("restore".equals(name)) {
                 RestoreRequestPayload request = RestoreRequestPayload.create();
-                RestoreResultPayload result = callbacks.awaitRestoreResult(request, 60_000L);
-                return buildRestoreResultObject(result);
+                CompletableFuture<RestoreResultPayload> result = callbacks.requestRestoreResult(request, callbacks.purchaseTimeoutMillis());
+                return completeDelegateCall(args, continuationClass, suspendedMarker, result, new ResultMapper<RestoreResultPayload>() {
+                  @Override
+                  public Object map(RestoreResultPayload payload) throws Exception {
+                    return buildRestoreResultObject(payload);
+                  }
+                });
               }
               return null;
             }
@@ -700,6 +807,35 @@ public final class NuxieBridge {
       }
     }
 
+    private static void setOptionalNumberField(Class<?> clazz, Object target, String propertyName, String value) {
+      if (value == null || value.isEmpty()) {
+        return;
+      }
+
+      try {
+        Method setter = findMethod(clazz, "set" + capitalize(propertyName), 1);
+        Class<?> type = setter.getParameterTypes()[0];
+        long number = Long.parseLong(value);
+        if (type == int.class || type == Integer.class) {
+          setter.invoke(target, Integer.valueOf((int) number));
+        } else if (type == long.class || type == Long.class) {
+          setter.invoke(target, Long.valueOf(number));
+        } else if (type == double.class || type == Double.class) {
+          setter.invoke(target, Double.valueOf(number));
+        }
+      } catch (Exception ignored) {
+      }
+    }
+
+    private static void applyRuntimeOptions(Class<?> configClass, Object config, Map<String, String> options) {
+      setOptionalNumberField(configClass, config, "eventBatchSize", options.get("event_batch_size"));
+      setOptionalNumberField(configClass, config, "flushAt", options.get("flush_at"));
+      setOptionalNumberField(configClass, config, "flushIntervalSeconds", options.get("flush_interval_seconds"));
+      setOptionalNumberField(configClass, config, "maxQueueSize", options.get("max_queue_size"));
+      setOptionalNumberField(configClass, config, "retryCount", options.get("retry_count"));
+      setOptionalNumberField(configClass, config, "requestTimeoutSeconds", options.get("request_timeout_seconds"));
+    }
+
     private static String capitalize(String value) {
       if (value == null || value.isEmpty()) {
         return value;
@@ -707,7 +843,44 @@ public final class NuxieBridge {
       return Character.toUpperCase(value.charAt(0)) + value.substring(1);
     }
 
-    private static Object invokeSuspend(Method suspendMethod, Object target, Object... argsWithoutContinuation) throws Exception {
+    /**
+     * The delegate methods are Kotlin suspend functions, so the continuation arrives as the last
+     * argument. Suspending on it frees the SDK's thread while Unreal completes the request.
+     */
+    private static <T> Object completeDelegateCall(
+      Object[] args,
+      Class<?> continuationClass,
+      Object suspendedMarker,
+      CompletableFuture<T> result,
+      ResultMapper<T> mapper) throws Exception {
+      Object last = args != null && args.length > 0 ? args[args.length - 1] : null;
+      if (last != null && continuationClass.isInstance(last)) {
+        return suspendUntilComplete(last, result, mapper, suspendedMarker);
+      }
+
+      // Not a suspend call: the future always completes, at the latest when the request times out.
+      return mapper.map(result.get());
+    }
+
+    /** Calls a suspend function and waits for it, up to the bridge's request timeout. */
+    private Object awaitSuspend(Method suspendMethod, Object target, Object... argsWithoutContinuation) throws Exception {
+      CompletableFuture<Object> result = invokeSuspend(suspendMethod, target, argsWithoutContinuation);
+      try {
+        return result.get(callbacks.requestTimeoutMillis(), TimeUnit.MILLISECONDS);
+      } catch (ExecutionException failure) {
+        Throwable cause = failure.getCause();
+        throw cause instanceof Exception ? (Exception) cause : new RuntimeException(cause);
+      } catch (TimeoutException timedOut) {
+        throw new TimeoutException("Coroutine timeout for " + suspendMethod.getName());
+      }
+    }
+
+    /**
+     * Calls a suspend function with a continuation that completes the returned future, which is
+     * already done when the function returns without suspending.
+     */
+    private static CompletableFuture<Object> invokeSuspend(Method suspendMethod, Object target, Object... argsWithoutContinuation)
+      throws Exception {
       ClassLoader classLoader = suspendMethod.getDeclaringClass().getClassLoader();
       final Class<?> continuationClass = Class.forName("kotlin.coroutines.Continuation", true, classLoader);
       final Class<?> resultKtClass = Class.forName("kotlin.ResultKt", true, classLoader);
@@ -715,11 +888,12 @@ public final class NuxieBridge {
       final Method getSuspended = Class
         .forName("kotlin.coroutines.intrinsics.IntrinsicsKt", true, classLoader)
         .getMethod("getCOROUTINE_SUSPENDED");
+      final Object emptyContext = Class
+        .forName("kotlin.coroutines.EmptyCoroutineContext", true, classLoader)
+        .getField("INSTANCE")
+        .get(null);
 
-      final AtomicReference<Object> resultValue = new AtomicReference<Object>();
-      final AtomicReference<Throwable> errorValue = new AtomicReference<Throwable>();
-      final CountDownLatch latch = new CountDownLatch(1);
-
+      final CompletableFuture<Object> completion = new CompletableFuture<Object>();
       Object continuationProxy = Proxy.newProxyInstance(
         continuationClass.getClassLoader(),
         new Class[] { continuationClass },
@@ -730,19 +904,17 @@ public final class NuxieBridge {
               Object result = args != null && args.length > 0 ? args[0] : null;
               try {
                 throwOnFailure.invoke(null, result);
-                resultValue.set(result);
+                completion.complete(result);
               } catch (InvocationTargetException invokeFailure) {
-                errorValue.set(invokeFailure.getTargetException());
+                completion.completeExceptionally(invokeFailure.getTargetException());
               } catch (Throwable throwable) {
-                errorValue.set(throwable);
+                completion.completeExceptionally(throwable);
               }
-              latch.countDown();
               return null;
             }
 
             if ("getContext".equals(method.getName())) {
-              Class<?> emptyContext = Class.forName("kotlin.coroutines.EmptyCoroutineContext", true, classLoader);
-              return emptyContext.getField("INSTANCE").get(null);
+              return emptyContext;
             }
 
             return null;
@@ -753,21 +925,10 @@ public final class NuxieBridge {
       params[params.length - 1] = continuationProxy;
 
       Object immediate = suspendMethod.invoke(target, params);
-      Object suspended = getSuspended.invoke(null);
-      if (immediate != suspended) {
-        return immediate;
-      }
-
-      if (!latch.await(65, TimeUnit.SECONDS)) {
-        throw new TimeoutException("Coroutine timeout for " + suspendMethod.getName());
-      }
-
-      Throwable error = errorValue.get();
-      if (error != null) {
-        throw new RuntimeException(error);
+      if (immediate != getSuspended.invoke(null)) {
+        completion.complete(immediate);
       }
-
-      return resultValue.get();
+      return completion;
     }
 
     private static Object kotlinUnit() {
@@ -981,6 +1142,112 @@ public final class NuxieBridge {
     }
   }
 
+  interface ResultMapper<T> {
+    Object map(T result) throws Exception;
+  }
+
+  /**
+   * Suspends a Kotlin coroutine on a future instead of blocking its thread. Returns the value the
+   * suspend function should return: the mapped result when the future is already done, otherwise
+   * suspendedMarker, and the continuation is resumed on its own dispatcher later. Mapping errors
+   * resume it with a failure. Without the Kotlin runtime (plain JVM tests) the continuation is
+   * resumed as given.
+   */
+  static <T> Object suspendUntilComplete(
+    Object continuation,
+    CompletableFuture<T> future,
+    final ResultMapper<T> mapper,
+    Object suspendedMarker) throws Exception {
+    if (future.isDone()) {
+      try {
+        return mapper.map(future.get());
+      } catch (ExecutionException failure) {
+        Throwable cause = failure.getCause();
+        throw cause instanceof Exception ? (Exception) cause : new RuntimeException(cause);
+      }
+    }
+
+    final Object target = intercepted(continuation);
+    final Method resumeWith = target.getClass().getMethod("resumeWith", Object.class);
+    resumeWith.setAccessible(true);
+
+    // What SafeContinuation does for suspendCoroutine: a completion that lands before this call
+    // returns hands its outcome back here instead of resuming a coroutine that has not suspended.
+    final AtomicInteger decision = new AtomicInteger(UNDECIDED);
+    final AtomicReference<Object> earlyOutcome = new AtomicReference<Object>();
+    future.whenComplete(new BiConsumer<T, Throwable>() {
+      @Override
+      public void accept(T result, Throwable error) {
+        Object outcome;
+        try {
+          if (error != null) {
+            throw error;
+          }
+          outcome = mapper.map(result);
+        } catch (Throwable failure) {
+          outcome = new FailedOutcome(failure);
+        }
+
+        if (decision.compareAndSet(UNDECIDED, RESUMED)) {
+          earlyOutcome.set(outcome);
+          return;
+        }
+
+        try {
+          Object resumed = outcome instanceof FailedOutcome ? kotlinFailure(target, ((FailedOutcome) outcome).cause) : outcome;
+          resumeWith.invoke(target, resumed);
+        } catch (Exception ignored) {
+        }
+      }
+    });
+
+    if (decision.compareAndSet(UNDECIDED, SUSPENDED)) {
+      return suspendedMarker;
+    }
+
+    Object outcome = earlyOutcome.get();
+    if (outcome instanceof FailedOutcome) {
+      Throwable cause = ((FailedOutcome) outcome).cause;
+      throw cause instanceof Exception ? (Exception) cause : new RuntimeException(cause);
+    }
+    return outcome;
+  }
+
+  private static final int UNDECIDED = 0;
+  private static final int SUSPENDED = 1;
+  private static final int RESUMED = 2;
+
+  private static final class FailedOutcome {
+    final Throwable cause;
+
+    FailedOutcome(Throwable cause) {
+      this.cause = cause;
+    }
+  }
+
+  /** Resumes go through the dispatcher the coroutine runs on, as suspendCoroutine's do. */
+  private static Object intercepted(Object continuation) {
+    try {
+      ClassLoader classLoader = continuation.getClass().getClassLoader();
+      Class<?> continuationClass = Class.forName("kotlin.coroutines.Continuation", true, classLoader);
+      return Class
+        .forName("kotlin.coroutines.intrinsics.IntrinsicsKt", true, classLoader)
+        .getMethod("intercepted", continuationClass)
+        .invoke(null, continuation);
+    } catch (ReflectiveOperationException withoutKotlin) {
+      return continuation;
+    }
+  }
+
+  private static Object kotlinFailure(Object continuation, Throwable failure) {
+    try {
+      Class<?> resultKtClass = Class.forName("kotlin.ResultKt", true, continuation.getClass().getClassLoader());
+      return resultKtClass.getMethod("createFailure", Throwable.class).invoke(null, failure);
+    } catch (Exception ignored) {
+      return failure;
+    }
+  }
+
   private static final BridgeCore CORE = new BridgeCore();
 
   private NuxieBridge() {
@@ -1036,6 +1303,15 @@ public final class NuxieBridge {
     CORE.startTrigger(requestId, eventName, triggerOptionsPayload);
   }
 
+  /**
+   * startTrigger packed by the native bridge into a direct buffer it reuses: UTF-8 request id, NUL,
+   * event name, NUL, then the options payload. Only the first length bytes are valid.
+   */
+  public static void startTriggerPacked(ByteBuffer packed, int length) throws Exception {
+    String[] fields = KvCodec.unpack(packed, length, 3);
+    CORE.startTrigger(fields[0], fields[1], fields[2]);
+  }
+
   public static void cancelTrigger(String requestId) throws Exception {
     CORE.cancelTrigger(requestId);
   }
@@ -1087,6 +1363,10 @@ public final class NuxieBridge {
     CORE.resumeEventQueue();
   }
 
+  public static void updateRuntimeOptions(String optionsPayload) throws Exception {
+    CORE.updateRuntimeOptions(optionsPayload);
+  }
+
   public static void completePurchase(String requestId, String purchaseResultPayload) throws Exception {
     CORE.completePurchase(requestId, purchaseResultPayload);
   }
@@ -1117,11 +1397,11 @@ public final class NuxieBridge {
   private static native void nativeOnFlowDismissed(long nativeHandle, String payload, long timestampMs);
 
   static final class TriggerOptions {
-    final Map<String, String> properties;
-    final Map<String, String> userProperties;
-    final Map<String, String> userPropertiesSetOnce;
+    final Map<String, Object> properties;
+    final Map<String, Object> userProperties;
+    final Map<String, Object> userPropertiesSetOnce;
 
-    private TriggerOptions(Map<String, String> properties, Map<String, String> userProperties, Map<String, String> userPropertiesSetOnce) {
+    private TriggerOptions(Map<String, Object> properties, Map<String, Object> userProperties, Map<String, Object> userPropertiesSetOnce) {
       this.properties = properties;
       this.userProperties = userProperties;
       this.userPropertiesSetOnce = userPropertiesSetOnce;
@@ -1130,9 +1410,9 @@ public final class NuxieBridge {
     static TriggerOptions fromPayload(String payload) {
       Map<String, String> sections = KvCodec.decodeMap(payload);
       return new TriggerOptions(
-        KvCodec.decodeMap(sections.get("properties")),
-        KvCodec.decodeMap(sections.get("user_properties")),
-        KvCodec.decodeMap(sections.get("user_properties_set_once")));
+        KvCodec.decodeProperties(sections.get("properties")),
+        KvCodec.decodeProperties(sections.get("user_properties")),
+        KvCodec.decodeProperties(sections.get("user_properties_set_once")));
     }
   }
 
@@ -1411,10 +1691,93 @@ public final class NuxieBridge {
         return payload;
       }
       payload.customerId = safeString(invokeGetter(profile, "getCustomerId"));
-      payload.raw = String.valueOf(profile);
+      payload.raw = toJson(payload.customerId, invokeGetter(profile, "getCampaigns"));
       return payload;
     }
 
+    // The native side indexes campaign triggers from this JSON. The `campaigns` array is only
+    // written when the whole list could be read, so a partial list never looks complete.
+    static String toJson(String customerId, Object campaigns) {
+      StringBuilder out = new StringBuilder();
+      out.append("{\"customer_id\":");
+      appendJsonString(out, customerId);
+      if (campaigns instanceof Iterable) {
+        StringBuilder list = new StringBuilder();
+        if (appendCampaigns(list, (Iterable<?>) campaigns)) {
+          out.append(",\"campaigns\":").append(list);
+        }
+      }
+      out.append('}');
+      return out.toString();
+    }
+
+    private static boolean appendCampaigns(StringBuilder out, Iterable<?> campaigns) {
+      out.append('[');
+      boolean first = true;
+      for (Object campaign : campaigns) {
+        Object trigger = invokeGetter(campaign, "getTrigger");
+        if (campaign == null || trigger == null) {
+          return false;
+        }
+        if (!first) {
+          out.append(',');
+        }
+        first = false;
+
+        out.append("{\"id\":");
+        appendJsonString(out, safeString(invokeGetter(campaign, "getId")));
+        out.append(",\"trigger\":{\"type\":");
+        appendJsonString(out, triggerType(trigger));
+        Object eventName = invokeGetter(trigger, "getEventName");
+        if (eventName != null) {
+          out.append(",\"event_name\":");
+          appendJsonString(out, String.valueOf(eventName));
+        }
+        out.append("}}");
+      }
+      out.append(']');
+      return true;
+    }
+
+    // Triggers arrive either with a type getter (string or enum) or as sealed subclasses such as
+    // `CampaignTrigger.Event`; both map to the lower-case wire name.
+    private static String triggerType(Object trigger) {
+      Object type = invokeGetter(trigger, "getType");
+      String name = type != null ? String.valueOf(type) : trigger.getClass().getSimpleName();
+      return name.toLowerCase(Locale.ROOT);
+    }
+
+    private static void appendJsonString(StringBuilder out, String value) {
+      out.append('"');
+      for (int i = 0; i < value.length(); i++) {
+        char c = value.charAt(i);
+        switch (c) {
+          case '"':
+            out.append("\\\"");
+            break;
+          case '\\':
+            out.append("\\\\");
+            break;
+          case '\n':
+            out.append("\\n");
+            break;
+          case '\r':
+            out.append("\\r");
+            break;
+          case '\t':
+            out.append("\\t");
+            break;
+          default:
+            if (c < 0x20) {
+              out.append(String.format(Locale.ROOT, "\\u%04x", (int) c));
+            } else {
+              out.append(c);
+            }
+        }
+      }
+      out.append('"');
+    }
+
     String toPayload() {
       Map<String, String> out = new LinkedHashMap<String, String>();
       out.put("customer_id", customerId);
@@ -1625,6 +1988,63 @@ public final class NuxieBridge {
       return out;
     }
 
+    /**
+     * Decodes a decodeMap payload whose values carry a type tag written by
+     * FNuxieAndroidBridge::EncodeProperties: i (Long), d (Double), b (Boolean, "1"/"0") or s (String).
+     */
+    static Map<String, Object> decodeProperties(String encoded) {
+      Map<String, Object> out = new LinkedHashMap<String, Object>();
+      for (Map.Entry<String, String> entry : decodeMap(encoded).entrySet()) {
+        out.put(entry.getKey(), decodeTypedValue(entry.getValue()));
+      }
+      return out;
+    }
+
+    /** Splits the first length bytes of packed into fieldCount UTF-8 strings separated by NUL bytes. */
+    static String[] unpack(ByteBuffer packed, int length, int fieldCount) {
+      byte[] bytes = new byte[length];
+      ByteBuffer view = packed.duplicate();
+      view.clear();
+      view.get(bytes, 0, length);
+
+      String[] fields = new String[fieldCount];
+      int start = 0;
+      for (int index = 0; index < fieldCount - 1; index++) {
+        int end = start;
+        while (end < length && bytes[end] != 0) {
+          end++;
+        }
+        fields[index] = new String(bytes, start, end - start, StandardCharsets.UTF_8);
+        start = Math.min(end + 1, length);
+      }
+      fields[fieldCount - 1] = new String(bytes, start, length - start, StandardCharsets.UTF_8);
+      return fields;
+    }
+
+    static Object decodeTypedValue(String tagged) {
+      if (tagged == null || tagged.isEmpty()) {
+        return "";
+      }
+
+      String value = tagged.substring(1);
+      try {
+        switch (tagged.charAt(0)) {
+          case 'i':
+            return Long.valueOf(Long.parseLong(value));
+          case 'd':
+            return Double.valueOf(Double.parseDouble(value));
+          case 'b':
+            return Boolean.valueOf("1".equals(value));
+          case 's':
+            return value;
+          default:
+            return tagged;
+        }
+      } catch (NumberFormatException ignored) {
+        return value;
+      }
+    }
+
     private static String encode(String value) {
       return URLEncoder.encode(value == null ? "" : value, StandardCharsets.UTF_8);
     }
@@ -1,9 +1,13 @@
 package io.nuxie.unreal;
 
+import java.nio.ByteBuffer;
+import java.nio.charset.StandardCharsets;
 import java.util.ArrayList;
+import java.util.Collections;
 import java.util.List;
 import java.util.Map;
 import java.util.concurrent.CompletableFuture;
+import java.util.concurrent.CountDownLatch;
 import java.util.concurrent.TimeUnit;
 
 public final class NuxieBridgeContractTest {
@@ -53,6 +57,12 @@ public final class NuxieBridgeContractTest {
   private static final class FakeRuntime implements NuxieBridge.Runtime {
     NuxieBridge.RuntimeCallbacks callbacks;
     String distinctId = "anon_test";
+    Map<String, String> runtimeOptions;
+    Map<String, Object> userProperties;
+    String triggerRequestId;
+    String triggerEventName;
+    Map<String, Object> triggerProperties;
+    Map<String, Object> usageMetadata;
 
     @Override
     public void configure(String apiKey, Map<String, String> options, boolean usePurchaseController, NuxieBridge.RuntimeCallbacks callbacks) {
@@ -64,8 +74,9 @@ public final class NuxieBridgeContractTest {
     }
 
     @Override
-    public void identify(String distinctId, Map<String, String> userProperties, Map<String, String> userPropertiesSetOnce) {
+    public void identify(String distinctId, Map<String, Object> userProperties, Map<String, Object> userPropertiesSetOnce) {
       this.distinctId = distinctId;
+      this.userProperties = userProperties;
     }
 
     @Override
@@ -90,6 +101,9 @@ public final class NuxieBridgeContractTest {
 
     @Override
     public void startTrigger(String requestId, String eventName, NuxieBridge.TriggerOptions triggerOptions) {
+      this.triggerRequestId = requestId;
+      this.triggerEventName = eventName;
+      this.triggerProperties = triggerOptions.properties;
       NuxieBridge.TriggerUpdatePayload nonTerminal = new NuxieBridge.TriggerUpdatePayload();
       nonTerminal.kind = "decision";
       nonTerminal.decisionKind = "flow_shown";
@@ -141,7 +155,8 @@ public final class NuxieBridgeContractTest {
     }
 
     @Override
-    public void useFeature(String featureId, double amount, String entityId, Map<String, String> metadata) {
+    public void useFeature(String featureId, double amount, String entityId, Map<String, Object> metadata) {
+      this.usageMetadata = metadata;
     }
 
     @Override
@@ -150,7 +165,7 @@ public final class NuxieBridgeContractTest {
       double amount,
       String entityId,
       boolean setUsage,
-      Map<String, String> metadata) {
+      Map<String, Object> metadata) {
       NuxieBridge.FeatureUsagePayload payload = new NuxieBridge.FeatureUsagePayload();
       payload.success = true;
       payload.featureId = featureId;
@@ -176,6 +191,11 @@ public final class NuxieBridgeContractTest {
     public void resumeEventQueue() {
     }
 
+    @Override
+    public void updateRuntimeOptions(Map<String, String> options) {
+      this.runtimeOptions = options;
+    }
+
     @Override
     public void completePurchase(String requestId, NuxieBridge.PurchaseResultPayload result) {
     }
@@ -185,31 +205,26 @@ public final class NuxieBridgeContractTest {
     }
 
     CompletableFuture<NuxieBridge.PurchaseResultPayload> awaitPurchase(long timeoutMs) {
-      final CompletableFuture<NuxieBridge.PurchaseResultPayload> future = new CompletableFuture<NuxieBridge.PurchaseResultPayload>();
-      final NuxieBridge.PurchaseRequestPayload req = NuxieBridge.PurchaseRequestPayload.create("pro_monthly");
-      new Thread(new Runnable() {
-        @Override
-        public void run() {
-          NuxieBridge.PurchaseResultPayload result = callbacks.awaitPurchaseResult(req, timeoutMs);
-          future.complete(result);
-        }
-      }).start();
-      future.whenComplete((r, e) -> {
-      });
-      return future;
+      NuxieBridge.PurchaseRequestPayload req = NuxieBridge.PurchaseRequestPayload.create("pro_monthly");
+      return callbacks.requestPurchaseResult(req, timeoutMs);
     }
 
     CompletableFuture<NuxieBridge.RestoreResultPayload> awaitRestore(long timeoutMs) {
-      final CompletableFuture<NuxieBridge.RestoreResultPayload> future = new CompletableFuture<NuxieBridge.RestoreResultPayload>();
-      final NuxieBridge.RestoreRequestPayload req = NuxieBridge.RestoreRequestPayload.create();
-      new Thread(new Runnable() {
-        @Override
-        public void run() {
-          NuxieBridge.RestoreResultPayload result = callbacks.awaitRestoreResult(req, timeoutMs);
-          future.complete(result);
-        }
-      }).start();
-      return future;
+      NuxieBridge.RestoreRequestPayload req = NuxieBridge.RestoreRequestPayload.create();
+      return callbacks.requestRestoreResult(req, timeoutMs);
+    }
+  }
+
+  /** Stands in for a kotlin.coroutines.Continuation; the JVM tests run without the Kotlin runtime. */
+  public static final class RecordingContinuation {
+    final CountDownLatch resumed = new CountDownLatch(1);
+    volatile Object result;
+    volatile String resumedOn = "";
+
+    public void resumeWith(Object value) {
+      result = value;
+      resumedOn = Thread.currentThread().getName();
+      resumed.countDown();
     }
   }
 
@@ -218,6 +233,12 @@ public final class NuxieBridgeContractTest {
     testTriggerEmission();
     testPurchaseAndRestoreCompletion();
     testPurchaseAndRestoreTimeout();
+    testPurchaseTimeoutFromConfigure();
+    testSuspendedPurchaseDelegate();
+    testRuntimeOptionsUpdate();
+    testTypedProperties();
+    testPackedTriggerStart();
+    testProfileCampaignsJson();
     System.out.println("NuxieBridgeContractTest: all tests passed");
   }
 
@@ -308,6 +329,216 @@ public final class NuxieBridgeContractTest {
     assertEquals("failed", restoreResult.kind, "restore timeout should fail");
   }
 
+  private static void testSuspendedPurchaseDelegate() throws Exception {
+    FakeRuntime runtime = new FakeRuntime();
+    RecordingEmitter emitter = new RecordingEmitter();
+    NuxieBridge.setRuntimeForTesting(runtime);
+    NuxieBridge.setEmitterForTesting(emitter);
+    NuxieBridge.configure("NX_TEST", "", true, "0.1.0-test");
+
+    Object suspended = new Object();
+    RecordingContinuation continuation = new RecordingContinuation();
+    Object returned = NuxieBridge.suspendUntilComplete(
+      continuation,
+      runtime.awaitPurchase(2000),
+      new NuxieBridge.ResultMapper<NuxieBridge.PurchaseResultPayload>() {
+        @Override
+        public Object map(NuxieBridge.PurchaseResultPayload result) {
+          return result.kind;
+        }
+      },
+      suspended);
+    assertTrue(returned == suspended, "pending purchase should suspend instead of blocking");
+    assertEquals(1, emitter.purchaseRequests, "purchase request should emit before suspending");
+    assertEquals(1L, continuation.resumed.getCount(), "continuation should not resume before completion");
+
+    NuxieBridge.PurchaseResultPayload purchaseResult = new NuxieBridge.PurchaseResultPayload();
+    purchaseResult.kind = "success";
+    String purchaseRequestId = NuxieBridge.KvCodec.decodeMap(emitter.purchasePayloads.get(0)).get("request_id");
+    NuxieBridge.completePurchase(purchaseRequestId, purchaseResult.toPayload());
+
+    assertTrue(continuation.resumed.await(2, TimeUnit.SECONDS), "completion should resume the continuation");
+    assertEquals("success", continuation.result, "continuation should resume with the mapped result");
+
+    RecordingContinuation alreadyDone = new RecordingContinuation();
+    NuxieBridge.PurchaseResultPayload donePayload = new NuxieBridge.PurchaseResultPayload();
+    donePayload.kind = "cancelled";
+    Object doneReturned = NuxieBridge.suspendUntilComplete(
+      alreadyDone,
+      CompletableFuture.completedFuture(donePayload),
+      new NuxieBridge.ResultMapper<NuxieBridge.PurchaseResultPayload>() {
+        @Override
+        public Object map(NuxieBridge.PurchaseResultPayload result) {
+          return result.kind;
+        }
+      },
+      suspended);
+    assertEquals("cancelled", doneReturned, "a finished future should return its result without suspending");
+    assertEquals(1L, alreadyDone.resumed.getCount(), "a result returned directly should not also resume");
+
+    RecordingContinuation timedOut = new RecordingContinuation();
+    NuxieBridge.suspendUntilComplete(
+      timedOut,
+      runtime.awaitRestore(60),
+      new NuxieBridge.ResultMapper<NuxieBridge.RestoreResultPayload>() {
+        @Override
+        public Object map(NuxieBridge.RestoreResultPayload result) {
+          return result.kind;
+        }
+      },
+      suspended);
+    assertTrue(timedOut.resumed.await(2, TimeUnit.SECONDS), "timeout should resume the continuation");
+    assertEquals("failed", timedOut.result, "timed out restore should resume failed");
+    assertEquals("nuxie-request-timeouts", timedOut.resumedOn, "timeout should fire without a waiting thread");
+  }
+
+  private static void testPurchaseTimeoutFromConfigure() throws Exception {
+    FakeRuntime runtime = new FakeRuntime();
+    NuxieBridge.setRuntimeForTesting(runtime);
+    NuxieBridge.setEmitterForTesting(new RecordingEmitter());
+
+    NuxieBridge.configure("NX_TEST", "purchase_timeout_seconds=42", true, "0.1.0-test");
+    assertEquals(42_000L, runtime.callbacks.purchaseTimeoutMillis(), "purchase timeout should come from Unreal");
+
+    NuxieBridge.configure("NX_TEST", "", true, "0.1.0-test");
+    assertEquals(60_000L, runtime.callbacks.purchaseTimeoutMillis(), "purchase timeout should default to 60 seconds");
+  }
+
+  private static void testRuntimeOptionsUpdate() throws Exception {
+    FakeRuntime runtime = new FakeRuntime();
+    NuxieBridge.setRuntimeForTesting(runtime);
+    NuxieBridge.setEmitterForTesting(new RecordingEmitter());
+
+    NuxieBridge.configure("NX_TEST", "", false, "0.1.0-test");
+    NuxieBridge.updateRuntimeOptions("event_batch_size=100&flush_at=5&flush_interval_seconds=10");
+
+    assertEquals("100", runtime.runtimeOptions.get("event_batch_size"), "batch size should reach the runtime");
+    assertEquals("5", runtime.runtimeOptions.get("flush_at"), "flush threshold should reach the runtime");
+    assertEquals("10", runtime.runtimeOptions.get("flush_interval_seconds"), "flush interval should reach the runtime");
+  }
+
+  private static void testTypedProperties() throws Exception {
+    FakeRuntime runtime = new FakeRuntime();
+    NuxieBridge.setRuntimeForTesting(runtime);
+    NuxieBridge.setEmitterForTesting(new RecordingEmitter());
+    NuxieBridge.configure("NX_TEST", "", false, "0.1.0-test");
+
+    NuxieBridge.identify("user_1", "level=i12&ratio=d0.5&vip=b1&name=sAda%20L&tagless=x", "");
+    assertEquals(Long.valueOf(12L), runtime.userProperties.get("level"), "int property should arrive as Long");
+    assertEquals(Double.valueOf(0.5), runtime.userProperties.get("ratio"), "double property should arrive as Double");
+    assertEquals(Boolean.TRUE, runtime.userProperties.get("vip"), "bool property should arrive as Boolean");
+    assertEquals("Ada L", runtime.userProperties.get("name"), "string property should arrive decoded");
+    assertEquals("x", runtime.userProperties.get("tagless"), "untagged value should pass through as a string");
+
+    String options = NuxieBridge.KvCodec.encodeMap(Collections.singletonMap("properties", "score=i-3&empty=s"));
+    NuxieBridge.startTrigger("req-typed", "event_a", options);
+    assertEquals(Long.valueOf(-3L), runtime.triggerProperties.get("score"), "trigger property should arrive as Long");
+    assertEquals("", runtime.triggerProperties.get("empty"), "empty string property should survive");
+
+    NuxieBridge.useFeature("coins", 1.0, "", "first=b0");
+    assertEquals(Boolean.FALSE, runtime.usageMetadata.get("first"), "usage metadata should keep its type");
+
+    // As written by FormatTaggedDouble: 17 significant digits, no '+' in a positive exponent. A '+'
+    // that is percent-encoded decodes too; a raw one would arrive as a space.
+    NuxieBridge.identify("user_1", "big=d1e20&encoded=d1e%2B20&small=d-2.5e-08&precise=d0.10000000000000001", "");
+    assertEquals(Double.valueOf(1e20), runtime.userProperties.get("big"), "positive exponent should survive decoding");
+    assertEquals(Double.valueOf(1e20), runtime.userProperties.get("encoded"), "percent-encoded '+' should survive decoding");
+    assertEquals(Double.valueOf(-2.5e-8), runtime.userProperties.get("small"), "negative exponent should survive decoding");
+    assertEquals(Double.valueOf(0.1), runtime.userProperties.get("precise"), "17 significant digits should round-trip");
+
+    String exponentOptions = NuxieBridge.KvCodec.encodeMap(Collections.singletonMap("properties", "distance=d1.5e300"));
+    NuxieBridge.startTrigger("req-exponent", "event_a", exponentOptions);
+    assertEquals(Double.valueOf(1.5e300), runtime.triggerProperties.get("distance"), "exponent should survive the nested trigger encoding");
+  }
+
+  private static void testPackedTriggerStart() throws Exception {
+    FakeRuntime runtime = new FakeRuntime();
+    NuxieBridge.setRuntimeForTesting(runtime);
+    NuxieBridge.setEmitterForTesting(new RecordingEmitter());
+    NuxieBridge.configure("NX_TEST", "", false, "0.1.0-test");
+
+    String options = NuxieBridge.KvCodec.encodeMap(Collections.singletonMap("properties", "level=i7&city=sK%C3%B6ln"));
+    byte[] fields = ("0123abcd-1f\0level_\u00e9\0" + options).getBytes(StandardCharsets.UTF_8);
+    ByteBuffer packed = ByteBuffer.allocateDirect(fields.length + 16);
+    packed.put(fields);
+    packed.put((byte) 'x');
+
+    NuxieBridge.startTriggerPacked(packed, fields.length);
+    assertEquals("0123abcd-1f", runtime.triggerRequestId, "packed request id should be decoded");
+    assertEquals("level_\u00e9", runtime.triggerEventName, "packed event name should be decoded as UTF-8");
+    assertEquals(Long.valueOf(7L), runtime.triggerProperties.get("level"), "packed properties should keep their type");
+    assertEquals("K\u00f6ln", runtime.triggerProperties.get("city"), "bytes past length should be ignored");
+  }
+
+  public static final class FakeTrigger {
+    private final String type;
+    private final String eventName;
+
+    FakeTrigger(String type, String eventName) {
+      this.type = type;
+      this.eventName = eventName;
+    }
+
+    public String getType() {
+      return type;
+    }
+
+    public String getEventName() {
+      return eventName;
+    }
+  }
+
+  public static final class FakeCampaign {
+    private final String id;
+    private final FakeTrigger trigger;
+
+    FakeCampaign(String id, FakeTrigger trigger) {
+      this.id = id;
+      this.trigger = trigger;
+    }
+
+    public String getId() {
+      return id;
+    }
+
+    public FakeTrigger getTrigger() {
+      return trigger;
+    }
+  }
+
+  public static final class FakeProfile {
+    private final List<FakeCampaign> campaigns;
+
+    FakeProfile(List<FakeCampaign> campaigns) {
+      this.campaigns = campaigns;
+    }
+
+    public String getCustomerId() {
+      return "customer_1";
+    }
+
+    public List<FakeCampaign> getCampaigns() {
+      return campaigns;
+    }
+  }
+
+  private static void testProfileCampaignsJson() {
+    List<FakeCampaign> campaigns = new ArrayList<FakeCampaign>();
+    campaigns.add(new FakeCampaign("c1", new FakeTrigger("EVENT", "level_\"done\"")));
+    campaigns.add(new FakeCampaign("c2", new FakeTrigger("segment", null)));
+
+    NuxieBridge.ProfilePayload payload = NuxieBridge.ProfilePayload.fromProfile(new FakeProfile(campaigns));
+    assertEquals(
+        "{\"customer_id\":\"customer_1\",\"campaigns\":["
+            + "{\"id\":\"c1\",\"trigger\":{\"type\":\"event\",\"event_name\":\"level_\\\"done\\\"\"}},"
+            + "{\"id\":\"c2\",\"trigger\":{\"type\":\"segment\"}}]}",
+        payload.raw,
+        "profile raw should carry the campaigns as JSON");
+
+    NuxieBridge.ProfilePayload unreadable = NuxieBridge.ProfilePayload.fromProfile(new FakeProfile(null));
+    assertEquals("{\"customer_id\":\"customer_1\"}", unreadable.raw, "unreadable campaigns should be omitted");
+  }
+
   private static void assertTrue(boolean condition, String message) {
     if (!condition) {
       throw new AssertionError(message);
@@ -0,0 +1,141 @@
+#!/usr/bin/env node
+import http from 'node:http';
+import process from 'node:process';
+import { fileURLToPath } from 'node:url';
+import zlib from 'node:zlib';
+
+// Local stand-in for the Nuxie HTTP API used by FNuxieHttpBridge
+// (Source/Nuxie/Private/Platform/Http). See docs/http-bridge.md.
+//
+//   node ./scripts/mock-nuxie-server.mjs --port 8787 [--fail-first 2] [--profile profile.json]
+//
+// Every request is recorded on `server.requests` (and logged when run from the command line).
+// `--fail-first N` answers the first N requests with 503 to exercise the bridge's retries, with
+// `Retry-After: <retryAfter>` (0 unless given).
+
+export function createMockServer({ failFirst = 0, retryAfter = '0', profile = {}, log = () => {} } = {}) {
+  const state = {
+    requests: [],
+    events: [],
+    failuresLeft: failFirst,
+    profile,
+  };
+
+  const routes = {
+    '/v1/batch': (body) => {
+      const batch = Array.isArray(body.batch) ? body.batch : [];
+      state.events.push(...batch);
+      return { status: 'ok', accepted: batch.length };
+    },
+    '/v1/profile': (body) => ({ customer_id: body.distinct_id, ...state.profile }),
+    '/v1/entitled': (body) => {
+      const feature = (state.profile.features ?? []).find((row) => row.id === body.feature_id);
+      const required = body.required_balance ?? 1;
+      const type = feature?.type ?? 'boolean';
+      const hasBalance = typeof feature?.balance === 'number';
+      const allowed = feature !== undefined && (type === 'boolean'
+        ? feature.granted !== false
+        : feature.unlimited === true || (hasBalance && feature.balance >= required));
+      return {
+        customer_id: body.distinct_id,
+        feature_id: body.feature_id,
+        required_balance: required,
+        code: feature ? 'ok' : 'feature_not_found',
+        allowed,
+        unlimited: feature?.unlimited === true,
+        ...(hasBalance ? { balance: feature.balance } : {}),
+        type,
+      };
+    },
+    '/v1/usage': (body) => {
+      const feature = (state.profile.features ?? []).find((row) => row.id === body.feature_id);
+      if (feature && typeof feature.balance === 'number') {
+        feature.balance = body.set_usage ? body.amount : feature.balance - body.amount;
+      }
+      return {
+        success: feature !== undefined,
+        feature_id: body.feature_id,
+        amount_used: body.amount,
+        message: feature ? '' : 'feature_not_found',
+        ...(feature && typeof feature.balance === 'number'
+          ? { usage: { current: body.amount, remaining: feature.balance } }
+          : {}),
+      };
+    },
+  };
+
+  const server = http.createServer((req, res) => {
+    const chunks = [];
+    req.on('data', (chunk) => chunks.push(chunk));
+    req.on('end', () => {
+      let raw = Buffer.concat(chunks);
+      const gzip = req.headers['content-encoding'] === 'gzip';
+      if (gzip) {
+        raw = zlib.gunzipSync(raw);
+      }
+
+      let body;
+      try {
+        body = raw.length > 0 ? JSON.parse(raw.toString('utf8')) : {};
+      } catch {
+        res.writeHead(400).end();
+        return;
+      }
+
+      const record = {
+        path: req.url,
+        gzip,
+        bytes: chunks.reduce((sum, chunk) => sum + chunk.length, 0),
+        authorization: req.headers.authorization,
+        keepAlive: req.headers.connection === 'keep-alive',
+        receivedAt: performance.now(),
+        body,
+      };
+      state.requests.push(record);
+      log(`${req.method} ${req.url} ${record.bytes}B${gzip ? ' gzip' : ''}`);
+
+      if (state.failuresLeft > 0) {
+        state.failuresLeft -= 1;
+        res.writeHead(503, { 'Retry-After': retryAfter }).end();
+        return;
+      }
+
+      const route = routes[req.url];
+      if (!route || req.method !== 'POST') {
+        res.writeHead(404).end();
+        return;
+      }
+      if (!req.headers.authorization?.startsWith('Bearer ')) {
+        res.writeHead(401).end();
+        return;
+      }
+
+      res.writeHead(200, { 'Content-Type': 'application/json' });
+      res.end(JSON.stringify(route(body)));
+    });
+  });
+
+  server.keepAliveTimeout = 30000;
+  server.state = state;
+  return server;
+}
+
+function parseArgs(argv) {
+  const args = { port: 8787, failFirst: 0, profile: undefined };
+  for (let i = 0; i < argv.length; i += 1) {
+    if (argv[i] === '--port') args.port = Number(argv[++i]);
+    else if (argv[i] === '--fail-first') args.failFirst = Number(argv[++i]);
+    else if (argv[i] === '--profile') args.profile = argv[++i];
+  }
+  return args;
+}
+
+if (process.argv[1] === fileURLToPath(import.meta.url)) {
+  const args = parseArgs(process.argv.slice(2));
+  const { readFileSync } = await import('node:fs');
+  const profile = args.profile ? JSON.parse(readFileSync(args.profile, 'utf8')) : {};
+  const server = createMockServer({ failFirst: args.failFirst, profile, log: console.log });
+  server.listen(args.port, '127.0.0.1', () => {
+    console.log(`Mock Nuxie API listening on http://127.0.0.1:${args.port}`);
+  });
+}
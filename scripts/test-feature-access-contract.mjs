@@ -0,0 +1,68 @@
+#!/usr/bin/env node
+import fs from 'node:fs';
+import path from 'node:path';
+import process from 'node:process';
+
+// Mirrors FNuxieEntitlementEvaluator (Source/Nuxie/Private/NuxieEntitlementEvaluator.cpp).
+function evaluateRow(row, requiredBalance) {
+  const type = row.type ?? 'boolean';
+  const unlimited = row.unlimited === true;
+  const hasBalance = typeof row.balance === 'number';
+  const balance = hasBalance ? row.balance : 0;
+  let allowed;
+  if (type === 'boolean') {
+    allowed = row.granted !== false;
+  } else if (unlimited || hasBalance) {
+    allowed = unlimited || balance >= requiredBalance;
+  } else {
+    // A profile grant answers the default requirement of one; a grant covers smaller requirements
+    // and a denial larger ones.
+    allowed = row.granted === true;
+    if (allowed ? requiredBalance > 1 : requiredBalance < 1) {
+      return { known: false };
+    }
+  }
+
+  return { known: true, allowed, unlimited, hasBalance, balance, type };
+}
+
+function evaluate(features, featureId, requiredBalance, entityId) {
+  const feature = features[featureId];
+  if (feature) {
+    const type = feature.type ?? 'boolean';
+    if (!entityId || type === 'boolean' || feature.unlimited === true) {
+      return evaluateRow(feature, requiredBalance);
+    }
+  }
+
+  if (!entityId) {
+    return { known: false };
+  }
+
+  const entity = feature?.entities?.[entityId];
+  if (!entity) {
+    return { known: false };
+  }
+
+  return evaluateRow({ ...entity, type: feature.type }, requiredBalance);
+}
+
+const fixturePath = path.resolve(process.cwd(), 'tests/fixtures/feature_access_cases.json');
+const cases = JSON.parse(fs.readFileSync(fixturePath, 'utf8'));
+
+let failures = 0;
+for (const testCase of cases) {
+  const actual = evaluate(testCase.features, testCase.featureId, testCase.requiredBalance, testCase.entityId);
+  const expected = testCase.expected;
+  const mismatched = Object.keys(expected).filter((key) => actual[key] !== expected[key]);
+  if (mismatched.length > 0) {
+    failures += 1;
+    console.error(`[FAIL] ${testCase.name}: expected ${JSON.stringify(expected)}, got ${JSON.stringify(actual)}`);
+  }
+}
+
+if (failures > 0) {
+  process.exit(1);
+}
+
+console.log(`Feature access contract tests passed (${cases.length} cases)`);
@@ -0,0 +1,283 @@
+#!/usr/bin/env node
+import assert from 'node:assert/strict';
+import http from 'node:http';
+import process from 'node:process';
+import zlib from 'node:zlib';
+import { createMockServer } from './mock-nuxie-server.mjs';
+
+// Mirrors FNuxieHttpTransport and the event queue in FNuxieHttpSession
+// (Source/Nuxie/Private/Platform/Http) step for step, including retry backoff and the batch kept
+// in flight, and runs them against the local mock API. When you change either, update this script
+// to match.
+
+const MinCompressBytes = 1024;
+const MaxRetryDelaySeconds = 60;
+const agent = new http.Agent({ keepAlive: true, maxSockets: 1 });
+
+const isSuccess = (status) => status >= 200 && status < 300;
+const isRetryable = (status) => status === 0 || status === 408 || status === 429 || status >= 500;
+const sleep = (seconds) => new Promise((resolve) => setTimeout(resolve, seconds * 1000));
+
+// FNuxieHttpTransport::ScheduleRetry: RetryDelaySeconds doubled per attempt, +/-20% jitter, a
+// longer Retry-After wins, capped at MaxRetryDelaySeconds.
+function retryDelaySeconds(retryDelay, attempt, retryAfter, random = Math.random) {
+  const backoff = retryDelay * 2 ** attempt;
+  const jitter = 0.8 + random() * 0.4;
+  return Math.min(Math.max(backoff * jitter, retryAfter), MaxRetryDelaySeconds);
+}
+
+function send(baseUrl, path, payload, compress) {
+  let body = Buffer.from(payload, 'utf8');
+  const headers = {
+    'Content-Type': 'application/json',
+    Authorization: 'Bearer test-key',
+    Connection: 'keep-alive',
+  };
+  if (compress && body.length >= MinCompressBytes) {
+    body = zlib.gzipSync(body);
+    headers['Content-Encoding'] = 'gzip';
+  }
+
+  return new Promise((resolve) => {
+    const req = http.request(`${baseUrl}${path}`, { method: 'POST', headers, agent }, (res) => {
+      const chunks = [];
+      res.on('data', (chunk) => chunks.push(chunk));
+      res.on('end', () => resolve({
+        status: res.statusCode,
+        retryAfter: Number.parseFloat(res.headers['retry-after'] ?? '0') || 0,
+        body: Buffer.concat(chunks).toString('utf8'),
+      }));
+    });
+    req.on('error', () => resolve({ status: 0, retryAfter: 0, body: '' }));
+    req.end(body);
+  });
+}
+
+// FNuxieHttpTransport::Post and Send.
+async function post(settings, path, json) {
+  const payload = JSON.stringify(json);
+  for (let attempt = 0; ; attempt += 1) {
+    const response = await send(settings.baseUrl, path, payload, settings.compress);
+    if (!isRetryable(response.status) || attempt >= settings.retryCount) {
+      return response;
+    }
+    await sleep(retryDelaySeconds(settings.retryDelay ?? 2, attempt, response.retryAfter, settings.random));
+  }
+}
+
+// The event queue of FNuxieHttpSession: Track, TrimQueue, Flush, SendNextBatch and OnBatchComplete.
+class EventQueue {
+  constructor(settings, options) {
+    this.settings = settings;
+    this.options = { flushAt: Number.MAX_SAFE_INTEGER, ...options };
+    this.pending = [];
+    this.inFlightCount = 0;
+    this.drainRequested = false;
+    this.paused = false;
+    this.waiters = [];
+  }
+
+  track(event) {
+    this.pending.push(event);
+    this.trim();
+    if (!this.paused && this.pending.length >= this.options.flushAt) {
+      this.flush();
+    }
+  }
+
+  // Drops the oldest events beyond MaxQueueSize, never the batch in flight.
+  trim() {
+    const excess = this.pending.length - Math.max(this.options.maxQueueSize, this.inFlightCount);
+    if (excess > 0) {
+      this.pending.splice(this.inFlightCount, excess);
+    }
+  }
+
+  flush() {
+    return new Promise((resolve) => {
+      this.waiters.push(resolve);
+      this.drainRequested = true;
+      if (this.inFlightCount === 0) {
+        this.sendNextBatch();
+      }
+    });
+  }
+
+  async sendNextBatch() {
+    if (this.pending.length === 0) {
+      this.drainRequested = false;
+      this.finish(true);
+      return;
+    }
+
+    this.inFlightCount = Math.min(this.pending.length, Math.max(this.options.eventBatchSize, 1));
+    const response = await post(this.settings, '/v1/batch', { batch: this.pending.slice(0, this.inFlightCount) });
+    this.onBatchComplete(response.status);
+  }
+
+  onBatchComplete(status) {
+    if (isSuccess(status) || !isRetryable(status)) {
+      this.pending.splice(0, this.inFlightCount);
+    }
+    this.inFlightCount = 0;
+
+    if (isSuccess(status) && this.pending.length > 0 && (this.drainRequested || this.pending.length >= this.options.flushAt)) {
+      this.sendNextBatch();
+      return;
+    }
+
+    this.drainRequested = false;
+    this.trim();
+    this.finish(isSuccess(status));
+  }
+
+  finish(success) {
+    const waiters = this.waiters;
+    this.waiters = [];
+    waiters.forEach((resolve) => resolve(success));
+  }
+}
+
+async function withServer(options, run) {
+  const server = createMockServer(options);
+  await new Promise((resolve) => server.listen(0, '127.0.0.1', resolve));
+  const baseUrl = `http://127.0.0.1:${server.address().port}`;
+  try {
+    await run(baseUrl, server.state);
+  } finally {
+    agent.destroy();
+    server.closeAllConnections();
+    await new Promise((resolve) => server.close(resolve));
+  }
+}
+
+const makeEvent = (index) => ({ uuid: `e${index}`, event: 'level_complete', distinct_id: 'anon_1', properties: { level: String(index) } });
+
+const cases = {
+  'batches events in order, EventBatchSize at a time': async () => withServer({}, async (baseUrl, state) => {
+    const queue = new EventQueue({ baseUrl, retryCount: 3, compress: true }, { eventBatchSize: 20, maxQueueSize: 1000 });
+    for (let i = 0; i < 45; i += 1) queue.track(makeEvent(i));
+    assert.equal(await queue.flush(), true);
+    assert.deepEqual(state.requests.map((r) => r.body.batch.length), [20, 20, 5]);
+    assert.deepEqual(state.events.map((e) => e.uuid), Array.from({ length: 45 }, (_, i) => `e${i}`));
+    assert.equal(queue.pending.length, 0);
+  }),
+
+  'gzips bodies at or above MinCompressBytes only': async () => withServer({}, async (baseUrl, state) => {
+    const settings = { baseUrl, retryCount: 0, compress: true };
+    await post(settings, '/v1/batch', { batch: [makeEvent(0)] });
+    await post(settings, '/v1/batch', { batch: Array.from({ length: 30 }, (_, i) => makeEvent(i)) });
+    assert.deepEqual(state.requests.map((r) => r.gzip), [false, true]);
+    assert.equal(state.events.length, 31);
+    assert.ok(state.requests.every((r) => r.keepAlive && r.authorization === 'Bearer test-key'));
+  }),
+
+  'retries 503 up to RetryCount and keeps events when exhausted': async () => {
+    await withServer({ failFirst: 2 }, async (baseUrl, state) => {
+      const queue = new EventQueue({ baseUrl, retryCount: 3, retryDelay: 0.01, compress: true }, { eventBatchSize: 50, maxQueueSize: 1000 });
+      queue.track(makeEvent(0));
+      assert.equal(await queue.flush(), true);
+      assert.equal(state.requests.length, 3);
+    });
+    await withServer({ failFirst: 10 }, async (baseUrl, state) => {
+      const queue = new EventQueue({ baseUrl, retryCount: 3, retryDelay: 0.01, compress: true }, { eventBatchSize: 50, maxQueueSize: 1000 });
+      queue.track(makeEvent(0));
+      assert.equal(await queue.flush(), false);
+      assert.equal(state.requests.length, 4);
+      assert.equal(queue.pending.length, 1);
+    });
+  },
+
+  'backs off exponentially with jitter, honours Retry-After and caps at 60 s': async () => {
+    assert.equal(retryDelaySeconds(2, 0, 0, () => 0.5), 2);
+    assert.equal(retryDelaySeconds(2, 3, 0, () => 0.5), 16);
+    assert.ok(Math.abs(retryDelaySeconds(2, 0, 0, () => 0) - 1.6) < 1e-9);
+    assert.ok(Math.abs(retryDelaySeconds(2, 0, 0, () => 1) - 2.4) < 1e-9);
+    assert.equal(retryDelaySeconds(2, 0, 30, () => 0.5), 30);
+    assert.equal(retryDelaySeconds(2, 10, 0, () => 0.5), 60);
+
+    await withServer({ failFirst: 3 }, async (baseUrl, state) => {
+      await post({ baseUrl, retryCount: 3, retryDelay: 0.05, compress: false, random: () => 0.5 }, '/v1/batch', { batch: [] });
+      const gaps = state.requests.slice(1).map((r, i) => (r.receivedAt - state.requests[i].receivedAt) / 1000);
+      gaps.forEach((gap, attempt) => assert.ok(gap >= 0.05 * 2 ** attempt - 0.005, `retry ${attempt} waited ${gap}s`));
+    });
+
+    await withServer({ failFirst: 1, retryAfter: '0.2' }, async (baseUrl, state) => {
+      await post({ baseUrl, retryCount: 1, retryDelay: 0.01, compress: false }, '/v1/batch', { batch: [] });
+      assert.ok(state.requests[1].receivedAt - state.requests[0].receivedAt >= 195, 'Retry-After is honoured');
+    });
+  },
+
+  'drops the oldest events beyond MaxQueueSize': async () => {
+    const queue = new EventQueue({}, { eventBatchSize: 50, maxQueueSize: 3 });
+    for (let i = 0; i < 5; i += 1) queue.track(makeEvent(i));
+    assert.deepEqual(queue.pending.map((e) => e.uuid), ['e2', 'e3', 'e4']);
+  },
+
+  'never trims the batch in flight': async () => withServer({}, async (baseUrl, state) => {
+    const queue = new EventQueue({ baseUrl, retryCount: 0, compress: false }, { eventBatchSize: 3, maxQueueSize: 3 });
+    for (let i = 0; i < 3; i += 1) queue.track(makeEvent(i));
+    const flushed = queue.flush();
+    for (let i = 3; i < 8; i += 1) queue.track(makeEvent(i));
+    assert.deepEqual(queue.pending.map((e) => e.uuid), ['e0', 'e1', 'e2'], 'the batch in flight is kept whole');
+    assert.equal(await flushed, true);
+    assert.deepEqual(state.events.map((e) => e.uuid), ['e0', 'e1', 'e2']);
+  }),
+
+  'keeps a failed batch queued and trims behind it': async () => withServer({ failFirst: 1 }, async (baseUrl, state) => {
+    const queue = new EventQueue({ baseUrl, retryCount: 0, compress: false }, { eventBatchSize: 2, maxQueueSize: 2 });
+    queue.track(makeEvent(0));
+    queue.track(makeEvent(1));
+    assert.equal(await queue.flush(), false);
+    assert.deepEqual(queue.pending.map((e) => e.uuid), ['e0', 'e1']);
+    assert.equal(await queue.flush(), true);
+    assert.deepEqual(state.events.map((e) => e.uuid), ['e0', 'e1']);
+  }),
+
+  'flushes on its own once FlushAt events are queued': async () => withServer({}, async (baseUrl, state) => {
+    const queue = new EventQueue({ baseUrl, retryCount: 0, compress: false }, { eventBatchSize: 10, maxQueueSize: 100, flushAt: 4 });
+    for (let i = 0; i < 4; i += 1) queue.track(makeEvent(i));
+    assert.equal(await queue.flush(), true);
+    assert.deepEqual(state.requests.map((r) => r.body.batch.length), [4]);
+  }),
+
+  'profile, entitled and usage responses carry the fields the bridge parses': async () => {
+    const profile = {
+      features: [{ id: 'coins', type: 'metered', balance: 5 }],
+      campaigns: [{ id: 'c1', trigger: { type: 'event', event_name: 'level_complete' } }],
+    };
+    await withServer({ profile }, async (baseUrl) => {
+      const settings = { baseUrl, retryCount: 0, compress: true };
+
+      const fetched = JSON.parse((await post(settings, '/v1/profile', { distinct_id: 'user_1' })).body);
+      assert.equal(fetched.customer_id, 'user_1');
+      assert.equal(fetched.campaigns[0].trigger.event_name, 'level_complete');
+
+      const entitled = JSON.parse((await post(settings, '/v1/entitled', { distinct_id: 'user_1', feature_id: 'coins', required_balance: 3 })).body);
+      assert.deepEqual(
+        [entitled.feature_id, entitled.required_balance, entitled.allowed, entitled.unlimited, entitled.balance, entitled.type],
+        ['coins', 3, true, false, 5, 'metered']);
+
+      const usage = JSON.parse((await post(settings, '/v1/usage', { distinct_id: 'user_1', feature_id: 'coins', amount: 2, set_usage: false, metadata: {} })).body);
+      assert.equal(usage.success, true);
+      assert.equal(usage.amount_used, 2);
+      assert.equal(usage.usage.remaining, 3);
+    });
+  },
+};
+
+let failures = 0;
+for (const [name, run] of Object.entries(cases)) {
+  try {
+    await run();
+  } catch (error) {
+    failures += 1;
+    console.error(`[FAIL] ${name}: ${error.message}`);
+  }
+}
+
+if (failures > 0) {
+  process.exit(1);
+}
+
+console.log(`HTTP bridge contract tests passed (${Object.keys(cases).length} cases)`);